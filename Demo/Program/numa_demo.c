@@ -0,0 +1,178 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/numa_demo: effect of NUMA placement on large matrices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Usage:  numa_demo [n [d]]
+
+// A random n-by-n sparse matrix A with d entries per row (default n = 4
+// million, d = 16) is created by a single user thread, and imported into
+// GraphBLAS.  Its pages then all lie on the NUMA node of that thread, which
+// is the worst case for a multi-socket system.  Copies of A are then made
+// with each GxB_NUMA_POLICY, and the same memory-bound operations are timed
+// on each copy: y=A*x, s=sum(A), and C=A+A.  The policy remains in effect
+// while each copy is benchmarked, so the results y and C are placed the same
+// way.
+
+// The effect is only visible on a system with two or more NUMA nodes, and
+// only if the OpenMP threads are bound to cores.  Run it with, for example:
+//
+//      OMP_PROC_BIND=spread OMP_PLACES=cores numa_demo
+//
+// and compare with numactl --cpunodebind=0 --membind=0 to see the bandwidth
+// of a single socket.
+
+#include "GraphBLAS.h"
+#include <math.h>
+#include <time.h>
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+#define OK(method)                                                          \
+{                                                                           \
+    GrB_Info info = method ;                                                \
+    if (info != GrB_SUCCESS)                                                \
+    {                                                                       \
+        printf ("GraphBLAS error: %d line %d\n", info, __LINE__) ;          \
+        exit (1) ;                                                          \
+    }                                                                       \
+}
+
+#define NTRIALS 5
+
+static double wtime (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return ((double) clock ( ) / CLOCKS_PER_SEC) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// bench: time y=A*x, s=sum(A), and C=A+A, best of NTRIALS
+//------------------------------------------------------------------------------
+
+static void bench (const char *name, GrB_Matrix A, GrB_Vector x, GrB_Index n)
+{
+    GrB_Vector y ;
+    GrB_Matrix C ;
+    OK (GrB_Vector_new (&y, GrB_FP64, n)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    double t_mxv = INFINITY, t_reduce = INFINITY, t_add = INFINITY, s = 0 ;
+    for (int trial = 0 ; trial < NTRIALS ; trial++)
+    {
+        double t = wtime ( ) ;
+        OK (GrB_mxv (y, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, x, NULL)) ;
+        OK (GrB_Vector_wait (&y)) ;
+        t_mxv = fmin (t_mxv, wtime ( ) - t) ;
+        t = wtime ( ) ;
+        OK (GrB_Matrix_reduce_FP64 (&s, NULL, GrB_PLUS_MONOID_FP64, A, NULL)) ;
+        t_reduce = fmin (t_reduce, wtime ( ) - t) ;
+        t = wtime ( ) ;
+        OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, GrB_PLUS_FP64, A, A,
+            NULL)) ;
+        OK (GrB_Matrix_wait (&C)) ;
+        t_add = fmin (t_add, wtime ( ) - t) ;
+    }
+    printf ("%-12s  y=A*x: %10.4f  sum(A): %10.4f  C=A+A: %10.4f"
+        "  (sum %g)\n", name, t_mxv, t_reduce, t_add, s) ;
+    GrB_Vector_free (&y) ;
+    GrB_Matrix_free (&C) ;
+}
+
+//------------------------------------------------------------------------------
+// numa_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+
+    GrB_Index n = (argc > 1) ? (GrB_Index) strtoll (argv [1], NULL, 10)
+        : 4000000 ;
+    GrB_Index d = (argc > 2) ? (GrB_Index) strtoll (argv [2], NULL, 10) : 16 ;
+    n = (n < 1) ? 1 : n ;
+    d = (d < 1) ? 1 : ((d > n) ? n : d) ;
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads, nnodes ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads)) ;
+    OK (GxB_Global_Option_get (GxB_NUMA_NODES, &nnodes)) ;
+    printf ("numa_demo: n %" PRIu64 " entries/row %" PRIu64
+        " threads %d NUMA nodes %d\n", n, d, nthreads, nnodes) ;
+    #if defined ( _OPENMP )
+    if (omp_get_proc_bind ( ) == omp_proc_bind_false)
+    {
+        printf ("OpenMP threads are not bound: set OMP_PROC_BIND=spread"
+            " and OMP_PLACES=cores\n") ;
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // create A by a single thread, in CSR form
+    //--------------------------------------------------------------------------
+
+    double t = wtime ( ) ;
+    GrB_Index nvals = n * d ;
+    GrB_Index *Ap = (GrB_Index *) malloc ((n+1) * sizeof (GrB_Index)) ;
+    GrB_Index *Aj = (GrB_Index *) malloc (nvals * sizeof (GrB_Index)) ;
+    double    *Ax = (double    *) malloc (nvals * sizeof (double)) ;
+    if (Ap == NULL || Aj == NULL || Ax == NULL)
+    {
+        printf ("out of memory\n") ;
+        exit (1) ;
+    }
+    uint64_t seed = 42 ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        Ap [i] = i * d ;
+        // d distinct columns in ascending order: a random start and stride
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+        GrB_Index stride = 1 + (seed >> 33) % (n / d) ;
+        GrB_Index start = (seed >> 17) % (n - stride * (d-1)) ;
+        for (GrB_Index k = 0 ; k < d ; k++)
+        {
+            Aj [i*d+k] = start + k * stride ;
+            Ax [i*d+k] = 1.0 / (double) (1 + (i+k) % 7) ;
+        }
+    }
+    Ap [n] = nvals ;
+
+    GrB_Matrix A ;
+    OK (GxB_Matrix_import_CSR (&A, GrB_FP64, n, n, &Ap, &Aj, (void **) &Ax,
+        (n+1) * sizeof (GrB_Index), nvals * sizeof (GrB_Index),
+        nvals * sizeof (double), false, false, NULL)) ;
+
+    GrB_Vector x ;
+    OK (GrB_Vector_new (&x, GrB_FP64, n)) ;
+    OK (GrB_Vector_assign_FP64 (x, NULL, NULL, 1, GrB_ALL, n, NULL)) ;
+    printf ("time to create A: %g sec\n\n", wtime ( ) - t) ;
+
+    //--------------------------------------------------------------------------
+    // benchmark A as created, then copies of A made with each policy
+    //--------------------------------------------------------------------------
+
+    bench ("single node", A, x, n) ;
+
+    GxB_NUMA_Policy_Value policies [3] =
+        { GxB_NUMA_DEFAULT, GxB_NUMA_FIRST_TOUCH, GxB_NUMA_INTERLEAVE } ;
+    const char *names [3] = { "default", "first touch", "interleave" } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        GrB_Matrix B ;
+        OK (GxB_Global_Option_set (GxB_NUMA_POLICY, policies [k])) ;
+        OK (GrB_Matrix_dup (&B, A)) ;
+        bench (names [k], B, x, n) ;
+        GrB_Matrix_free (&B) ;
+    }
+    OK (GxB_Global_Option_set (GxB_NUMA_POLICY, GxB_NUMA_DEFAULT)) ;
+
+    GrB_Matrix_free (&A) ;
+    GrB_Vector_free (&x) ;
+    GrB_finalize ( ) ;
+}
@@ -713,6 +713,28 @@ GrB_Info GB_Type_new            // not user-callable; use GrB_Type_new instead
     const char *name            // name of the type, as "sizeof (ctype)"
 ) ;
 
+// GxB_Type_new_vector creates a type whose values are each a fixed-length
+// vector of k values of a built-in type (a "block" entry, such as a feature
+// vector of a graph edge), where the C type is float [k] or double [k].
+// GxB_BinaryOp_new_vector creates an operator on this type that applies a
+// built-in operator to each of the k values, with a loop over k that the
+// compiler can vectorize.  Monoids and semirings are built from these
+// operators with GrB_Monoid_new_UDT and GrB_Semiring_new, and they may be
+// used in any method that accepts a user-defined type.  k must be in the
+// range 1 to GxB_VECTOR_MAXLEN.  Every method applies these operators with
+// the same vectorized loop, for any k.  The PLUS_TIMES semiring built from
+// these operators also has a native kernel for C=A*B with the saxpy methods.
+
+#define GxB_VECTOR_MAXLEN 256
+
+GB_PUBLIC
+GrB_Info GxB_Type_new_vector    // create a type of k values of a built-in type
+(
+    GrB_Type *type,             // handle of the new type
+    GrB_Type etype,             // type of each value: GrB_FP32 or GrB_FP64
+    int k                       // number of values: 1 to 256
+) ;
+
 GB_PUBLIC
 GrB_Info GxB_Type_size          // determine the size of the type
 (
@@ -1382,6 +1404,18 @@ GrB_Info GB_BinaryOp_new            // not user-callable; use GrB_BinaryOp_new
     const char *name                // name of the underlying function
 ) ;
 
+// GxB_BinaryOp_new_vector: z(t) = scalar_op (x(t), y(t)) for t = 0:k-1, for
+// a type created by GxB_Type_new_vector.  The scalar_op must be GrB_PLUS_T,
+// GrB_TIMES_T, GrB_MIN_T, GrB_MAX_T, GrB_FIRST_T, or GrB_SECOND_T, where T is
+// the type of each value (FP32 or FP64).
+GB_PUBLIC
+GrB_Info GxB_BinaryOp_new_vector    // create an op on vector-valued entries
+(
+    GrB_BinaryOp *binaryop,         // handle for the new binary operator
+    GrB_BinaryOp scalar_op,         // operator to apply to each value
+    GrB_Type type                   // type from GxB_Type_new_vector
+) ;
+
 GB_PUBLIC
 GrB_Info GxB_BinaryOp_ztype         // return the type of z
 (
@@ -2211,6 +2245,26 @@ typedef struct GB_Vector_opaque *GrB_Vector ;
 // These methods create, free, copy, and clear a vector.  The size, nvals,
 // and type methods return basic information about a vector.
 
+// GxB_Vector_memoryUsage (usage, v) and GxB_Matrix_memoryUsage (usage, A)
+// return the number of bytes held by a vector or matrix, in the array
+// size_t usage [GxB_NMEMORY_USAGE].  Each of the 5 arrays of the data
+// structure (A->p, A->h, A->i, A->x, and A->b) is reported separately, by
+// the size of its allocated block.  GxB_MEMORY_SLACK is the part of those 5
+// blocks, and of the pending tuples, that is allocated but not in use, to
+// leave room for more entries.  If A shares its content with a snapshot (see
+// GxB_Matrix_snapshot), that content is reported in full for each matrix that
+// shares it.
+#define GxB_NMEMORY_USAGE 9         // size of usage array
+#define GxB_MEMORY_P 0              // bytes held by A->p
+#define GxB_MEMORY_H 1              // bytes held by A->h
+#define GxB_MEMORY_I 2              // bytes held by A->i
+#define GxB_MEMORY_X 3              // bytes held by A->x
+#define GxB_MEMORY_B 4              // bytes held by A->b
+#define GxB_MEMORY_PENDING 5        // bytes held by pending tuples
+#define GxB_MEMORY_OTHER 6          // bytes held by the header, logger, stats
+#define GxB_MEMORY_SLACK 7          // bytes allocated but not in use
+#define GxB_MEMORY_TOTAL 8          // sum of usage [0..6]
+
 GB_PUBLIC
 GrB_Info GrB_Vector_new     // create a new vector with no entries
 (
@@ -2226,6 +2280,16 @@ GrB_Info GrB_Vector_dup     // make an exact copy of a vector
     const GrB_Vector u      // input vector to copy
 ) ;
 
+// GxB_Vector_snapshot: s = v, where s shares the content of v.  See
+// GxB_Matrix_snapshot.
+
+GB_PUBLIC
+GrB_Info GxB_Vector_snapshot    // create a read-only snapshot of a vector
+(
+    GrB_Vector *s,              // handle of snapshot to create
+    const GrB_Vector v          // vector to take a snapshot of
+) ;
+
 GB_PUBLIC
 GrB_Info GrB_Vector_clear   // clear a vector of all entries;
 (                           // type and dimension remain unchanged.
@@ -2253,6 +2317,13 @@ GrB_Info GxB_Vector_type    // get the type of a vector
     const GrB_Vector v      // vector to query
 ) ;
 
+GB_PUBLIC
+GrB_Info GxB_Vector_memoryUsage // get the memory held by a vector
+(
+    size_t usage [GxB_NMEMORY_USAGE], // bytes held; see GxB_Matrix_memoryUsage
+    const GrB_Vector v      // vector to query
+) ;
+
 GB_PUBLIC
 GrB_Info GrB_Vector_free    // free a vector
 (
@@ -2720,6 +2791,352 @@ GrB_Info GrB_Vector_removeElement
     GrB_Index i                     // index
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Vector_setElements
+//------------------------------------------------------------------------------
+
+// Set a list of entries in a vector, w(I(k)) = X(k) for k = 0:nvals-1,
+// typecasting from the type of X to the type of w, as needed.  The result is
+// the same as calling GrB_Vector_setElement for each tuple in order, so if
+// an index appears more than once, the last value is used.  The list is
+// checked, sorted, and applied to w in parallel.
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_BOOL    // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const bool *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_INT8    // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const int8_t *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UINT8   // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const uint8_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_INT16   // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const int16_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UINT16  // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const uint16_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_INT32   // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const int32_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UINT32  // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const uint32_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_INT64   // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const int64_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UINT64  // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const uint64_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_FP32    // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const float *X,                 // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_FP64    // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const double *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_FC32    // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GxB_FC32_t *X,            // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_FC64    // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GxB_FC64_t *X,            // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UDT     // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements         // w(I(k)) = X(k)
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const <type> *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Vector_setElements(w,I,X,nvals)                \
+    _Generic ((X), GB_CASES (*, GxB, Vector_setElements))  \
+    (w, I, ((const void *) (X)), nvals)
+#endif
+
+//------------------------------------------------------------------------------
+// GxB_Vector_extractElements
+//------------------------------------------------------------------------------
+
+// Extract a list of entries from a vector, X(k) = v(I(k)) for k = 0:nvals-1,
+// typecasting from the type of v to the type of X, as needed.  If v(I(k)) is
+// not present, X(k) is not modified.  If Present is not NULL, Present [k] is
+// set true if v(I(k)) is present, and false otherwise.  Returns GrB_SUCCESS
+// if all entries are present, or GrB_NO_VALUE if any are not.
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_BOOL // X(k) = v(I(k))
+(
+    bool *X,                        // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_INT8 // X(k) = v(I(k))
+(
+    int8_t *X,                      // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UINT8 // X(k) = v(I(k))
+(
+    uint8_t *X,                     // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_INT16 // X(k) = v(I(k))
+(
+    int16_t *X,                     // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UINT16 // X(k) = v(I(k))
+(
+    uint16_t *X,                    // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_INT32 // X(k) = v(I(k))
+(
+    int32_t *X,                     // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UINT32 // X(k) = v(I(k))
+(
+    uint32_t *X,                    // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_INT64 // X(k) = v(I(k))
+(
+    int64_t *X,                     // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UINT64 // X(k) = v(I(k))
+(
+    uint64_t *X,                    // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_FP32 // X(k) = v(I(k))
+(
+    float *X,                       // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_FP64 // X(k) = v(I(k))
+(
+    double *X,                      // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_FC32 // X(k) = v(I(k))
+(
+    GxB_FC32_t *X,                  // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_FC64 // X(k) = v(I(k))
+(
+    GxB_FC64_t *X,                  // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UDT // X(k) = v(I(k))
+(
+    void *X,                        // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements     // X(k) = v(I(k))
+(
+    <type> *X,                      // array of extracted values
+    bool *Present,                  // optional: true if v(I(k)) present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Vector_extractElements(X,Present,v,I,nvals)        \
+    _Generic ((X), GB_CASES (*, GxB, Vector_extractElements))  \
+    (X, Present, v, I, nvals)
+#endif
+
+//------------------------------------------------------------------------------
+// GxB_Vector_removeElements
+//------------------------------------------------------------------------------
+
+// GxB_Vector_removeElements (w,I,nvals) removes the entries w(I(k)) for
+// k = 0:nvals-1 from the vector w, if present.
+
+GB_PUBLIC
+GrB_Info GxB_Vector_removeElements      // remove w(I(k))
+(
+    GrB_Vector w,                   // vector to remove entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_Vector_extractTuples
 //------------------------------------------------------------------------------
@@ -2901,6 +3318,21 @@ GrB_Info GrB_Matrix_dup     // make an exact copy of a matrix
     const GrB_Matrix A      // input matrix to copy
 ) ;
 
+// GxB_Matrix_snapshot: S = A, where S shares the content of A instead of
+// copying it (copy-on-write).  Any pending work on A is finished first, and
+// then the snapshot takes O(1) time.  S is an immutable version of A: one user
+// thread can read S (as an input to any GraphBLAS method) while another
+// continues to modify A.  The first time A (or S) is modified, it is given its
+// own copy of the content.  Creating the snapshot must not be done while
+// another thread is using A.  Free S with GrB_Matrix_free when done.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_snapshot    // create a read-only snapshot of a matrix
+(
+    GrB_Matrix *S,              // handle of snapshot to create
+    const GrB_Matrix A          // matrix to take a snapshot of
+) ;
+
 GB_PUBLIC
 GrB_Info GrB_Matrix_clear   // clear a matrix of all entries;
 (                           // type and dimensions remain unchanged
@@ -2935,6 +3367,13 @@ GrB_Info GxB_Matrix_type    // get the type of a matrix
     const GrB_Matrix A      // matrix to query
 ) ;
 
+GB_PUBLIC
+GrB_Info GxB_Matrix_memoryUsage // get the memory held by a matrix
+(
+    size_t usage [GxB_NMEMORY_USAGE], // bytes held, indexed by GxB_MEMORY_*
+    const GrB_Matrix A      // matrix to query
+) ;
+
 GB_PUBLIC
 GrB_Info GrB_Matrix_free    // free a matrix
 (
@@ -3449,34 +3888,413 @@ GrB_Info GrB_Matrix_removeElement
 ) ;
 
 //------------------------------------------------------------------------------
-// GrB_Matrix_extractTuples
+// GxB_Matrix_setElements
 //------------------------------------------------------------------------------
 
-// Extracts all tuples from a matrix, like [I,J,X] = find (A) in MATLAB.  If
-// any parameter I, J and/or X is NULL, then that component is not extracted.
-// For example, to extract just the row and col indices, pass I and J as
-// non-NULL, and X as NULL.  This is like [I,J,~] = find (A).
+// Set a list of entries in a matrix, C(I(k),J(k)) = X(k) for k = 0:nvals-1,
+// typecasting from the type of X to the type of C, as needed.  The result is
+// the same as calling GrB_Matrix_setElement for each tuple in order, so if
+// an entry appears more than once, the last value is used.  The list is
+// checked, sorted, and applied to C in parallel.  Entries already in C are
+// modified in place, and the rest become pending tuples.
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractTuples_BOOL      // [I,J,X] = find (A)
+GrB_Info GxB_Matrix_setElements_BOOL    // C(I(k),J(k)) = X(k)
 (
-    GrB_Index *I,               // array for returning row indices of tuples
-    GrB_Index *J,               // array for returning col indices of tuples
-    bool *X,                    // array for returning values of tuples
-    GrB_Index *nvals,           // I,J,X size on input; # tuples on output
-    const GrB_Matrix A          // matrix to extract tuples from
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const bool *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractTuples_INT8      // [I,J,X] = find (A)
+GrB_Info GxB_Matrix_setElements_INT8    // C(I(k),J(k)) = X(k)
 (
-    GrB_Index *I,               // array for returning row indices of tuples
-    GrB_Index *J,               // array for returning col indices of tuples
-    int8_t *X,                  // array for returning values of tuples
-    GrB_Index *nvals,           // I,J,X size on input; # tuples on output
-    const GrB_Matrix A          // matrix to extract tuples from
-) ;
-
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int8_t *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UINT8   // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint8_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_INT16   // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int16_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UINT16  // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint16_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_INT32   // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int32_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UINT32  // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint32_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_INT64   // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int64_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UINT64  // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint64_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_FP32    // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const float *X,                 // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_FP64    // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const double *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_FC32    // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const GxB_FC32_t *X,            // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_FC64    // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const GxB_FC64_t *X,            // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UDT     // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements         // C(I(k),J(k)) = X(k)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const <type> *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Matrix_setElements(C,I,J,X,nvals)               \
+    _Generic ((X), GB_CASES (*, GxB, Matrix_setElements))  \
+    (C, I, J, ((const void *) (X)), nvals)
+#endif
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractElements
+//------------------------------------------------------------------------------
+
+// Extract a list of entries from a matrix, X(k) = A(I(k),J(k)) for
+// k = 0:nvals-1, typecasting from the type of A to the type of X, as needed.
+// If A(I(k),J(k)) is not present, X(k) is not modified.  If Present is not
+// NULL, Present [k] is set true if A(I(k),J(k)) is present, and false
+// otherwise.  Returns GrB_SUCCESS if all entries are present, or GrB_NO_VALUE
+// if any are not.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_BOOL // X(k) = A(I(k),J(k))
+(
+    bool *X,                        // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_INT8 // X(k) = A(I(k),J(k))
+(
+    int8_t *X,                      // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UINT8 // X(k) = A(I(k),J(k))
+(
+    uint8_t *X,                     // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_INT16 // X(k) = A(I(k),J(k))
+(
+    int16_t *X,                     // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UINT16 // X(k) = A(I(k),J(k))
+(
+    uint16_t *X,                    // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_INT32 // X(k) = A(I(k),J(k))
+(
+    int32_t *X,                     // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UINT32 // X(k) = A(I(k),J(k))
+(
+    uint32_t *X,                    // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_INT64 // X(k) = A(I(k),J(k))
+(
+    int64_t *X,                     // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UINT64 // X(k) = A(I(k),J(k))
+(
+    uint64_t *X,                    // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_FP32 // X(k) = A(I(k),J(k))
+(
+    float *X,                       // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_FP64 // X(k) = A(I(k),J(k))
+(
+    double *X,                      // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_FC32 // X(k) = A(I(k),J(k))
+(
+    GxB_FC32_t *X,                  // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_FC64 // X(k) = A(I(k),J(k))
+(
+    GxB_FC64_t *X,                  // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UDT // X(k) = A(I(k),J(k))
+(
+    void *X,                        // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements     // X(k) = A(I(k),J(k))
+(
+    <type> *X,                      // array of extracted values
+    bool *Present,                  // optional: true if A(I(k),J(k)) present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Matrix_extractElements(X,Present,A,I,J,nvals)      \
+    _Generic ((X), GB_CASES (*, GxB, Matrix_extractElements))  \
+    (X, Present, A, I, J, nvals)
+#endif
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_removeElements
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_removeElements (C,I,J,nvals) removes the entries C(I(k),J(k))
+// for k = 0:nvals-1 from the matrix C, if present.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_removeElements      // remove C(I(k),J(k))
+(
+    GrB_Matrix C,                   // matrix to remove entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+//------------------------------------------------------------------------------
+// GrB_Matrix_extractTuples
+//------------------------------------------------------------------------------
+
+// Extracts all tuples from a matrix, like [I,J,X] = find (A) in MATLAB.  If
+// any parameter I, J and/or X is NULL, then that component is not extracted.
+// For example, to extract just the row and col indices, pass I and J as
+// non-NULL, and X as NULL.  This is like [I,J,~] = find (A).
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractTuples_BOOL      // [I,J,X] = find (A)
+(
+    GrB_Index *I,               // array for returning row indices of tuples
+    GrB_Index *J,               // array for returning col indices of tuples
+    bool *X,                    // array for returning values of tuples
+    GrB_Index *nvals,           // I,J,X size on input; # tuples on output
+    const GrB_Matrix A          // matrix to extract tuples from
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractTuples_INT8      // [I,J,X] = find (A)
+(
+    GrB_Index *I,               // array for returning row indices of tuples
+    GrB_Index *J,               // array for returning col indices of tuples
+    int8_t *X,                  // array for returning values of tuples
+    GrB_Index *nvals,           // I,J,X size on input; # tuples on output
+    const GrB_Matrix A          // matrix to extract tuples from
+) ;
+
 GB_PUBLIC
 GrB_Info GrB_Matrix_extractTuples_UINT8     // [I,J,X] = find (A)
 (
@@ -3802,6 +4620,25 @@ typedef enum            // for global options or matrix options
     GxB_PRINTF = 101,   // printf function diagnostic output
     GxB_FLUSH = 102,    // flush function diagnostic output
     GxB_MEMORY_POOL = 103,  // memory pool control
+    GxB_THREAD_BUDGET = 113,        // max # of threads of all user threads
+                        // together.  If <= GxB_DEFAULT (the default), each
+                        // user thread uses up to GxB_NTHREADS threads, no
+                        // matter how many other user threads call GraphBLAS.
+    GxB_LOAD_BALANCE = 114,         // task load balancing for GrB_mxm
+                                    // (GxB_Load_Balance_Value)
+    GxB_NUMA_POLICY = 115,          // placement of large blocks of memory
+                                    // (GxB_NUMA_Policy_Value)
+    GxB_NUMA_NODES = 116,           // # of NUMA nodes (int, get only)
+    GxB_HUGE_PAGE = 117,            // min size of blocks to back with huge
+                                    // pages (int64_t), or 0 for none
+    GxB_MEMORY_BUDGET = 118,        // max workspace per method (int64_t), or
+                                    // 0 for no limit
+    GxB_MEMORY_STORAGE = 119,       // bytes held by objects (int64_t, get only)
+    GxB_MEMORY_STORAGE_PEAK = 120,  // peak of GxB_MEMORY_STORAGE (int64_t)
+    GxB_MEMORY_WORKSPACE = 121,     // bytes of workspace (int64_t, get only)
+    GxB_MEMORY_WORKSPACE_PEAK = 122,    // peak of GxB_MEMORY_WORKSPACE
+    GxB_TILE_SIZE = 123,            // max dimension of the tiles of GrB_mxm
+                                    // and GrB_transpose (int64_t), or 0
 
     //------------------------------------------------------------
     // for GxB_Matrix_Option_get only:
@@ -3809,12 +4646,15 @@ typedef enum            // for global options or matrix options
 
     GxB_SPARSITY_STATUS = 33,       // hyper, sparse, bitmap or full (1,2,4,8)
     GxB_IS_HYPER = 6,               // historical; use GxB_SPARSITY_STATUS
+    GxB_CONFORM_COUNT = 36,         // # of sparsity conversions (int64_t)
+    GxB_CONFORM_TIME = 37,          // time spent in conversions (double)
 
     //------------------------------------------------------------
     // for GxB_Matrix_Option_get/set only:
     //------------------------------------------------------------
 
     GxB_SPARSITY_CONTROL = 32,      // sparsity control: 0 to 15; see below
+    GxB_STATS = 38,                 // instrumentation counters; see below
 
     //------------------------------------------------------------
     // GPU and options (DRAFT: do not use)
@@ -3858,6 +4698,23 @@ GB_PUBLIC const double GxB_HYPER_DEFAULT ;
 // the default sparsity control is any format:
 #define GxB_AUTO_SPARSITY GxB_ANY_SPARSITY
 
+// GxB_set (A, GxB_STATS, true) turns on the instrumentation counters of the
+// matrix or vector A, and sets them to zero.  GxB_set (A, GxB_STATS, false)
+// turns them off.  GxB_get (A, GxB_STATS, double stats [GxB_NSTATS]) returns
+// the counters, or all zero if they are off:
+#define GxB_NSTATS 11               // size of stats array for GxB_get
+#define GxB_STATS_WAIT 0            // # of times pending work on A finished
+#define GxB_STATS_WAIT_TIME 1       // time spent finishing it, in seconds
+#define GxB_STATS_PENDING 2         // # of pending tuples assembled
+#define GxB_STATS_ZOMBIES 3         // # of zombies deleted
+#define GxB_STATS_TO_HYPERSPARSE 4  // # of conversions to hypersparse
+#define GxB_STATS_TO_SPARSE 5       // # of conversions to sparse
+#define GxB_STATS_TO_BITMAP 6       // # of conversions to bitmap
+#define GxB_STATS_TO_FULL 7         // # of conversions to full
+#define GxB_STATS_TRANSPOSE 8       // # of inputs transposed to compute A
+#define GxB_STATS_WORKSPACE 9       // peak workspace of operations on A, bytes
+#define GxB_STATS_CONFORM_TIME 10   // time spent in conversions, in seconds
+
 // GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, scontrol) provides hints
 // about which data structure GraphBLAS should use for the matrix A:
 //
@@ -3888,6 +4745,17 @@ GB_PUBLIC const double GxB_HYPER_DEFAULT ;
 // GxB_Matrix_Option_get (A, GxB_SPARSITY_CONTROL, &scontrol) returns the hint
 // for how A should be stored (hypersparse, sparse, bitmap, or full, or any
 // combination).
+//
+// GxB_Matrix_Option_get (A, GxB_CONFORM_COUNT, &count) returns the number of
+// times GraphBLAS has converted A from one data structure to another, as an
+// int64_t.  GxB_Matrix_Option_get (A, GxB_CONFORM_TIME, &t) returns the time
+// spent in those conversions, in seconds, as a double.  These are the sum of
+// GxB_STATS_TO_* and GxB_STATS_CONFORM_TIME, so they are only counted while
+// GxB_STATS is on for A.  If it is off, both return GrB_NO_VALUE and leave
+// count and t unchanged.  If A is converted back and forth between two
+// structures it may use, GraphBLAS widens the range of GxB_HYPER_SWITCH and
+// GxB_BITMAP_SWITCH over which A keeps its current structure, by up to a factor
+// of 16, to avoid further conversions.
 
 // GxB_HYPER_SWITCH:
 //      If the matrix or vector structure can be sparse or hypersparse, the
@@ -3977,6 +4845,234 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
     ...                             // return value of the global option
 ) ;
 
+//------------------------------------------------------------------------------
+// load balancing for GrB_mxm
+//------------------------------------------------------------------------------
+
+// The saxpy-based and masked dot-product methods of GrB_mxm split their work
+// into tasks, from an estimate of the work to compute each vector or entry of
+// the result.  By default (GxB_LOAD_BALANCE_STATIC), each thread is given a
+// few tasks of about the same estimated size.  If the estimate is poor (for
+// example, for graphs with a power-law degree distribution), a few tasks can
+// take much longer than the others.  GxB_LOAD_BALANCE_DYNAMIC splits the work
+// into many more, smaller tasks, and each thread takes the next remaining task
+// as soon as it finishes the last one, so the estimate matters much less.  It
+// can use more workspace.  With GxB_set (GxB_BURBLE, true), the time taken by
+// the tasks of each GrB_mxm is reported.
+
+typedef enum
+{
+    GxB_LOAD_BALANCE_STATIC = 0,    // a few tasks per thread (the default)
+    GxB_LOAD_BALANCE_DYNAMIC = 1    // many small tasks, taken dynamically
+}
+GxB_Load_Balance_Value ;
+
+//------------------------------------------------------------------------------
+// NUMA placement of large blocks of memory
+//------------------------------------------------------------------------------
+
+// On a system with more than one NUMA node (typically, one per socket), each
+// page of memory lies on the node of the thread that first touches it.  The
+// large arrays of a matrix (Ai, Ax, ...) are often created by a single thread,
+// so they lie on a single node, and the threads on the other sockets access
+// them at remote-memory bandwidth.  GxB_NUMA_POLICY controls how GraphBLAS
+// places each large block of memory it allocates:
+
+// GxB_NUMA_DEFAULT: the block is left to the operating system (the default).
+// GxB_NUMA_FIRST_TOUCH: each thread first touches a contiguous slice of the
+//      block, in the same static partition that the parallel methods later
+//      use to work on the block.
+// GxB_NUMA_INTERLEAVE: the pages of the block are interleaved across all NUMA
+//      nodes (Linux only; otherwise GxB_NUMA_FIRST_TOUCH is used).
+
+// GxB_NUMA_FIRST_TOUCH only helps if the OpenMP threads are bound to cores,
+// with (for example) OMP_PROC_BIND=spread and OMP_PLACES=cores.  Otherwise,
+// threads can migrate between sockets and the placement is lost.
+// GxB_get (GxB_NUMA_NODES, &nnodes) returns the number of NUMA nodes the
+// process may allocate memory from.
+
+typedef enum
+{
+    GxB_NUMA_DEFAULT = 0,       // placed by the operating system (default)
+    GxB_NUMA_FIRST_TOUCH = 1,   // each thread touches its slice of the block
+    GxB_NUMA_INTERLEAVE = 2     // pages interleaved across all NUMA nodes
+}
+GxB_NUMA_Policy_Value ;
+
+//------------------------------------------------------------------------------
+// huge pages for large blocks of memory
+//------------------------------------------------------------------------------
+
+// Random access to large arrays (the workspace of GrB_mxm, or the arrays of a
+// large matrix) misses often in the TLB if the arrays are held in 4 KB pages.
+// GxB_set (GxB_HUGE_PAGE, size) asks the operating system to back each block
+// of at least size bytes with 2 MB transparent huge pages (on Linux, with
+// madvise).  This has an effect only if /sys/kernel/mm/transparent_hugepage/
+// enabled is "madvise" or "always".  A size of zero (the default) disables
+// this, and a size less than 2 MB is treated as 2 MB.  To keep freed huge-page
+// blocks for reuse by later calls, raise the limits of GxB_MEMORY_POOL for
+// their sizes.
+
+//------------------------------------------------------------------------------
+// memory budget
+//------------------------------------------------------------------------------
+
+// GxB_set (GxB_MEMORY_BUDGET, bytes) limits the workspace that any single
+// GraphBLAS method may use, in bytes (the default, zero, means no limit).
+// GxB_CONTEXT_MEMORY_BUDGET of an engaged GxB_Context takes precedence.  With
+// a budget, GrB_mxm prefers strategies that need less memory: the hash method
+// and fewer parallel tasks in place of per-task Gustavson workspaces of size
+// m, and a sparse result in place of a bitmap one of size m*n.  A method whose
+// workspace would still exceed the budget returns GrB_OUT_OF_MEMORY, rather
+// than asking the system for the memory.  The memory for the output of the
+// method is not limited.
+
+//------------------------------------------------------------------------------
+// tiled mxm and transpose
+//------------------------------------------------------------------------------
+
+// A matrix is held by row or by column, so C=A*B and C=A' visit the other
+// dimension of a large matrix out of order, with little reuse of the cache.
+// GxB_set (GxB_TILE_SIZE, size) splits the inputs of GrB_mxm, GrB_mxv,
+// GrB_vxm, and GrB_transpose into tiles of at most size-by-size (with
+// GxB_Matrix_split), computes each tile of the result on its own, and
+// concatenates them (with GxB_Matrix_concat).  Tiles of the result are
+// computed in parallel, and a pair of tiles with no entries is skipped.  Each
+// tile of C=A*B is the sum of the products of a row of tiles of A and a
+// column of tiles of B, added with the monoid of the semiring.  The tiles take
+// as much memory again as the inputs and the result.  This is used only for
+// an operation with a dimension larger than the size, and for GrB_mxm only
+// with no mask.  A size of zero (the default) disables tiling.
+
+//------------------------------------------------------------------------------
+// memory usage
+//------------------------------------------------------------------------------
+
+// GraphBLAS counts the memory it holds, in bytes, in two global counters:
+// GxB_MEMORY_STORAGE, for the content of GraphBLAS objects (matrices, vectors,
+// their pending tuples, and so on), and GxB_MEMORY_WORKSPACE, for the
+// transient workspace of methods in progress (including the arenas of all
+// GxB_Contexts).  GxB_MEMORY_STORAGE_PEAK and GxB_MEMORY_WORKSPACE_PEAK are
+// their high-water marks.  GxB_memoryPeak_reset sets both peaks to the
+// current values of the counters, so that the peak memory of a phase of the
+// application can be measured.  Blocks held in the GxB_MEMORY_POOL are not
+// counted.  Arrays taken from the application by GxB*_import are counted from
+// then on, and arrays given to it by GxB*_export are no longer counted.  To
+// find the memory held by one matrix, use GxB_Matrix_memoryUsage.
+
+GB_PUBLIC
+GrB_Info GxB_memoryPeak_reset (void) ;  // reset the peak memory counters
+
+//------------------------------------------------------------------------------
+// GxB_Context: an execution context for a user thread
+//------------------------------------------------------------------------------
+
+// A GxB_Context holds settings that otherwise come from the global options:
+// the max # of threads and chunk size, the burble and the printf and flush
+// functions it uses, a workspace budget, and a reusable workspace arena.  A
+// user thread engages a context with GxB_Context_engage.  All GraphBLAS
+// methods called by that thread then use the settings of the context, until
+// the thread calls GxB_Context_disengage.  Any setting left at its default
+// is taken from the global options instead.  GxB_NTHREADS and GxB_CHUNK in a
+// descriptor take precedence over the context.  A thread that has no context
+// engaged uses the global options, as before.
+
+// A context can be engaged by only one thread at a time.  Each thread of a
+// multithreaded application can thus be given its own context, and its own
+// share of the cores, without modifying the global options.  A context
+// engaged by the calling thread is disengaged by GxB_Context_free.  A context
+// engaged by another thread is in use, and cannot be freed:
+// GxB_Context_free returns GrB_INVALID_OBJECT and leaves it unchanged.
+
+//      GxB_Context_set (context, GxB_CONTEXT_NTHREADS, int nthreads_max) ;
+//      GxB_Context_set (context, GxB_CONTEXT_CHUNK, double chunk) ;
+//      GxB_Context_set (context, GxB_CONTEXT_BURBLE, bool burble) ;
+//      GxB_Context_set (context, GxB_CONTEXT_PRINTF, void *printf_function) ;
+//      GxB_Context_set (context, GxB_CONTEXT_FLUSH, void *flush_function) ;
+//      GxB_Context_set (context, GxB_CONTEXT_MEMORY_BUDGET, int64_t bytes) ;
+//      GxB_Context_set (context, GxB_CONTEXT_ARENA, int64_t bytes) ;
+//      GxB_Context_set (context, GxB_CONTEXT_ARENA_AUTO, bool arena_auto) ;
+
+// GxB_Context_get takes a pointer to the same types, and returns the setting
+// in effect: the global option if the context setting is at its default.
+
+// GxB_CONTEXT_MEMORY_BUDGET limits the workspace that a single GraphBLAS
+// method may use, in bytes (the default, zero, follows GxB_MEMORY_BUDGET).
+// A method whose workspace would exceed the budget returns GrB_OUT_OF_MEMORY.
+// The memory for the output of the method is not limited.
+
+// GxB_CONTEXT_ARENA allocates a block of memory of the given size, in bytes,
+// owned by the context (the default, zero, means no arena).  Workspace that
+// fits in the arena is taken from it rather than from malloc, and the arena
+// is reused by each method the thread calls, so iterative algorithms do not
+// allocate and free the same workspace repeatedly.  The arena cannot be
+// resized while the context is engaged.
+
+// GxB_CONTEXT_ARENA_AUTO (default false) sizes the arena automatically.  At
+// the start of each method, the arena is grown to hold the peak workspace of
+// the recent methods the thread has called, or shrunk if it is more than
+// twice that size.  The high-water mark decays slowly from one method to the
+// next, so a single large method does not pin a large arena for good.  An
+// iterative algorithm whose workspace does not grow thus allocates no
+// workspace after its first iterations.  GxB_CONTEXT_ARENA then only sets
+// the initial size of the arena, and GxB_Context_get (..., GxB_CONTEXT_ARENA,
+// ...) returns its current size.
+
+typedef struct GB_Context_opaque *GxB_Context ;
+
+typedef enum
+{
+    GxB_CONTEXT_NTHREADS = GxB_NTHREADS,  // max # of threads (int)
+    GxB_CONTEXT_CHUNK = GxB_CHUNK,        // chunk size (double)
+    GxB_CONTEXT_BURBLE = 99,              // diagnostic output (bool)
+    GxB_CONTEXT_PRINTF = 101,             // printf function for the burble
+    GxB_CONTEXT_FLUSH = 102,              // flush function for the burble
+    GxB_CONTEXT_MEMORY_BUDGET = 104,      // max workspace per method (int64_t)
+    GxB_CONTEXT_ARENA = 105,              // size of workspace arena (int64_t)
+    GxB_CONTEXT_ARENA_AUTO = 106          // arena sized automatically (bool)
+}
+GxB_Context_Field ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_new        // create a new context
+(
+    GxB_Context *context        // handle of context to create
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_free       // free a context
+(
+    GxB_Context *context        // handle of context to free
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_set        // set a parameter in a context
+(
+    GxB_Context context,        // context to modify
+    GxB_Context_Field field,    // parameter to change
+    ...                         // value to change it to
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_get        // get a parameter from a context
+(
+    GxB_Context context,        // context to query
+    GxB_Context_Field field,    // parameter to query
+    ...                         // return value of the parameter
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_engage     // engage a context for the calling thread
+(
+    GxB_Context context         // context to engage
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_disengage  // disengage the context of the calling thread
+(
+    GxB_Context context         // context to disengage, or NULL for any
+) ;
+
 //------------------------------------------------------------------------------
 // GxB_set and GxB_get
 //------------------------------------------------------------------------------
@@ -4027,10 +5123,33 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GxB_MEMORY_POOL, free_pool_limit) ;
 //      GxB_set (GxB_MEMORY_POOL, NULL) ;     // set defaults
 //      GxB_get (GxB_MEMORY_POOL, free_pool_limit) ;
+//
+//      GxB_set (GxB_THREAD_BUDGET, int budget) ;
+//      GxB_get (GxB_THREAD_BUDGET, int *budget) ;
+//
+//      GxB_set (GxB_LOAD_BALANCE, GxB_Load_Balance_Value load_balance) ;
+//      GxB_get (GxB_LOAD_BALANCE, GxB_Load_Balance_Value *load_balance) ;
+//
+//      GxB_set (GxB_NUMA_POLICY, GxB_NUMA_Policy_Value policy) ;
+//      GxB_get (GxB_NUMA_POLICY, GxB_NUMA_Policy_Value *policy) ;
+//
+//      GxB_set (GxB_HUGE_PAGE, int64_t size) ;
+//      GxB_get (GxB_HUGE_PAGE, int64_t *size) ;
+//
+//      GxB_set (GxB_MEMORY_BUDGET, int64_t bytes) ;
+//      GxB_get (GxB_MEMORY_BUDGET, int64_t *bytes) ;
+//
+//      GxB_set (GxB_TILE_SIZE, int64_t size) ;
+//      GxB_get (GxB_TILE_SIZE, int64_t *size) ;
 
 // To get global options that can be queried but not modified:
 //
 //      GxB_get (GxB_MODE, GrB_Mode *mode) ;
+//      GxB_get (GxB_NUMA_NODES, int *nnodes) ;
+//      GxB_get (GxB_MEMORY_STORAGE, int64_t *bytes) ;
+//      GxB_get (GxB_MEMORY_STORAGE_PEAK, int64_t *bytes) ;
+//      GxB_get (GxB_MEMORY_WORKSPACE, int64_t *bytes) ;
+//      GxB_get (GxB_MEMORY_WORKSPACE_PEAK, int64_t *bytes) ;
 
 // To set/get a matrix option:
 //
@@ -4051,6 +5170,11 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_get (GrB_Matrix A, GxB_SPARSITY_CONTROL, int *scontrol) ;
 //
 //      GxB_get (GrB_Matrix A, GxB_SPARSITY_STATUS, int *sparsity) ;
+//      GxB_get (GrB_Matrix A, GxB_CONFORM_COUNT, int64_t *count) ;
+//      GxB_get (GrB_Matrix A, GxB_CONFORM_TIME, double *t) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_STATS, bool on) ;
+//      GxB_get (GrB_Matrix A, GxB_STATS, double stats [GxB_NSTATS]) ;
 
 // To set/get a vector option or status:
 //
@@ -4066,6 +5190,15 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_get (GrB_Vector v, GxB_SPARSITY_CONTROL, int *scontrol) ;
 //
 //      GxB_get (GrB_Vector v, GxB_SPARSITY_STATUS, int *sparsity) ;
+//      GxB_get (GrB_Vector v, GxB_CONFORM_COUNT, int64_t *count) ;
+//      GxB_get (GrB_Vector v, GxB_CONFORM_TIME, double *t) ;
+//
+//      GxB_set (GrB_Vector v, GxB_STATS, bool on) ;
+//      GxB_get (GrB_Vector v, GxB_STATS, double stats [GxB_NSTATS]) ;
+
+// GxB_get (A, GxB_CONFORM_COUNT, ...) and GxB_CONFORM_TIME return
+// GrB_NO_VALUE if GxB_STATS is off for the matrix or vector, since its
+// conversions are not counted then.
 
 // To set/get a descriptor field:
 //
@@ -4103,6 +5236,13 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GrB_Descriptor d, GxB_SORT, sort) ;
 //      GxB_get (GrB_Descriptor d, GxB_SORT, int *sort) ;
 
+// To set/get a context option:
+//
+//      GxB_set (GxB_Context c, GxB_CONTEXT_NTHREADS, nthreads_max) ;
+//      GxB_get (GxB_Context c, GxB_CONTEXT_NTHREADS, int *nthreads_max) ;
+//
+//      (see GxB_Context_set above for the other options)
+
 #if GxB_STDC_VERSION >= 201112L
 #define GxB_set(arg1,...)                                   \
     _Generic                                                \
@@ -4112,7 +5252,8 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
               GxB_Option_Field : GxB_Global_Option_set ,    \
               GrB_Vector       : GxB_Vector_Option_set ,    \
               GrB_Matrix       : GxB_Matrix_Option_set ,    \
-              GrB_Descriptor   : GxB_Desc_set               \
+              GrB_Descriptor   : GxB_Desc_set          ,    \
+              GxB_Context      : GxB_Context_set            \
     )                                                       \
     (arg1, __VA_ARGS__)
 
@@ -4129,7 +5270,9 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
         const GrB_Matrix       : GxB_Matrix_Option_get ,    \
               GrB_Matrix       : GxB_Matrix_Option_get ,    \
         const GrB_Descriptor   : GxB_Desc_get          ,    \
-              GrB_Descriptor   : GxB_Desc_get               \
+              GrB_Descriptor   : GxB_Desc_get          ,    \
+        const GxB_Context      : GxB_Context_get       ,    \
+              GxB_Context      : GxB_Context_get            \
     )                                                       \
     (arg1, __VA_ARGS__)
 #endif
@@ -4156,7 +5299,8 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
         GxB_Scalar     *: GxB_Scalar_free     ,  \
         GrB_Vector     *: GrB_Vector_free     ,  \
         GrB_Matrix     *: GrB_Matrix_free     ,  \
-        GrB_Descriptor *: GrB_Descriptor_free    \
+        GrB_Descriptor *: GrB_Descriptor_free ,  \
+        GxB_Context    *: GxB_Context_free       \
     )                                            \
     (object)
 #endif
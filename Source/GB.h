@@ -210,22 +210,6 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
     GB_Context Context
 ) ;
 
-void GB_memcpy                  // parallel memcpy
-(
-    void *dest,                 // destination
-    const void *src,            // source
-    size_t n,                   // # of bytes to copy
-    int nthreads                // # of threads to use
-) ;
-
-void GB_memset                  // parallel memset
-(
-    void *dest,                 // destination
-    const int c,                // value to to set
-    size_t n,                   // # of bytes to set
-    int nthreads                // # of threads to use
-) ;
-
 GrB_Info GB_nvals           // get the number of entries in a matrix
 (
     GrB_Index *nvals,       // matrix has nvals entries
@@ -240,6 +224,13 @@ GrB_Info GB_matvec_type            // get the type of a matrix
     GB_Context Context
 ) ;
 
+GrB_Info GB_memoryUsage         // get the memory held by a matrix
+(
+    size_t usage [GxB_NMEMORY_USAGE],   // bytes held, indexed by GxB_MEMORY_*
+    const GrB_Matrix A,         // matrix to query
+    GB_Context Context
+) ;
+
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 GrB_Info GB_bix_alloc       // allocate A->b, A->i, and A->x space in a matrix
 (
@@ -285,6 +276,38 @@ void GB_phbix_free              // free all content of a matrix
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+GrB_Info GB_snapshot            // create a read-only snapshot of a matrix
+(
+    GrB_Matrix *Shandle,        // handle of snapshot to create
+    GrB_Matrix A,               // matrix to take a snapshot of
+    GB_Context Context
+) ;
+
+GrB_Info GB_share               // C shares the content of A
+(
+    GrB_Matrix C,               // matrix with no content
+    GrB_Matrix A,               // matrix whose content is shared
+    GB_Context Context
+) ;
+
+GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
+GrB_Info GB_unshare             // give A its own copy of any shared content
+(
+    GrB_Matrix A,               // matrix that may share content with snapshots
+    GB_Context Context
+) ;
+
+GrB_Info GB_deferred_finish     // apply the deferred operator of A
+(
+    GrB_Matrix A,               // matrix with a deferred operator
+    GB_Context Context
+) ;
+
+void GB_shared_free             // release content shared with snapshots
+(
+    GB_Shared *shared_handle    // handle of shared content to release
+) ;
+
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 bool GB_Type_compatible             // check if two types can be typecast
 (
@@ -361,6 +384,7 @@ typedef struct          // task descriptor
     int64_t pB ;        // fine task starts at Bi, Bx [pB]
     int64_t pB_end ;    // fine task ends at Bi, Bx [pB_end-1]
     int64_t len ;       // fine task handles a subvector of this length
+    double time ;       // time taken by the task (dot3 only, if burbling)
 }
 GB_task_struct ;
 
@@ -846,8 +870,21 @@ GrB_Info GB_unjumble        // unjumble a matrix
 // true if a matrix is allowed to have zombies
 #define GB_ZOMBIES_OK(A) (((A) == NULL) || ((A) != NULL && (A)->nzombies >= 0))
 
-// true if a matrix has pending tuples or zombies
-#define GB_PENDING_OR_ZOMBIES(A) (GB_PENDING (A) || GB_ZOMBIES (A))
+// true if a matrix has a deferred unary operator (see GB_apply.c)
+#define GB_DEFERRED(A) ((A) != NULL && (A)->deferred_op != NULL)
+
+// true if the content of a matrix can be shared with another matrix without
+// copying any of it: A owns all its content, or all of it is still in the
+// GB_Shared object it already shares (see GB_share.c)
+#define GB_SHAREABLE(A)                                                     \
+    (((A)->shared == NULL) ? !GB_is_shallow (A) :                           \
+    ((A)->p == (A)->shared->p && (A)->h == (A)->shared->h &&                \
+     (A)->b == (A)->shared->b && (A)->i == (A)->shared->i &&                \
+     (A)->x == (A)->shared->x))
+
+// true if a matrix has pending tuples, zombies, or a deferred operator
+#define GB_PENDING_OR_ZOMBIES(A) \
+    (GB_PENDING (A) || GB_ZOMBIES (A) || GB_DEFERRED (A))
 
 // true if a matrix is jumbled
 #define GB_JUMBLED(A) ((A) != NULL && (A)->jumbled)
@@ -855,9 +892,10 @@ GrB_Info GB_unjumble        // unjumble a matrix
 // true if a matrix is allowed to be jumbled
 #define GB_JUMBLED_OK(A) (GB_JUMBLED (A) || !GB_JUMBLED (A))
 
-// true if a matrix has pending tuples, zombies, or is jumbled
+// true if a matrix has pending tuples, zombies, a deferred operator, or is
+// jumbled
 #define GB_ANY_PENDING_WORK(A) \
-    (GB_PENDING (A) || GB_ZOMBIES (A) || GB_JUMBLED (A))
+    (GB_PENDING (A) || GB_ZOMBIES (A) || GB_DEFERRED (A) || GB_JUMBLED (A))
 
 // wait if condition holds
 #define GB_WAIT_IF(condition,A,name)                                    \
@@ -872,8 +910,10 @@ GrB_Info GB_unjumble        // unjumble a matrix
 // do all pending work:  zombies, pending tuples, and unjumble
 #define GB_MATRIX_WAIT(A) GB_WAIT_IF (GB_ANY_PENDING_WORK (A), A, GB_STR (A))
 
-// do all pending work if pending tuples; zombies and jumbled are OK
-#define GB_MATRIX_WAIT_IF_PENDING(A) GB_WAIT_IF (GB_PENDING (A), A, GB_STR (A))
+// do all pending work if pending tuples or a deferred operator; zombies and
+// jumbled are OK
+#define GB_MATRIX_WAIT_IF_PENDING(A) \
+    GB_WAIT_IF (GB_PENDING (A) || GB_DEFERRED (A), A, GB_STR (A))
 
 // delete zombies and assemble any pending tuples; jumbled is O
 #define GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES(A)                         \
@@ -888,6 +928,8 @@ GrB_Info GB_unjumble        // unjumble a matrix
 //------------------------------------------------------------------------------
 
 #include "GB_convert.h"
+#include "GB_stats.h"
+#include "GB_profile.h"
 #include "GB_ops.h"
 
 //------------------------------------------------------------------------------
@@ -246,6 +246,7 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
         GB_BURBLE_MATRIX (C, "(generic C=A*D colscale) ") ;
 
         GxB_binary_function fmult = mult->function ;
+        GB_BINOP_VECTOR (fmult, mult) ;
 
         size_t csize = C->type->size ;
         size_t asize = A_is_pattern ? 0 : A->type->size ;
@@ -307,13 +308,13 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
 
         if (flipxy)
         { 
-            #define GB_BINOP(z,x,y,i,j) fmult (z,y,x)
+            #define GB_BINOP(z,x,y,i,j) GB_BINOP_CALL (fmult,z,y,x)
             #include "GB_AxB_colscale_meta.c"
             #undef GB_BINOP
         }
         else
         { 
-            #define GB_BINOP(z,x,y,i,j) fmult (z,x,y)
+            #define GB_BINOP(z,x,y,i,j) GB_BINOP_CALL (fmult,z,x,y)
             #include "GB_AxB_colscale_meta.c"
             #undef GB_BINOP
         }
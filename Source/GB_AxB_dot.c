@@ -72,15 +72,25 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     ASSERT (!GB_ZOMBIES (M)) ;
 
     ASSERT_MATRIX_OK (A, "A for dot A'*B", GB0) ;
-    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
+    ASSERT_MATRIX_OK (B, "B for dot A'*B", GB0) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (B) ;
+
+    // The dot product kernels merge the patterns of A(:,i) and B(:,j) only if
+    // both are sparse or hypersparse.  Otherwise, the entries of the sparse
+    // one are used to index into the bitmap or full one, in any order.
+    if ((GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) &&
+        (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
+    { 
+        GB_MATRIX_WAIT_IF_JUMBLED (A) ;
+        GB_MATRIX_WAIT_IF_JUMBLED (B) ;
+    }
+
     ASSERT (!GB_PENDING (A)) ;
-    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
     ASSERT (!GB_ZOMBIES (A)) ;
-
-    ASSERT_MATRIX_OK (B, "B for dot A'*B", GB0) ;
-    GB_MATRIX_WAIT (B) ;
     ASSERT (!GB_PENDING (B)) ;
-    ASSERT (!GB_JUMBLED (B)) ;
+    ASSERT (GB_JUMBLED_OK (B)) ;
     ASSERT (!GB_ZOMBIES (B)) ;
 
     ASSERT_SEMIRING_OK (semiring, "semiring for dot A'*B", GB0) ;
@@ -66,10 +66,12 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     ASSERT (GB_JUMBLED_OK (M_in)) ;
     ASSERT (!GB_PENDING (M_in)) ;
     ASSERT (!GB_ZOMBIES (A_in)) ;
-    ASSERT (!GB_JUMBLED (A_in)) ;
+    ASSERT (GB_IMPLIES (GB_JUMBLED (A_in), !GB_IS_SPARSE (B_in) &&
+        !GB_IS_HYPERSPARSE (B_in))) ;
     ASSERT (!GB_PENDING (A_in)) ;
     ASSERT (!GB_ZOMBIES (B_in)) ;
-    ASSERT (!GB_JUMBLED (B_in)) ;
+    ASSERT (GB_IMPLIES (GB_JUMBLED (B_in), !GB_IS_SPARSE (A_in) &&
+        !GB_IS_HYPERSPARSE (A_in))) ;
     ASSERT (!GB_PENDING (B_in)) ;
 
     ASSERT_SEMIRING_OK (semiring, "semiring for numeric A'*B", GB0) ;
@@ -40,15 +40,34 @@ bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
 
     double anz = GB_NNZ (A) ;       // # of entries in A
     double bnz = GB_NNZ (B) ;       // # of entries in B
-    if (A->nvec_nonempty < 0) A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
-    if (B->nvec_nonempty < 0) B->nvec_nonempty = GB_nvec_nonempty (B, Context) ;
-    double anvec = A->nvec_nonempty ;
-    double bnvec = B->nvec_nonempty ;
+    // the summaries of A and B also give their # of non-empty vectors
+    GB_Profile A_work, B_work ;
+    const GB_Profile *A_profile = GB_profile (&A_work, A, Context) ;
+    const GB_Profile *B_profile = GB_profile (&B_work, B, Context) ;
+    if (A_profile == NULL && A->nvec_nonempty < 0)
+    { 
+        A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
+    }
+    if (B_profile == NULL && B->nvec_nonempty < 0)
+    { 
+        B->nvec_nonempty = GB_nvec_nonempty (B, Context) ;
+    }
+    double anvec = (A_profile == NULL) ? A->nvec_nonempty :
+        A_profile->nvec_nonempty ;
+    double bnvec = (B_profile == NULL) ? B->nvec_nonempty :
+        B_profile->nvec_nonempty ;
     double avlen = A->vlen ;
     ASSERT (avlen == B->vlen) ;
     double cnz = (anvec * bnvec) ;  // size of the C bitmap
     double row_degree = anz / GB_IMAX (avlen, 1) ;
     double col_degree = anz / GB_IMAX (anvec, 1) ;
+    if (GB_profile_skewed (A_profile))
+    { 
+        // The mean degree of a skewed A is dominated by a few very long
+        // vectors, and overstates the work of a typical dot product.  Use the
+        // median degree instead.
+        col_degree = (double) GB_profile_median (A_profile) ;
+    }
 
     if (cnz > anz + bnz)
     { 
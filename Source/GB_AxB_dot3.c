@@ -18,9 +18,9 @@
 #include "GB_AxB__include.h"
 #endif
 
-#define GB_FREE_WORK                            \
-{                                               \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
+#define GB_FREE_WORK                                     \
+{                                                        \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
 }
 
 #define GB_FREE_ALL                             \
@@ -57,10 +57,12 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     ASSERT (GB_JUMBLED_OK (M)) ;    // C is jumbled if M is jumbled
     ASSERT (!GB_PENDING (M)) ;
     ASSERT (!GB_ZOMBIES (A)) ;
-    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (GB_IMPLIES (GB_JUMBLED (A), !GB_IS_SPARSE (B) &&
+        !GB_IS_HYPERSPARSE (B))) ;
     ASSERT (!GB_PENDING (A)) ;
     ASSERT (!GB_ZOMBIES (B)) ;
-    ASSERT (!GB_JUMBLED (B)) ;
+    ASSERT (GB_IMPLIES (GB_JUMBLED (B), !GB_IS_SPARSE (A) &&
+        !GB_IS_HYPERSPARSE (A))) ;
     ASSERT (!GB_PENDING (B)) ;
 
     ASSERT (!GB_IS_BITMAP (M)) ;
@@ -235,7 +237,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     // free the current tasks and construct the tasks for the second phase
     //--------------------------------------------------------------------------
 
-    GB_FREE_WERK (&TaskList, TaskList_size) ;
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;
     GB_OK (GB_AxB_dot3_slice (&TaskList, &TaskList_size, &ntasks, &nthreads,
         C, Context)) ;
 
@@ -289,6 +291,9 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
         #include "GB_AxB_dot_generic.c"
     }
 
+    // report the time taken by each task, if burbling
+    GB_BURBLE_TASK_TIMES (TaskList, ntasks) ;
+
     //--------------------------------------------------------------------------
     // free workspace and return result
     //--------------------------------------------------------------------------
@@ -18,10 +18,10 @@
     GB_WERK_POP (Coarse, int64_t) ;             \
 }
 
-#define GB_FREE_ALL                             \
-{                                               \
-    GB_FREE_WORK ;                              \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
+#define GB_FREE_ALL                                      \
+{                                                        \
+    GB_FREE_WORK ;                                       \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
 }
 
 #include "GB_mxm.h"
@@ -19,6 +19,13 @@
 // is costly to compute, it is possible that it is placed by itself in a
 // single coarse task.
 
+// By default, about 32 tasks are created per thread.  With dynamic load
+// balancing (GxB_LOAD_BALANCE_DYNAMIC), GB_DYNAMIC_GRAIN times as many tasks
+// are created.  The tasks are scheduled dynamically, so a thread that finishes
+// its task early takes the next one that remains, and an inaccurate estimate
+// of the work (as for power-law graphs) does not leave a few costly tasks at
+// the end.
+
 // FUTURE:: Ultra-fine tasks could also be constructed, so that the computation
 // of a single entry C(i,j) can be broken into multiple tasks.  The slice of
 // A(:,i) and B(:,j) would use GB_slice_vector, where no mask would be used.
@@ -28,10 +35,10 @@
     GB_WERK_POP (Coarse, int64_t) ;             \
 }
 
-#define GB_FREE_ALL                             \
-{                                               \
-    GB_FREE_WORK ;                              \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
+#define GB_FREE_ALL                                      \
+{                                                        \
+    GB_FREE_WORK ;                                       \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
 }
 
 #include "GB_mxm.h"
@@ -111,7 +118,10 @@ GrB_Info GB_AxB_dot3_slice
     GB_task_struct *restrict TaskList = NULL ; size_t TaskList_size = 0 ;
     int max_ntasks = 0 ;
     int ntasks = 0 ;
-    int ntasks0 = (nthreads == 1) ? 1 : (32 * nthreads) ;
+    // with dynamic load balancing, use many smaller tasks
+    int grain = (GB_Global_load_balance_get ( ) == GxB_LOAD_BALANCE_DYNAMIC)
+        ? GB_DYNAMIC_GRAIN : 1 ;
+    int ntasks0 = (nthreads == 1) ? 1 : (32 * grain * nthreads) ;
     GB_REALLOC_TASK_WERK (TaskList, ntasks0, max_ntasks) ;
 
     //--------------------------------------------------------------------------
@@ -125,6 +135,7 @@ GrB_Info GB_AxB_dot3_slice
         TaskList [0].klast  = cnvec-1 ;
         TaskList [0].pC = 0 ;
         TaskList [0].pC_end  = cnz ;
+        TaskList [0].time = 0 ;
         (*p_TaskList  ) = TaskList ;
         (*p_TaskList_size) = TaskList_size ;
         (*p_ntasks    ) = (cnvec == 0) ? 0 : 1 ;
@@ -137,7 +148,7 @@ GrB_Info GB_AxB_dot3_slice
     //--------------------------------------------------------------------------
 
     double target_task_size = total_work / (double) (ntasks0) ;
-    target_task_size = GB_IMAX (target_task_size, chunk) ;
+    target_task_size = GB_IMAX (target_task_size, chunk / grain) ;
     ntasks1 = total_work / target_task_size ;
     ntasks1 = GB_IMIN (ntasks1, cnz) ;
     ntasks1 = GB_IMAX (ntasks1, 1) ;
@@ -195,6 +206,7 @@ GrB_Info GB_AxB_dot3_slice
             ASSERT (kfirst <= klast) ;
             TaskList [ntasks].pC     = pfirst ;
             TaskList [ntasks].pC_end = plast + 1 ;
+            TaskList [ntasks].time = 0 ;
             ntasks++ ;
 
         }
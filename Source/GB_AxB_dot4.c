@@ -48,10 +48,12 @@ GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
     ASSERT (!GB_JUMBLED (C)) ;
     ASSERT (!GB_PENDING (C)) ;
     ASSERT (!GB_ZOMBIES (A)) ;
-    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (GB_IMPLIES (GB_JUMBLED (A), !GB_IS_SPARSE (B) &&
+        !GB_IS_HYPERSPARSE (B))) ;
     ASSERT (!GB_PENDING (A)) ;
     ASSERT (!GB_ZOMBIES (B)) ;
-    ASSERT (!GB_JUMBLED (B)) ;
+    ASSERT (GB_IMPLIES (GB_JUMBLED (B), !GB_IS_SPARSE (A) &&
+        !GB_IS_HYPERSPARSE (A))) ;
     ASSERT (!GB_PENDING (B)) ;
 
     ASSERT (!GB_IS_BITMAP (C)) ;
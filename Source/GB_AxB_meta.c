@@ -296,6 +296,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         GBURBLE ("(M transpose) ") ;
         GB_OK (GB_transpose (&MT, GrB_BOOL, C_is_csc, M_in,     // MT static
             NULL, NULL, NULL, false, Context)) ;
+        GB_stats_transpose (C_in) ;
         M = MT ;
         (*M_transposed) = true ;
     }
@@ -336,7 +337,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     #define GB_PROP_LEN (GB_LEN+128)
     char A_str [GB_PROP_LEN+1] ;
     char B_str [GB_PROP_LEN+1] ;
-    if (GB_Global_burble_get ( ))
+    if (GB_Context_burble_get ( ))
     {
         int64_t anz = GB_IS_FULL (A) ? GB_NNZ_FULL (A) : GB_NNZ (A) ;
         int64_t bnz = GB_IS_FULL (B) ? GB_NNZ_FULL (B) : GB_NNZ (B) ;
@@ -426,6 +427,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             ASSERT (GB_DEAD_CODE) ;
             GB_OK (GB_transpose (&BT, btype_required, true, B,  // BT static
                 NULL, NULL, NULL, false, Context)) ;
+            GB_stats_transpose (C_in) ;
             B = BT ;
         }
 
@@ -494,6 +496,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // AT = A'
             GB_OK (GB_transpose (&AT, atype_required, true, A,  // AT static
                 NULL, NULL, NULL, false, Context)) ;
+            GB_stats_transpose (C_in) ;
             // do not use colscale if AT is now bitmap
             if (GB_IS_BITMAP (AT))
             { 
@@ -576,6 +579,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // BT = B'
             GB_OK (GB_transpose (&BT, btype_required, true, B,  // BT static
                 NULL, NULL, NULL, false, Context)) ;
+            GB_stats_transpose (C_in) ;
             // do not use rowscale if BT is now bitmap
             if (axb_method == GB_USE_ROWSCALE && GB_IS_BITMAP (BT))
             { 
@@ -609,6 +613,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                     "(transposed %s) ", M_str, A_str, B_str) ;
                 GB_OK (GB_transpose (&AT, atype_required, true, A,  // AT static
                     NULL, NULL, NULL, false, Context)) ;
+                GB_stats_transpose (C_in) ;
                 GB_OK (GB_AxB_dot (C, (can_do_in_place) ? C_in : NULL,
                     M, Mask_comp, Mask_struct, AT, BT, semiring, flipxy,
                     mask_applied, done_in_place, Context)) ;
@@ -712,6 +717,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                     M_str, A_str) ;
                 GB_OK (GB_transpose (&AT, atype_required, true, A,  // AT static
                     NULL, NULL, NULL, false, Context)) ;
+                GB_stats_transpose (C_in) ;
                 GB_OK (GB_AxB_dot (C, (can_do_in_place) ? C_in : NULL,
                     M, Mask_comp, Mask_struct, AT, B, semiring, flipxy,
                     mask_applied, done_in_place, Context)) ;
@@ -237,6 +237,7 @@ GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
         GB_BURBLE_MATRIX (C, "(generic C=D*B rowscale) ") ;
 
         GxB_binary_function fmult = mult->function ;
+        GB_BINOP_VECTOR (fmult, mult) ;
 
         size_t csize = C->type->size ;
         size_t dsize = D_is_pattern ? 0 : D->type->size ;
@@ -298,13 +299,13 @@ GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
 
         if (flipxy)
         { 
-            #define GB_BINOP(z,x,y,i,j) fmult (z,y,x)
+            #define GB_BINOP(z,x,y,i,j) GB_BINOP_CALL (fmult,z,y,x)
             #include "GB_AxB_rowscale_meta.c"
             #undef GB_BINOP
         }
         else
         { 
-            #define GB_BINOP(z,x,y,i,j) fmult (z,x,y)
+            #define GB_BINOP(z,x,y,i,j) GB_BINOP_CALL (fmult,z,x,y)
             #include "GB_AxB_rowscale_meta.c"
             #undef GB_BINOP
         }
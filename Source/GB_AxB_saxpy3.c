@@ -93,12 +93,12 @@
 #include "GB_AxB__include.h"
 #endif
 
-#define GB_FREE_WORK                                \
-{                                                   \
-    GB_FREE_WERK (&SaxpyTasks, SaxpyTasks_size) ;   \
-    GB_FREE_WERK (&Hi_all, Hi_all_size) ;           \
-    GB_FREE_WERK (&Hf_all, Hf_all_size) ;           \
-    GB_FREE_WERK (&Hx_all, Hx_all_size) ;           \
+#define GB_FREE_WORK                                         \
+{                                                            \
+    GB_FREE_WERK (&SaxpyTasks, SaxpyTasks_size, Context) ;   \
+    GB_FREE_WERK (&Hi_all, Hi_all_size, Context) ;           \
+    GB_FREE_WERK (&Hf_all, Hf_all_size, Context) ;           \
+    GB_FREE_WERK (&Hx_all, Hx_all_size, Context) ;           \
 }
 
 #define GB_FREE_ALL             \
@@ -749,6 +749,9 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         return (GrB_OUT_OF_MEMORY) ;
     }
 
+    // report the time taken by each task, if burbling
+    GB_BURBLE_TASK_TIMES (SaxpyTasks, ntasks) ;
+
     //--------------------------------------------------------------------------
     // prune empty vectors, free workspace, and return result
     //--------------------------------------------------------------------------
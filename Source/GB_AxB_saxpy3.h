@@ -95,6 +95,7 @@ typedef struct
     int64_t my_cjnz ;   // # entries in C(:,j) found by this fine task
     int leader ;        // leader fine task for the vector C(:,j)
     int team_size ;     // # of fine tasks in the team for vector C(:,j)
+    double time ;       // time taken by the numeric phases, if burbling
 }
 GB_saxpy3task_struct ;
 
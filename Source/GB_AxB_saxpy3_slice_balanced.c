@@ -10,7 +10,7 @@
 // If the mask is present but must be discarded, this function returns
 // GrB_NO_VALUE, to indicate that the analysis was terminated early.
 
-#include "GB_AxB_saxpy3.h"
+#include "GB_mxm.h"
 
 // control parameters for generating parallel tasks
 #define GB_NTASKS_PER_THREAD 2
@@ -27,10 +27,10 @@
     GB_WERK_POP (Coarse_initial, int64_t) ; \
 }
 
-#define GB_FREE_ALL                                 \
-{                                                   \
-    GB_FREE_WORK ;                                  \
-    GB_FREE_WERK (&SaxpyTasks, SaxpyTasks_size) ;   \
+#define GB_FREE_ALL                                          \
+{                                                            \
+    GB_FREE_WORK ;                                           \
+    GB_FREE_WERK (&SaxpyTasks, SaxpyTasks_size, Context) ;   \
 }
 
 //------------------------------------------------------------------------------
@@ -180,6 +180,7 @@ static inline void GB_create_coarse_task
     SaxpyTasks [taskid].my_cjnz = 0 ;        // for fine tasks only 
     SaxpyTasks [taskid].leader  = taskid ;
     SaxpyTasks [taskid].team_size = 1 ;
+    SaxpyTasks [taskid].time = 0 ;
 }
 
 //------------------------------------------------------------------------------
@@ -396,6 +397,70 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     int ntasks_initial = ((*nthreads) == 1) ? 1 :
         (GB_NTASKS_PER_THREAD * (*nthreads)) ;
 
+    // If the degrees of B are skewed, the flops are concentrated in a few
+    // vectors of B.  Use twice as many initial coarse tasks, so that the
+    // vectors next to these costly ones are not squeezed into a few large
+    // coarse tasks.
+    GB_Profile A_work, B_work ;
+    const GB_Profile *A_profile = GB_profile (&A_work, A, Context) ;
+    const GB_Profile *B_profile = GB_profile (&B_work, B, Context) ;
+    if (ntasks_initial > 1 && GB_profile_skewed (B_profile))
+    { 
+        ntasks_initial *= 2 ;
+        GBURBLE ("(skewed B) ") ;
+    }
+
+    // With dynamic load balancing, use up to GB_DYNAMIC_GRAIN times as many
+    // coarse tasks, so that a thread that finishes early takes another task
+    // instead of waiting for a few costly ones.  Each coarse task has its own
+    // workspace of size up to cvlen, so the # of tasks is not increased past
+    // the point where that workspace would exceed the flop count.
+    bool dynamic = (GB_Global_load_balance_get ( ) ==
+        GxB_LOAD_BALANCE_DYNAMIC) ;
+    int grain = dynamic ? GB_DYNAMIC_GRAIN : 1 ;
+    if (ntasks_initial > 1 && dynamic)
+    { 
+        double ntasks_max = ((double) total_flops) / ((double) cvlen + 1) ;
+        double ntasks_dynamic = GB_IMIN ((double) grain * ntasks_initial,
+            ntasks_max) ;
+        ntasks_initial = GB_IMAX (ntasks_initial, (int) ntasks_dynamic) ;
+        GBURBLE ("(dynamic: %d tasks) ", ntasks_initial) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // fit the Gustavson workspace in the memory budget
+    //--------------------------------------------------------------------------
+
+    // Each coarse Gustavson task needs its own Hf and Hx workspace of size
+    // cvlen, and all of them are allocated at once.  If that would take more
+    // than half the memory budget, use the hash method instead, whose
+    // workspace is in proportion to the flops of each task.  If Gustavson has
+    // been selected already (explicitly, or because a packed mask M is to be
+    // scattered into Hf), use fewer coarse tasks instead.
+
+    int64_t budget = GB_MEMORY_BUDGET (Context) ;
+    if (budget > 0)
+    {
+        double gustavson_werk = (double) cvlen *
+            (double) (sizeof (int64_t) + C->type->size) ;
+        int ntasks_budget = (int) GB_IMIN ((double) ntasks_initial,
+            GB_IMAX (1, (budget / 2) / (gustavson_werk + 1))) ;
+        if (ntasks_budget < ntasks_initial)
+        {
+            if (!(AxB_method == GxB_AxB_HASH ||
+                  AxB_method == GxB_AxB_GUSTAVSON))
+            { 
+                AxB_method = GxB_AxB_HASH ;
+                GBURBLE ("(budget: hash) ") ;
+            }
+            else if (AxB_method == GxB_AxB_GUSTAVSON)
+            { 
+                ntasks_initial = ntasks_budget ;
+                GBURBLE ("(budget: %d tasks) ", ntasks_initial) ;
+            }
+        }
+    }
+
     //--------------------------------------------------------------------------
     // give preference to Gustavson when using few threads
     //--------------------------------------------------------------------------
@@ -412,7 +477,15 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
         double intensity = total_flops / abnz ;
         GBURBLE ("(intensity: %0.3g workspace/(nnz(A)+nnz(B)): %0.3g",
             intensity, workspace / abnz) ;
-        if (intensity >= 8 && workspace < abnz)
+        if (GB_profile_skewed (A_profile))
+        { 
+            // The intensity of a skewed A is dominated by the few vectors
+            // B(:,j) that touch its very long vectors.  Tasks that compute
+            // those select Gustavson on their own (see GB_hash_table_size),
+            // so keep the default mix for the remaining tasks.
+            GBURBLE (": skewed A) ") ;
+        }
+        else if (intensity >= 8 && workspace < abnz)
         {
             // work intensity is large, and Gustvason workspace is modest;
             // use Gustavson for all tasks
@@ -431,9 +504,9 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     //--------------------------------------------------------------------------
 
     double target_task_size = ((double) total_flops) / ntasks_initial ;
-    target_task_size = GB_IMAX (target_task_size, chunk) ;
+    target_task_size = GB_IMAX (target_task_size, chunk / grain) ;
     double target_fine_size = target_task_size / GB_FINE_WORK ;
-    target_fine_size = GB_IMAX (target_fine_size, chunk) ;
+    target_fine_size = GB_IMAX (target_fine_size, chunk / grain) ;
 
     //--------------------------------------------------------------------------
     // determine # of parallel tasks
@@ -693,6 +766,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                             SaxpyTasks [nf].my_cjnz = 0 ;
                             SaxpyTasks [nf].leader = leader ;
                             SaxpyTasks [nf].team_size = team_size ;
+                            SaxpyTasks [nf].time = 0 ;
                             nf++ ;
                         }
                     }
@@ -38,6 +38,10 @@
 #include "GB_ek_slice_search.c"
 #include "GB_bitmap_assign_methods.h"
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_generic
+//------------------------------------------------------------------------------
+
 GrB_Info GB_AxB_saxpy_generic
 (
     GrB_Matrix C,                   // any sparsity
@@ -74,9 +78,16 @@ GrB_Info GB_AxB_saxpy_generic
 
     GxB_binary_function fmult = mult->function ;    // NULL if positional
     GxB_binary_function fadd  = add->op->function ;
+    GB_BINOP_VECTOR (fmult, mult) ;
+    GB_BINOP_VECTOR (fadd, add->op) ;
     GB_Opcode opcode = mult->opcode ;
     bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
 
+    // # of values in each entry for the PLUS_TIMES semiring on a type from
+    // GxB_Type_new_vector, or zero for any other semiring
+    int vector_k = (fmult_vector_opcode == GB_TIMES_opcode &&
+        fadd_vector_opcode == GB_PLUS_opcode) ? C->type->veclen : 0 ;
+
     size_t csize = C->type->size ;
     size_t asize = A_is_pattern ? 0 : A->type->size ;
     size_t bsize = B_is_pattern ? 0 : B->type->size ;
@@ -346,15 +357,18 @@ GrB_Info GB_AxB_saxpy_generic
 
         // Cx [p] += Hx [i]
         #undef  GB_CIJ_GATHER_UPDATE
-        #define GB_CIJ_GATHER_UPDATE(p,i) fadd (GB_CX (p), GB_CX (p), GB_HX (i))
+        #define GB_CIJ_GATHER_UPDATE(p,i)                                   \
+            GB_BINOP_CALL (fadd, GB_CX (p), GB_CX (p), GB_HX (i))
 
         // Cx [p] += t
         #undef  GB_CIJ_UPDATE
-        #define GB_CIJ_UPDATE(p,t) fadd (GB_CX (p), GB_CX (p), t)
+        #define GB_CIJ_UPDATE(p,t)                                          \
+            GB_BINOP_CALL (fadd, GB_CX (p), GB_CX (p), t)
 
         // Hx [i] += t
         #undef  GB_HX_UPDATE
-        #define GB_HX_UPDATE(i,t) fadd (GB_HX (i), GB_HX (i), t)
+        #define GB_HX_UPDATE(i,t)                                           \
+            GB_BINOP_CALL (fadd, GB_HX (i), GB_HX (i), t)
 
         #undef  GB_CTYPE
         #define GB_CTYPE GB_void
@@ -389,21 +403,66 @@ GrB_Info GB_AxB_saxpy_generic
                 #include "GB_AxB_saxpy_template.c"
             }
         }
-        else
+        else if (vector_k == 0)
         {
-            ASSERT (fmult != NULL) ;
+            ASSERT (fmult != NULL || fmult_veclen > 0) ;
             if (flipxy)
             { 
                 // t = B(k,j) * A(i,k)
                 #undef  GB_MULT
-                #define GB_MULT(t, aik, bkj, i, k, j) fmult (t, bkj, aik)
+                #define GB_MULT(t, aik, bkj, i, k, j)                       \
+                    GB_BINOP_CALL (fmult, t, bkj, aik)
                 #include "GB_AxB_saxpy_template.c"
             }
             else
             { 
                 // t = A(i,k) * B(k,j)
                 #undef  GB_MULT
-                #define GB_MULT(t, aik, bkj, i, k, j) fmult (t, aik, bkj)
+                #define GB_MULT(t, aik, bkj, i, k, j)                       \
+                    GB_BINOP_CALL (fmult, t, aik, bkj)
+                #include "GB_AxB_saxpy_template.c"
+            }
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // native PLUS_TIMES semiring on k float or double values
+            //------------------------------------------------------------------
+
+            // The TIMES operator is commutative, so flipxy is ignored.  A and
+            // B have the type of C, so cast_A and cast_B just copy each entry.
+
+            GBURBLE ("(vector plus_times) ") ;
+            ASSERT (!A_is_pattern && !B_is_pattern) ;
+            ASSERT (A->type == C->type && B->type == C->type) ;
+            ASSERT (csize == vector_k * C->type->etype->size) ;
+
+            // with a constant opcode, GB_vector_binop reduces to one loop
+            #undef  GB_MULT
+            #define GB_MULT(t, aik, bkj, i, k, j)                           \
+                GB_vector_binop (t, aik, bkj, GB_TIMES_opcode, fp32, vector_k)
+            #undef  GB_CIJ_GATHER_UPDATE
+            #define GB_CIJ_GATHER_UPDATE(p,i)                               \
+                GB_vector_binop (GB_CX (p), GB_CX (p), GB_HX (i),           \
+                    GB_PLUS_opcode, fp32, vector_k)
+            #undef  GB_CIJ_UPDATE
+            #define GB_CIJ_UPDATE(p,t)                                      \
+                GB_vector_binop (GB_CX (p), GB_CX (p), t,                   \
+                    GB_PLUS_opcode, fp32, vector_k)
+            #undef  GB_HX_UPDATE
+            #define GB_HX_UPDATE(i,t)                                       \
+                GB_vector_binop (GB_HX (i), GB_HX (i), t,                   \
+                    GB_PLUS_opcode, fp32, vector_k)
+
+            if (C->type->etype == GrB_FP32)
+            { 
+                const bool fp32 = true ;
+                #include "GB_AxB_saxpy_template.c"
+            }
+            else
+            { 
+                const bool fp32 = false ;
                 #include "GB_AxB_saxpy_template.c"
             }
         }
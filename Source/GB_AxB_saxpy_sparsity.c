@@ -11,6 +11,9 @@
 // C<!M>=A*B, based on the sparsity structures of C (on input), M, A, and B,
 // and whether or not M is complemented.
 
+// If the memory budget is set (GxB_MEMORY_BUDGET), a bitmap C that would not
+// fit in it is computed as sparse instead.
+
 // TODO: When A or B are bitmapped or full, they can be transposed in-place.
 // TODO: give the user control over this decision
 
@@ -222,6 +225,18 @@ void GB_AxB_saxpy_sparsity          // determine C_sparsity and method to use
             default: ;
         }
 
+        // A bitmap C needs m*n bytes for C->b alone.  If that exceeds the
+        // memory budget, compute C as sparse with saxpy3 instead, which needs
+        // memory in proportion to the flops.
+        int64_t budget = GB_MEMORY_BUDGET (Context) ;
+        if ((*C_sparsity) == GxB_BITMAP && budget > 0
+            && (double) m * (double) n > (double) budget)
+        { 
+            (*C_sparsity) = (B_sparsity == GxB_HYPERSPARSE) ?
+                GxB_HYPERSPARSE : GxB_SPARSE ;
+            GBURBLE ("(budget: sparse C) ") ;
+        }
+
         if ((*C_sparsity) == GxB_HYPERSPARSE || (*C_sparsity) == GxB_SPARSE)
         {
             (*saxpy_method) = GB_SAXPY_METHOD_3 ;
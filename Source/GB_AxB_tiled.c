@@ -0,0 +1,239 @@
+//------------------------------------------------------------------------------
+// GB_AxB_tiled: C=A*B, one pair of tiles at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GxB_TILE_SIZE is set, GB_mxm computes C=A*B, A'*B, A*B', or A'*B' with
+// no mask by splitting A and B into tiles of at most tile_size-by-tile_size
+// with GB_split.  Each tile C{i,j} is then computed by GB_mxm on its own, as
+// the sum of A{i,k}*B{k,j} over all k, accumulated with the monoid of the
+// semiring, and the tiles of C are concatenated with GB_concat.  Each product
+// touches only a block of rows and a block of columns, which fit in cache
+// even if the full dimensions of A and B do not.  A tile of A or B with no
+// entries contributes nothing, and its products are skipped.
+
+// The tiles of C are computed in parallel, each with one thread, if there are
+// at least as many of them as threads.  Otherwise, they are computed one at a
+// time, each with all threads.  The tiles of A and B are shared by the tasks,
+// so their nvec_nonempty and vector-degree summaries are cached in them
+// beforehand, and are not recomputed by each task.
+
+// The tiles of C are no larger than tile_size in either dimension, so GB_mxm
+// never tiles them again.
+
+#include "GB_mxm.h"
+#include "GB_split.h"
+#include "GB_concat.h"
+
+#define GB_FREE_WORK                                    \
+{                                                       \
+    if (Atiles != NULL)                                 \
+    {                                                   \
+        for (int64_t t = 0 ; t < ma * na ; t++)         \
+        {                                               \
+            GB_Matrix_free (&(Atiles [t])) ;            \
+        }                                               \
+    }                                                   \
+    if (Btiles != NULL)                                 \
+    {                                                   \
+        for (int64_t t = 0 ; t < mb * nb ; t++)         \
+        {                                               \
+            GB_Matrix_free (&(Btiles [t])) ;            \
+        }                                               \
+    }                                                   \
+    if (Ttiles != NULL)                                 \
+    {                                                   \
+        for (int64_t t = 0 ; t < mt * nt ; t++)         \
+        {                                               \
+            GB_Matrix_free (&(Ttiles [t])) ;            \
+        }                                               \
+    }                                                   \
+    GB_FREE_WERK (&Atiles, Atiles_size, Context) ;      \
+    GB_FREE_WERK (&Btiles, Btiles_size, Context) ;      \
+    GB_FREE_WERK (&Ttiles, Ttiles_size, Context) ;      \
+    GB_FREE_WERK (&Tile_n, Tile_n_size, Context) ;      \
+}
+
+#define GB_FREE_ALL                                     \
+{                                                       \
+    GB_FREE_WORK ;                                      \
+    GB_phbix_free (C) ;                                 \
+}
+
+GrB_Info GB_AxB_tiled               // C=A*B, one pair of tiles at a time
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const bool C_is_csc,            // desired CSR/CSC format of C
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    const int64_t tile_size,        // max dimension of each tile
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && C->static_header) ;
+    ASSERT_MATRIX_OK (A, "A for GB_AxB_tiled", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_AxB_tiled", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for GB_AxB_tiled", GB0) ;
+    ASSERT (tile_size > 0) ;
+
+    // A is split into ma-by-na tiles, B into mb-by-nb tiles, and C into
+    // mt-by-nt tiles, with kt tiles in the inner dimension of A*B
+    const int64_t anrows = GB_NROWS (A), ancols = GB_NCOLS (A) ;
+    const int64_t bnrows = GB_NROWS (B), bncols = GB_NCOLS (B) ;
+    ASSERT (anrows > 0 && ancols > 0 && bnrows > 0 && bncols > 0) ;
+    const int64_t ma = GB_ICEIL (anrows, tile_size) ;
+    const int64_t na = GB_ICEIL (ancols, tile_size) ;
+    const int64_t mb = GB_ICEIL (bnrows, tile_size) ;
+    const int64_t nb = GB_ICEIL (bncols, tile_size) ;
+    const int64_t mt = (A_transpose) ? na : ma ;
+    const int64_t kt = (A_transpose) ? ma : na ;
+    const int64_t nt = (B_transpose) ? mb : nb ;
+    ASSERT (kt == ((B_transpose) ? nb : mb)) ;
+    GrB_Matrix *Atiles = NULL, *Btiles = NULL, *Ttiles = NULL ;
+    GrB_Index *Tile_n = NULL ;
+    size_t Atiles_size = 0, Btiles_size = 0, Ttiles_size = 0, Tile_n_size = 0 ;
+
+    GBURBLE ("(tiled " GBd "-by-" GBd "-by-" GBd ") ", mt, kt, nt) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    Atiles = GB_CALLOC_WERK (ma * na, GrB_Matrix, &Atiles_size) ;
+    Btiles = GB_CALLOC_WERK (mb * nb, GrB_Matrix, &Btiles_size) ;
+    Ttiles = GB_CALLOC_WERK (mt * nt, GrB_Matrix, &Ttiles_size) ;
+    Tile_n = GB_MALLOC_WERK (ma + na + mb + nb, GrB_Index, &Tile_n_size) ;
+    if (Atiles == NULL || Btiles == NULL || Ttiles == NULL || Tile_n == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // split A and B into tiles
+    //--------------------------------------------------------------------------
+
+    GrB_Index *Tile_arows = Tile_n ;
+    GrB_Index *Tile_acols = Tile_arows + ma ;
+    GrB_Index *Tile_brows = Tile_acols + na ;
+    GrB_Index *Tile_bcols = Tile_brows + mb ;
+    GB_split_sizes (Tile_arows, ma, anrows, tile_size) ;
+    GB_split_sizes (Tile_acols, na, ancols, tile_size) ;
+    GB_split_sizes (Tile_brows, mb, bnrows, tile_size) ;
+    GB_split_sizes (Tile_bcols, nb, bncols, tile_size) ;
+    GB_OK (GB_split (Atiles, ma, na, Tile_arows, Tile_acols, A, Context)) ;
+    GB_OK (GB_split (Btiles, mb, nb, Tile_brows, Tile_bcols, B, Context)) ;
+
+    // the tiles are only read from here on, by many tasks at the same time
+    for (int64_t t = 0 ; t < ma * na + mb * nb ; t++)
+    {
+        GrB_Matrix X = (t < ma * na) ? Atiles [t] : Btiles [t - ma * na] ;
+        if (X->nvec_nonempty < 0)
+        {
+            X->nvec_nonempty = GB_nvec_nonempty (X, Context) ;
+        }
+        GB_profile_cache (X, Context) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C{i,j} = sum of A{i,k}*B{k,j} for each tile of C
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    const int64_t ntiles = mt * nt ;
+    int nthreads = (ntiles >= nthreads_max) ? nthreads_max : 1 ;
+    int nthreads_per_tile = (nthreads > 1) ? 1 : nthreads_max ;
+    const GrB_Type ztype = semiring->add->op->ztype ;
+    const GrB_BinaryOp add = semiring->add->op ;
+
+    // A{i,k} is the tile A(k,i) of A if A is transposed, and B{k,j} likewise
+    #define GB_ATILE(i,k) \
+        ((A_transpose) ? Atiles [(k)*na + (i)] : Atiles [(i)*na + (k)])
+    #define GB_BTILE(k,j) \
+        ((B_transpose) ? Btiles [(j)*nb + (k)] : Btiles [(k)*nb + (j)])
+
+    info = GrB_SUCCESS ;
+    int64_t tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntiles ; tid++)
+    {
+        const int64_t i = tid / nt ;
+        const int64_t j = tid % nt ;
+        GB_CONTEXT_TASK (Task_Context, Context, nthreads_per_tile) ;
+
+        // create the empty tile C{i,j}
+        GrB_Matrix Atile = GB_ATILE (i, 0) ;
+        GrB_Matrix Btile = GB_BTILE (0, j) ;
+        const int64_t cnrows = (A_transpose) ? GB_NCOLS (Atile) :
+            GB_NROWS (Atile) ;
+        const int64_t cncols = (B_transpose) ? GB_NROWS (Btile) :
+            GB_NCOLS (Btile) ;
+        GrB_Matrix Ctile = NULL ;
+        GrB_Info tinfo = GB_new (&Ctile, false, // auto sparsity, new header
+            ztype, C_is_csc ? cnrows : cncols, C_is_csc ? cncols : cnrows,
+            GB_Ap_calloc, C_is_csc, GxB_AUTO_SPARSITY,
+            GB_Global_hyper_switch_get ( ), 1, Task_Context) ;
+
+        // C{i,j} += A{i,k}*B{k,j}, skipping tiles with no entries
+        bool first = true ;
+        for (int64_t k = 0 ; k < kt && tinfo == GrB_SUCCESS ; k++)
+        {
+            Atile = GB_ATILE (i, k) ;
+            Btile = GB_BTILE (k, j) ;
+            if (GB_NNZ (Atile) == 0 || GB_NNZ (Btile) == 0) continue ;
+            tinfo = GB_mxm (Ctile, false, NULL, false, false,
+                (first) ? NULL : add, semiring, Atile, A_transpose,
+                Btile, B_transpose, flipxy, AxB_method, do_sort,
+                Task_Context) ;
+            first = false ;
+        }
+
+        Ttiles [tid] = Ctile ;
+        if (tinfo != GrB_SUCCESS)
+        {
+            // out of memory, or other failure; the first one is reported
+            #pragma omp critical (GB_AxB_tiled)
+            {
+                if (info == GrB_SUCCESS) info = tinfo ;
+            }
+        }
+    }
+
+    if (info != GrB_SUCCESS)
+    {
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // concatenate the tiles of C
+    //--------------------------------------------------------------------------
+
+    const int64_t cnrows = (A_transpose) ? ancols : anrows ;
+    const int64_t cncols = (B_transpose) ? bnrows : bncols ;
+    GB_OK (GB_new (&C, true, // auto sparsity, static header
+        ztype, C_is_csc ? cnrows : cncols, C_is_csc ? cncols : cnrows,
+        GB_Ap_calloc, C_is_csc, GxB_AUTO_SPARSITY,
+        GB_Global_hyper_switch_get ( ), 1, Context)) ;
+    GB_OK (GB_concat (C, Ttiles, mt, nt, Context)) ;
+    GB_FREE_WORK ;
+    ASSERT_MATRIX_OK (C, "C=A*B from GB_AxB_tiled", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -55,7 +55,10 @@ GrB_Info GB_BinaryOp_check  // check a GraphBLAS binary operator
     bool op_is_second = (opcode == GB_SECOND_opcode) ;
     bool op_is_pair   = (opcode == GB_PAIR_opcode) ;
 
-    if (!(op_is_positional || op_is_first || op_is_second)
+    // an operator from GxB_BinaryOp_new_vector has no function pointer
+    bool op_is_vector = (op->vector_opcode != GB_NOP_opcode) ;
+
+    if (!(op_is_positional || op_is_first || op_is_second || op_is_vector)
        && op->function == NULL)
     { 
         GBPR0 ("    BinaryOp has a NULL function pointer\n") ;
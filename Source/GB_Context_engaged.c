@@ -0,0 +1,280 @@
+//------------------------------------------------------------------------------
+// GB_Context_engaged: the GxB_Context engaged by the calling thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each user thread can engage at most one GxB_Context, and each GxB_Context
+// can be engaged by at most one thread at a time.  The context engaged by the
+// calling thread is held in thread-local storage, so no locks are needed to
+// access it.  Threads created inside GraphBLAS by OpenMP have no context, so
+// the getters below return the global settings for them.
+
+// The arena of a context is a single malloc'd block.  Workspace is handed out
+// from it in stack order, by the thread that engaged the context, at the
+// OpenMP nesting level where it engaged it.  That thread may itself be inside
+// a parallel region of the user application, but not inside a parallel region
+// of GraphBLAS.  A block can be freed by any thread; the arena is reset once
+// none of its blocks remain in use.  If the arena is sized automatically
+// (GxB_CONTEXT_ARENA_AUTO), it is resized at the start of each method, while
+// none of its blocks are in use, to fit the peak workspace of recent methods.
+
+#include "GB_atomics.h"
+
+static GB_THREAD_LOCAL GxB_Context GB_Context_thread = NULL ;
+
+// arena blocks are aligned to 64 bytes
+#define GB_ARENA_ALIGN 64
+
+// The high-water mark of an automatic arena decays by this factor with each
+// method, so it halves after about 14 methods that use no workspace.  The
+// arena is sized with some slack for the alignment of each block, and for the
+// holes left by blocks freed out of stack order.
+#define GB_ARENA_DECAY 0.95
+#define GB_ARENA_SLACK 1.25
+#define GB_ARENA_MIN (64 * 1024)
+
+//------------------------------------------------------------------------------
+// GB_Context_engaged: return the context engaged by the calling thread
+//------------------------------------------------------------------------------
+
+GxB_Context GB_Context_engaged (void)
+{
+    return (GB_Context_thread) ;
+}
+
+void GB_Context_engaged_set (GxB_Context context)
+{
+    if (context != NULL)
+    {
+        context->engaged_level = GB_OPENMP_GET_LEVEL ;
+    }
+    GB_Context_thread = context ;
+}
+
+//------------------------------------------------------------------------------
+// settings of the engaged context, or the global settings
+//------------------------------------------------------------------------------
+
+int GB_Context_nthreads_max_get (void)
+{
+    GxB_Context context = GB_Context_thread ;
+    if (context != NULL && context->nthreads_max > GxB_DEFAULT)
+    {
+        return (context->nthreads_max) ;
+    }
+    return (GB_Global_nthreads_max_get ( )) ;
+}
+
+double GB_Context_chunk_get (void)
+{
+    GxB_Context context = GB_Context_thread ;
+    if (context != NULL && context->chunk > GxB_DEFAULT)
+    {
+        return (context->chunk) ;
+    }
+    return (GB_Global_chunk_get ( )) ;
+}
+
+int64_t GB_Context_memory_budget_get (void)
+{
+    GxB_Context context = GB_Context_thread ;
+    if (context != NULL && context->memory_budget > 0)
+    {
+        return (context->memory_budget) ;
+    }
+    return (GB_Global_memory_budget_get ( )) ;
+}
+
+bool GB_Context_burble_get (void)
+{
+    GxB_Context context = GB_Context_thread ;
+    if (context != NULL && context->burble >= 0)
+    {
+        return (context->burble != 0) ;
+    }
+    return (GB_Global_burble_get ( )) ;
+}
+
+GB_printf_function_t GB_Context_printf_get (void)
+{
+    GxB_Context context = GB_Context_thread ;
+    if (context != NULL && context->printf_func != NULL)
+    {
+        return (context->printf_func) ;
+    }
+    return (GB_Global_printf_get ( )) ;
+}
+
+GB_flush_function_t GB_Context_flush_get (void)
+{
+    GxB_Context context = GB_Context_thread ;
+    if (context != NULL && context->flush_func != NULL)
+    {
+        return (context->flush_func) ;
+    }
+    return (GB_Global_flush_get ( )) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Context_arena_malloc: allocate workspace from the arena, if it fits
+//------------------------------------------------------------------------------
+
+void *GB_Context_arena_malloc   // return NULL if the block does not fit
+(
+    GxB_Context context,
+    size_t nbytes,
+    size_t *size_allocated
+)
+{
+
+    if (context == NULL || context->arena == NULL
+        || context != GB_Context_thread)
+    {
+        // no arena, or not the thread that engaged the context
+        return (NULL) ;
+    }
+    if (GB_OPENMP_GET_LEVEL != context->engaged_level)
+    {
+        // the arena is not used inside a parallel region of GraphBLAS
+        return (NULL) ;
+    }
+
+    if (context->arena_nblocks <= 0)
+    {
+        // no blocks are in use: reset the arena
+        context->arena_nblocks = 0 ;
+        context->arena_top = 0 ;
+    }
+
+    size_t size = ((nbytes + GB_ARENA_ALIGN - 1) / GB_ARENA_ALIGN)
+        * GB_ARENA_ALIGN ;
+    size_t top = context->arena_top ;
+    if (size < nbytes || size > context->arena_size - top)
+    {
+        // the block does not fit
+        return (NULL) ;
+    }
+    context->arena_top = top + size ;
+    context->arena_nblocks++ ;
+    (*size_allocated) = size ;
+    return ((void *) (context->arena + top)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Context_arena_owns: true if p is in the arena
+//------------------------------------------------------------------------------
+
+bool GB_Context_arena_owns (GxB_Context context, void *p)
+{
+    return (context != NULL && context->arena != NULL
+        && (GB_void *) p >= context->arena
+        && (GB_void *) p <  context->arena + context->arena_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Context_arena_free: free a block of the arena
+//------------------------------------------------------------------------------
+
+bool GB_Context_arena_free  // return false if p is not in the arena
+(
+    GxB_Context context,
+    void *p,
+    size_t size_allocated
+)
+{
+
+    if (!GB_Context_arena_owns (context, p))
+    {
+        return (false) ;
+    }
+
+    if (context != GB_Context_thread
+        || GB_OPENMP_GET_LEVEL != context->engaged_level)
+    {
+        // freed by a worker thread: only count the block
+        GB_ATOMIC_UPDATE
+        context->arena_nblocks-- ;
+        return (true) ;
+    }
+
+    // pop the block if it is on top of the stack
+    GB_void *block = (GB_void *) p ;
+    if (block + size_allocated == context->arena + context->arena_top)
+    {
+        context->arena_top -= size_allocated ;
+    }
+    context->arena_nblocks-- ;
+    if (context->arena_nblocks <= 0)
+    {
+        // no blocks are in use: reset the arena
+        context->arena_nblocks = 0 ;
+        context->arena_top = 0 ;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Context_arena_resize: size an automatic arena to the recent workspace
+//------------------------------------------------------------------------------
+
+// This is called at the start of each method, by GB_CONTEXT.  The arena is
+// grown if the peak workspace of a recent method did not fit in it, and it
+// is shrunk if it is more than twice the size needed.  If the new arena
+// cannot be allocated, the context is left with no arena, and the workspace
+// is taken from malloc instead.
+
+void GB_Context_arena_resize
+(
+    GxB_Context context
+)
+{
+
+    if (context == NULL || !context->arena_auto
+        || context != GB_Context_thread || context->arena_nblocks > 0)
+    { 
+        // no automatic arena, or the arena is in use
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // update the high-water mark of the workspace
+    //--------------------------------------------------------------------------
+
+    double hwm = GB_IMAX ((double) context->arena_peak,
+        context->arena_hwm * GB_ARENA_DECAY) ;
+    context->arena_hwm = hwm ;
+    context->arena_peak = 0 ;
+    size_t need = (size_t) (hwm * GB_ARENA_SLACK) ;
+    need = (need < GB_ARENA_MIN) ? 0 : need ;
+    size_t arena_size = context->arena_size ;
+    if (need <= arena_size && arena_size <= 2 * need)
+    { 
+        // the arena is large enough, and not too large
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // replace the arena
+    //--------------------------------------------------------------------------
+
+    GB_free_counted (GB_MEMORY_WORKSPACE, (void **) &(context->arena),
+        context->arena_size) ;
+    context->arena_size = 0 ;
+    context->arena_top = 0 ;
+    context->arena_nblocks = 0 ;
+    if (need > 0)
+    {
+        size_t size ;
+        context->arena = GB_malloc_counted (GB_MEMORY_WORKSPACE, need,
+            sizeof (GB_void), &size) ;
+        if (context->arena != NULL)
+        { 
+            context->arena_size = size ;
+        }
+    }
+}
+
@@ -177,9 +177,16 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
     }
 
     // The number of threads is copied from the descriptor into the Context, so
-    // it is available to any internal function that needs it.
-    Context->nthreads_max = nthreads_desc ;
-    Context->chunk = chunk_desc ;
+    // it is available to any internal function that needs it.  A default
+    // descriptor setting keeps the value from the engaged GxB_Context, if any.
+    if (nthreads_desc > GxB_DEFAULT)
+    { 
+        Context->nthreads_max = nthreads_desc ;
+    }
+    if (chunk_desc > GxB_DEFAULT)
+    { 
+        Context->chunk = chunk_desc ;
+    }
 
     return (GrB_SUCCESS) ;
 }
@@ -104,6 +104,55 @@ typedef struct
     GB_printf_function_t printf_func ;  // pointer to printf
     GB_flush_function_t flush_func ;   // pointer to flush
 
+    //--------------------------------------------------------------------------
+    // thread budget
+    //--------------------------------------------------------------------------
+
+    int thread_budget ;             // max # of threads of all user threads
+    int64_t threads_leased ;        // # of threads leased by all user threads
+
+    //--------------------------------------------------------------------------
+    // load balancing
+    //--------------------------------------------------------------------------
+
+    GxB_Load_Balance_Value load_balance ;   // task slicing for GrB_mxm
+
+    //--------------------------------------------------------------------------
+    // NUMA placement
+    //--------------------------------------------------------------------------
+
+    GxB_NUMA_Policy_Value numa_policy ;     // placement of large blocks
+
+    //--------------------------------------------------------------------------
+    // huge pages
+    //--------------------------------------------------------------------------
+
+    int64_t huge_page ;             // min size of blocks to back with huge
+                                    // pages, or 0 if none
+
+    //--------------------------------------------------------------------------
+    // memory budget
+    //--------------------------------------------------------------------------
+
+    int64_t memory_budget ;         // max workspace per method, or 0
+
+    //--------------------------------------------------------------------------
+    // tiled mxm and transpose
+    //--------------------------------------------------------------------------
+
+    int64_t tile_size ;             // max dimension of each tile, or 0
+
+    //--------------------------------------------------------------------------
+    // memory usage
+    //--------------------------------------------------------------------------
+
+    // memory_inuse [kind] is the # of bytes held, for matrix storage (kind is
+    // GB_MEMORY_STORAGE) and for workspace (GB_MEMORY_WORKSPACE), and
+    // memory_peak [kind] is its high-water mark.  See GB_memory.h.
+
+    int64_t memory_inuse [GB_MEMORY_NKINDS] ;
+    int64_t memory_peak  [GB_MEMORY_NKINDS] ;
+
     //--------------------------------------------------------------------------
     // for MATLAB interface only
     //--------------------------------------------------------------------------
@@ -218,6 +267,29 @@ GB_Global_struct GB_Global =
     .printf_func = NULL,
     .flush_func = NULL,
 
+    // thread budget
+    .thread_budget = 0,
+    .threads_leased = 0,
+
+    // load balancing
+    .load_balance = GxB_LOAD_BALANCE_STATIC,
+
+    // NUMA placement
+    .numa_policy = GxB_NUMA_DEFAULT,
+
+    // huge pages
+    .huge_page = 0,
+
+    // memory budget
+    .memory_budget = 0,
+
+    // tiled mxm and transpose
+    .tile_size = 0,
+
+    // memory usage
+    .memory_inuse = { 0, 0 },
+    .memory_peak  = { 0, 0 },
+
     // for MATLAB interface only
     .print_one_based = false,   // if true, print 1-based indices
 
@@ -956,6 +1028,173 @@ void GB_Global_flush_set (GB_flush_function_t fl_func)
     GB_Global.flush_func = fl_func ;
 }
 
+//------------------------------------------------------------------------------
+// thread budget
+//------------------------------------------------------------------------------
+
+void GB_Global_thread_budget_set (int thread_budget)
+{ 
+    GB_Global.thread_budget = GB_IMAX (thread_budget, 0) ;
+}
+
+int GB_Global_thread_budget_get (void)
+{ 
+    return (GB_Global.thread_budget) ;
+}
+
+void GB_Global_threads_leased_add (int64_t delta)
+{ 
+    GB_ATOMIC_UPDATE
+    GB_Global.threads_leased += delta ;
+}
+
+GB_PUBLIC
+int64_t GB_Global_threads_leased_get (void)
+{ 
+    int64_t threads_leased ;
+    GB_ATOMIC_READ
+    threads_leased = GB_Global.threads_leased ;
+    return (threads_leased) ;
+}
+
+//------------------------------------------------------------------------------
+// load balancing
+//------------------------------------------------------------------------------
+
+void GB_Global_load_balance_set (GxB_Load_Balance_Value load_balance)
+{ 
+    GB_Global.load_balance = load_balance ;
+}
+
+GxB_Load_Balance_Value GB_Global_load_balance_get (void)
+{ 
+    return (GB_Global.load_balance) ;
+}
+
+//------------------------------------------------------------------------------
+// NUMA placement
+//------------------------------------------------------------------------------
+
+void GB_Global_numa_policy_set (GxB_NUMA_Policy_Value numa_policy)
+{ 
+    GB_Global.numa_policy = numa_policy ;
+}
+
+GxB_NUMA_Policy_Value GB_Global_numa_policy_get (void)
+{ 
+    return (GB_Global.numa_policy) ;
+}
+
+//------------------------------------------------------------------------------
+// huge pages
+//------------------------------------------------------------------------------
+
+void GB_Global_huge_page_set (int64_t huge_page)
+{ 
+    GB_Global.huge_page = huge_page ;
+}
+
+int64_t GB_Global_huge_page_get (void)
+{ 
+    return (GB_Global.huge_page) ;
+}
+
+//------------------------------------------------------------------------------
+// memory budget
+//------------------------------------------------------------------------------
+
+void GB_Global_memory_budget_set (int64_t memory_budget)
+{ 
+    GB_Global.memory_budget = memory_budget ;
+}
+
+int64_t GB_Global_memory_budget_get (void)
+{ 
+    return (GB_Global.memory_budget) ;
+}
+
+//------------------------------------------------------------------------------
+// tiled mxm and transpose
+//------------------------------------------------------------------------------
+
+void GB_Global_tile_size_set (int64_t tile_size)
+{ 
+    GB_Global.tile_size = tile_size ;
+}
+
+int64_t GB_Global_tile_size_get (void)
+{ 
+    return (GB_Global.tile_size) ;
+}
+
+//------------------------------------------------------------------------------
+// memory usage
+//------------------------------------------------------------------------------
+
+void GB_Global_memory_inuse_add (int kind, int64_t delta)
+{
+    int64_t inuse ;
+    #if GB_MICROSOFT
+    inuse = _InterlockedExchangeAdd64
+        ((int64_t volatile *) (&(GB_Global.memory_inuse [kind])), delta)
+        + delta ;
+    #else
+    GB_ATOMIC_CAPTURE
+    {
+        GB_Global.memory_inuse [kind] += delta ;
+        inuse = GB_Global.memory_inuse [kind] ;
+    }
+    #endif
+    if (delta > 0)
+    {
+        int64_t peak ;
+        GB_ATOMIC_READ
+        peak = GB_Global.memory_peak [kind] ;
+        if (inuse > peak)
+        { 
+            // a new peak; check it again in a critical section, since
+            // another thread may have raised it in the meantime
+            #pragma omp critical(GB_memory_peak)
+            {
+                GB_Global.memory_peak [kind] =
+                    GB_IMAX (GB_Global.memory_peak [kind], inuse) ;
+            }
+        }
+    }
+}
+
+GB_PUBLIC
+int64_t GB_Global_memory_inuse_get (int kind)
+{ 
+    int64_t inuse ;
+    GB_ATOMIC_READ
+    inuse = GB_Global.memory_inuse [kind] ;
+    return (inuse) ;
+}
+
+GB_PUBLIC
+int64_t GB_Global_memory_peak_get (int kind)
+{ 
+    int64_t peak ;
+    #pragma omp critical(GB_memory_peak)
+    {
+        peak = GB_Global.memory_peak [kind] ;
+    }
+    return (peak) ;
+}
+
+void GB_Global_memory_peak_reset (void)
+{ 
+    #pragma omp critical(GB_memory_peak)
+    {
+        for (int kind = 0 ; kind < GB_MEMORY_NKINDS ; kind++)
+        {
+            GB_Global.memory_peak [kind] =
+                GB_Global_memory_inuse_get (kind) ;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 // for MATLAB interface only
 //------------------------------------------------------------------------------
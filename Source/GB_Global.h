@@ -88,6 +88,36 @@ GB_PUBLIC int64_t  GB_Global_hack_get (int k) ;
           void     GB_Global_burble_set (bool burble) ;
 GB_PUBLIC bool     GB_Global_burble_get (void) ;
 
+          void     GB_Global_thread_budget_set (int thread_budget) ;
+          int      GB_Global_thread_budget_get (void) ;
+          void     GB_Global_threads_leased_add (int64_t delta) ;
+GB_PUBLIC int64_t  GB_Global_threads_leased_get (void) ;
+
+          void     GB_Global_load_balance_set
+                    (GxB_Load_Balance_Value load_balance) ;
+          GxB_Load_Balance_Value GB_Global_load_balance_get (void) ;
+
+          void     GB_Global_numa_policy_set
+                    (GxB_NUMA_Policy_Value numa_policy) ;
+          GxB_NUMA_Policy_Value GB_Global_numa_policy_get (void) ;
+
+          void     GB_Global_huge_page_set (int64_t huge_page) ;
+          int64_t  GB_Global_huge_page_get (void) ;
+
+          void     GB_Global_memory_budget_set (int64_t memory_budget) ;
+          int64_t  GB_Global_memory_budget_get (void) ;
+
+          void     GB_Global_tile_size_set (int64_t tile_size) ;
+          int64_t  GB_Global_tile_size_get (void) ;
+
+#define GB_MEMORY_STORAGE   0   // kinds of memory counted by GB_Global
+#define GB_MEMORY_WORKSPACE 1
+#define GB_MEMORY_NKINDS    2
+          void     GB_Global_memory_inuse_add (int kind, int64_t delta) ;
+GB_PUBLIC int64_t  GB_Global_memory_inuse_get (int kind) ;
+GB_PUBLIC int64_t  GB_Global_memory_peak_get (int kind) ;
+          void     GB_Global_memory_peak_reset (void) ;
+
 GB_PUBLIC void     GB_Global_print_one_based_set (bool onebased) ;
 GB_PUBLIC bool     GB_Global_print_one_based_get (void) ;
 
@@ -140,5 +170,11 @@ GB_PUBLIC void     GB_Global_printf_set (GB_printf_function_t p) ;
 GB_PUBLIC GB_flush_function_t GB_Global_flush_get (void) ;
 GB_PUBLIC void     GB_Global_flush_set (GB_flush_function_t p) ;
 
+// burble settings of the GxB_Context engaged by the calling thread, or the
+// global settings if it has none (see GB_Context_engaged.c)
+GB_PUBLIC bool     GB_Context_burble_get (void) ;
+GB_PUBLIC GB_printf_function_t GB_Context_printf_get (void) ;
+GB_PUBLIC GB_flush_function_t GB_Context_flush_get (void) ;
+
 #endif
 
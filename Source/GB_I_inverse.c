@@ -55,8 +55,8 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
     if (Inext == NULL || Mark == NULL)
     { 
         // out of memory
-        GB_FREE_WERK (&Mark, Mark_size) ;
-        GB_FREE_WERK (&Inext, Inext_size) ;
+        GB_FREE_WERK (&Mark, Mark_size, Context) ;
+        GB_FREE_WERK (&Inext, Inext_size, Context) ;
         return (GrB_OUT_OF_MEMORY) ;
     }
 
@@ -8,7 +8,7 @@
 //------------------------------------------------------------------------------
 
 #define GB_FREE_WORK                        \
-    GB_FREE_WERK (&Tx, Tx_size) ;
+    GB_FREE_WERK (&Tx, Tx_size, Context) ;
 
 #define GB_FREE_ALL                         \
     GB_FREE_WORK ;                          \
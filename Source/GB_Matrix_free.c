@@ -30,6 +30,7 @@ void GB_Matrix_free             // free a matrix
             if (!(A->static_header))
             { 
                 // free the header of A itself, unless it is static
+                GB_stats_free (&(A->stats)) ;
                 A->magic = GB_FREED ;       // to help detect dangling pointers
                 GB_FREE (Ahandle, header_size) ;
                 (*Ahandle) = NULL ;
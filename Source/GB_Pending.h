@@ -36,6 +36,13 @@ void GB_Pending_free        // free a list of pending tuples
     GB_Pending *PHandle
 ) ;
 
+int64_t GB_Pending_lookup       // find the last pending tuple A(i,j)
+(
+    const GB_Pending Pending,   // list of pending tuples
+    const int64_t i,            // index into vector
+    const int64_t j             // vector index
+) ;
+
 //------------------------------------------------------------------------------
 // GB_Pending_ensure: make sure the list of pending tuples is large enough
 //------------------------------------------------------------------------------
@@ -166,6 +173,29 @@ static inline bool GB_Pending_add   // add a tuple to the list
     ilast = iC ;                                                            \
     jlast = jC ;
 
+//------------------------------------------------------------------------------
+// GB_Pending_searchable: see if an entry can be found in the pending tuples
+//------------------------------------------------------------------------------
+
+// A single entry A(i,j) can be found in the pending tuples of A, instead of
+// assembling them with GB_Matrix_wait, if there is no operator for assembling
+// duplicates (so the most recent tuple has the value of A(i,j)), and if the
+// search is fast: a binary search if the tuples are sorted, or a linear
+// search if the list is short.  Otherwise the pending tuples should be
+// assembled, so the cost of the linear search is not repeated for each entry.
+
+#define GB_PENDING_SEARCH_MAX 256
+
+static inline bool GB_Pending_searchable
+(
+    GrB_Matrix A
+)
+{ 
+    GB_Pending Pending = A->Pending ;
+    return (Pending == NULL || (Pending->op == NULL &&
+        (Pending->sorted || Pending->n <= GB_PENDING_SEARCH_MAX))) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_shall_block: see if the matrix should be finished
 //------------------------------------------------------------------------------
@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+// GB_Pending_lookup: find a pending tuple A(i,j)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Returns the position of the last pending tuple with index (i,j) in the list
+// of pending tuples, or -1 if A(i,j) does not appear in the list.  If
+// Pending->op is NULL, the last tuple is the value A(i,j) will have when the
+// pending tuples are assembled.  If the tuples are sorted, a binary search is
+// used; otherwise the list is searched from the end, in O(Pending->n) time.
+// See GB_Pending_searchable, which determines if this function should be used
+// instead of assembling the pending tuples with GB_Matrix_wait.
+
+#include "GB_Pending.h"
+
+int64_t GB_Pending_lookup       // find the last pending tuple A(i,j)
+(
+    const GB_Pending Pending,   // list of pending tuples
+    const int64_t i,            // index into vector
+    const int64_t j             // vector index
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (Pending == NULL || Pending->n == 0)
+    { 
+        return (-1) ;
+    }
+
+    const int64_t *restrict Pending_i = Pending->i ;
+    const int64_t *restrict Pending_j = Pending->j ;
+    const int64_t n = Pending->n ;
+
+    //--------------------------------------------------------------------------
+    // search the list of pending tuples
+    //--------------------------------------------------------------------------
+
+    if (Pending->sorted)
+    {
+
+        //----------------------------------------------------------------------
+        // binary search for the last tuple (i,j) in the sorted list
+        //----------------------------------------------------------------------
+
+        // find the first p with (Pending_j [p], Pending_i [p]) > (j,i)
+        int64_t pleft = 0, pright = n ;
+        while (pleft < pright)
+        {
+            int64_t pmiddle = (pleft + pright) / 2 ;
+            int64_t jp = (Pending_j == NULL) ? 0 : Pending_j [pmiddle] ;
+            int64_t ip = Pending_i [pmiddle] ;
+            if (jp < j || (jp == j && ip <= i))
+            { 
+                pleft = pmiddle + 1 ;
+            }
+            else
+            { 
+                pright = pmiddle ;
+            }
+        }
+        int64_t p = pleft - 1 ;
+        if (p >= 0 && Pending_i [p] == i &&
+            (Pending_j == NULL || Pending_j [p] == j))
+        { 
+            return (p) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // linear search, starting with the most recent tuple
+        //----------------------------------------------------------------------
+
+        for (int64_t p = n-1 ; p >= 0 ; p--)
+        {
+            if (Pending_i [p] == i &&
+                (Pending_j == NULL || Pending_j [p] == j))
+            { 
+                return (p) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // A(i,j) is not in the list of pending tuples
+    //--------------------------------------------------------------------------
+
+    return (-1) ;
+}
@@ -54,11 +54,18 @@ GxB_Scalar GB_Scalar_wrap   // create a new GxB_Scalar with one entry
     s->nvals = 0 ;
 
     s->Pending = NULL ;
+    s->shared = NULL ;
+    s->deferred_op = NULL ;
+    s->deferred_type = NULL ;
     s->nzombies = 0 ;
 
     s->hyper_switch  = GxB_NEVER_HYPER ;
     s->bitmap_switch = 0.5 ;
     s->sparsity = GxB_FULL ;
+    s->conform_damping = 0 ;
+    s->conform_stable = 0 ;
+    s->stats = NULL ;
+    s->profile.valid = false ;
 
     s->static_header = true ;
 
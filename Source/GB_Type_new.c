@@ -62,6 +62,8 @@ GrB_Info GB_Type_new
     t->size = GB_IMAX (sizeof_ctype, 1) ;
     t->code = GB_UDT_code ;     // user-defined type
     t->name [0] = '\0' ;
+    t->etype = NULL ;           // not a vector type (see GxB_Type_new_vector)
+    t->veclen = 0 ;
 
     //--------------------------------------------------------------------------
     // get the name
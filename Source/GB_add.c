@@ -82,10 +82,9 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
 
-    // TODO: some cases can allow M, A, and/or B to be jumbled
-    GB_MATRIX_WAIT (M) ;        // cannot be jumbled
-    GB_MATRIX_WAIT (A) ;        // cannot be jumbled
-    GB_MATRIX_WAIT (B) ;        // cannot be jumbled
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (M) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (B) ;
 
     //--------------------------------------------------------------------------
     // determine the sparsity of C
@@ -94,6 +93,20 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     bool apply_mask ;
     int C_sparsity = GB_add_sparsity (&apply_mask, M, Mask_comp, A, B) ;
 
+    if ((C_sparsity == GxB_SPARSE || C_sparsity == GxB_HYPERSPARSE) &&
+        (GB_JUMBLED (M) || GB_JUMBLED (A) || GB_JUMBLED (B)))
+    { 
+        // If C is bitmap or full, the sparse inputs are scattered into C, and
+        // can be jumbled.  Otherwise, their patterns are merged, and must be
+        // sorted.  A matrix with all entries present is not treated as full
+        // by GB_add_sparsity while it is jumbled, so determine the sparsity
+        // of C again once the inputs are sorted.
+        GB_MATRIX_WAIT (M) ;
+        GB_MATRIX_WAIT (A) ;
+        GB_MATRIX_WAIT (B) ;
+        C_sparsity = GB_add_sparsity (&apply_mask, M, Mask_comp, A, B) ;
+    }
+
     //--------------------------------------------------------------------------
     // initializations
     //--------------------------------------------------------------------------
@@ -155,9 +168,9 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
         { 
             // out of memory; free everything allocated by GB_add_phase0
             GB_FREE (&Ch, Ch_size) ;
-            GB_FREE_WERK (&C_to_M, C_to_M_size) ;
-            GB_FREE_WERK (&C_to_A, C_to_A_size) ;
-            GB_FREE_WERK (&C_to_B, C_to_B_size) ;
+            GB_FREE_WERK (&C_to_M, C_to_M_size, Context) ;
+            GB_FREE_WERK (&C_to_A, C_to_A_size, Context) ;
+            GB_FREE_WERK (&C_to_B, C_to_B_size, Context) ;
             return (info) ;
         }
 
@@ -174,11 +187,11 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
         if (info != GrB_SUCCESS)
         { 
             // out of memory; free everything allocated by GB_add_phase0
-            GB_FREE_WERK (&TaskList, TaskList_size) ;
+            GB_FREE_WERK (&TaskList, TaskList_size, Context) ;
             GB_FREE (&Ch, Ch_size) ;
-            GB_FREE_WERK (&C_to_M, C_to_M_size) ;
-            GB_FREE_WERK (&C_to_A, C_to_A_size) ;
-            GB_FREE_WERK (&C_to_B, C_to_B_size) ;
+            GB_FREE_WERK (&C_to_M, C_to_M_size, Context) ;
+            GB_FREE_WERK (&C_to_A, C_to_A_size, Context) ;
+            GB_FREE_WERK (&C_to_B, C_to_B_size, Context) ;
             return (info) ;
         }
 
@@ -217,10 +230,10 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
     // If the method failed, Cp and Ch have already been freed.
 
     // free workspace
-    GB_FREE_WERK (&TaskList, TaskList_size) ;
-    GB_FREE_WERK (&C_to_M, C_to_M_size) ;
-    GB_FREE_WERK (&C_to_A, C_to_A_size) ;
-    GB_FREE_WERK (&C_to_B, C_to_B_size) ;
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;
+    GB_FREE_WERK (&C_to_M, C_to_M_size, Context) ;
+    GB_FREE_WERK (&C_to_A, C_to_A_size, Context) ;
+    GB_FREE_WERK (&C_to_B, C_to_B_size, Context) ;
 
     if (info != GrB_SUCCESS)
     { 
@@ -95,9 +95,10 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
     ASSERT_MATRIX_OK_OR_NULL (M, "M for add phase2", GB0) ;
     ASSERT (A->vdim == B->vdim) ;
 
-    ASSERT (!GB_JUMBLED (M)) ;
-    ASSERT (!GB_JUMBLED (A)) ;
-    ASSERT (!GB_JUMBLED (B)) ;
+    // M, A, and B can be jumbled only if C is bitmap or full
+    ASSERT (GB_IMPLIES (C_sparsity == GxB_SPARSE ||
+        C_sparsity == GxB_HYPERSPARSE,
+        !GB_JUMBLED (M) && !GB_JUMBLED (A) && !GB_JUMBLED (B))) ;
 
     GB_WERK_DECLARE (M_ek_slicing, int64_t) ;
     GB_WERK_DECLARE (A_ek_slicing, int64_t) ;
@@ -262,6 +263,7 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
 // TODO:: use GB_ewise_generic
 
         GxB_binary_function fadd ;
+        GB_BINOP_VECTOR (fadd, op) ;    // for an op on vector-valued entries
         size_t csize, asize, bsize, xsize, ysize, zsize ;
         GB_cast_function cast_A_to_C, cast_B_to_C ;
         GB_cast_function cast_A_to_X, cast_B_to_Y, cast_Z_to_C ;
@@ -431,10 +433,10 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
             // C(i,j) = (ctype) (A(i,j) + B(i,j))
             // not used if op is null
             #undef  GB_BINOP
-            #define GB_BINOP(cij, aij, bij, i, j)   \
-                ASSERT (op != NULL) ;               \
-                GB_void z [GB_VLA(zsize)] ;         \
-                fadd (z, aij, bij) ;                \
+            #define GB_BINOP(cij, aij, bij, i, j)       \
+                ASSERT (op != NULL) ;                   \
+                GB_void z [GB_VLA(zsize)] ;             \
+                GB_BINOP_CALL (fadd, z, aij, bij) ;     \
                 cast_Z_to_C (cij, z, csize) ;
 
             #include "GB_add_template.c"
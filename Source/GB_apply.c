@@ -281,6 +281,32 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         }
         return (info) ;
     }
+    else if (M == NULL && accum == NULL && (C != A) && C->type == T_type
+        && op1 != NULL && !GB_OPCODE_IS_POSITIONAL (opcode)
+        && GB_Global_mode_get ( ) == GrB_NONBLOCKING
+        && !GB_ANY_PENDING_WORK (A) && (C->sparsity & GB_sparsity (A)) != 0
+        && GB_SHAREABLE (A))
+    {
+        // C = op (A), deferred.  C shares the content of A, in O(1) time.
+        // A is a read-only input, so this is done only if its content can be
+        // shared without copying any of it, or changing any pointer in A.
+        // The op is applied when C is first read or modified (see
+        // GB_deferred_finish), or it is fused with the method that reads C.
+        // If A is a temporary that is freed before then, the op is applied
+        // in-place and no copy of A->x is made.
+        GBURBLE ("(deferred-op) ") ;
+        GB_ph_free (C) ;
+        GB_bix_free (C) ;
+        ASSERT (C->shared == NULL) ;
+        GB_OK (GB_share (C, A, Context)) ;
+        if (opcode != GB_IDENTITY_opcode || A->type != T_type)
+        { 
+            C->deferred_op = op1 ;
+            C->deferred_type = A->type ;
+        }
+        ASSERT_MATRIX_OK (C, "C deferred output for GB_apply", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
     else
     { 
         // T = op (A), pattern is a shallow copy of A, type is op*->ztype.
@@ -383,6 +383,7 @@ GrB_Info GB_apply_op                // apply a unary operator, Cx = op (A)
         GB_BURBLE_N (anz, "(generic apply: %s) ", op2->name) ;
         GB_Type_code acode = Atype->code ;
         GxB_binary_function fop = op2->function ;
+        GB_BINOP_VECTOR (fop, op2) ;    // for an op on vector-valued entries
 
         if (binop_bind1st)
         {
@@ -397,7 +398,7 @@ GrB_Info GB_apply_op                // apply a unary operator, Cx = op (A)
                 GB_void ywork [GB_VLA(ysize)] ;
                 cast_A_to_Y (ywork, Ax +(p*asize), asize) ;
                 // Cx [p] = fop (xwork, ywork)
-                fop (Cx +(p*zsize), scalarx, ywork) ;
+                GB_BINOP_CALL (fop, Cx +(p*zsize), scalarx, ywork) ;
             }
         }
         else
@@ -413,7 +414,7 @@ GrB_Info GB_apply_op                // apply a unary operator, Cx = op (A)
                 GB_void xwork [GB_VLA(xsize)] ;
                 cast_A_to_X (xwork, Ax +(p*asize), asize) ;
                 // Cx [p] = fop (xwork, ywork)
-                fop (Cx +(p*zsize), xwork, scalarx) ;
+                GB_BINOP_CALL (fop, Cx +(p*zsize), xwork, scalarx) ;
             }
         }
     }
@@ -30,14 +30,14 @@
 #include "GB_subref.h"
 #include "GB_bitmap_assign.h"
 
-#define GB_FREE_ALL                 \
-{                                   \
-    GB_phbix_free (C2) ;          \
-    GB_phbix_free (M2) ;          \
-    GB_phbix_free (A2) ;          \
-    GB_phbix_free (SubMask) ;     \
-    GB_FREE_WERK (&I2, I2_size) ;   \
-    GB_FREE_WERK (&J2, J2_size) ;   \
+#define GB_FREE_ALL                          \
+{                                            \
+    GB_phbix_free (C2) ;                     \
+    GB_phbix_free (M2) ;                     \
+    GB_phbix_free (A2) ;                     \
+    GB_phbix_free (SubMask) ;                \
+    GB_FREE_WERK (&I2, I2_size, Context) ;   \
+    GB_FREE_WERK (&J2, J2_size, Context) ;   \
 }
 
 GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
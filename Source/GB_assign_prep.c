@@ -18,17 +18,17 @@
 #include "GB_subref.h"
 
 #undef  GB_FREE_ALL
-#define GB_FREE_ALL                 \
-{                                   \
-    GB_Matrix_free (&C2) ;          \
-    GB_Matrix_free (&A2) ;          \
-    GB_Matrix_free (&AT) ;          \
-    GB_Matrix_free (&M2) ;          \
-    GB_Matrix_free (&MT) ;          \
-    GB_FREE_WERK (&I2, I2_size) ;   \
-    GB_FREE_WERK (&J2, J2_size) ;   \
-    GB_FREE_WERK (&I2k, I2k_size) ; \
-    GB_FREE_WERK (&J2k, J2k_size) ; \
+#define GB_FREE_ALL                          \
+{                                            \
+    GB_Matrix_free (&C2) ;                   \
+    GB_Matrix_free (&A2) ;                   \
+    GB_Matrix_free (&AT) ;                   \
+    GB_Matrix_free (&M2) ;                   \
+    GB_Matrix_free (&MT) ;                   \
+    GB_FREE_WERK (&I2, I2_size, Context) ;   \
+    GB_FREE_WERK (&J2, J2_size, Context) ;   \
+    GB_FREE_WERK (&I2k, I2k_size, Context) ; \
+    GB_FREE_WERK (&J2k, J2k_size, Context) ; \
 }
 
 GrB_Info GB_assign_prep
@@ -866,8 +866,8 @@ GrB_Info GB_assign_prep
             M = M2 ;
         }
 
-        GB_FREE_WERK (&I2k, I2k_size) ;
-        GB_FREE_WERK (&J2k, J2k_size) ;
+        GB_FREE_WERK (&I2k, I2k_size, Context) ;
+        GB_FREE_WERK (&J2k, J2k_size, Context) ;
     }
 
     // I and J are now sorted, with no duplicate entries.  They are either
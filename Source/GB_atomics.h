@@ -332,6 +332,36 @@
 
     #endif
 
+    //--------------------------------------------------------------------------
+    // atomic post-decrement
+    //--------------------------------------------------------------------------
+
+    // Decrement an int64_t value and return the value prior to being
+    // decremented:
+    //
+    //      int64_t result = target-- ;
+    //
+    // The MS Visual Studio version computes result = --target, so result must
+    // be incremented by one.
+
+    #if GB_MICROSOFT
+
+        #define GB_ATOMIC_CAPTURE_DEC64(result,target)                  \
+        {                                                               \
+            result = _InterlockedDecrement64                            \
+                ((int64_t volatile *) (&(target))) + 1 ;                \
+        }
+
+    #else
+
+        #define GB_ATOMIC_CAPTURE_DEC64(result,target)                  \
+        {                                                               \
+            GB_ATOMIC_CAPTURE                                           \
+            result = (target)-- ;                                       \
+        }
+
+    #endif
+
 //------------------------------------------------------------------------------
 // atomic compare-and-exchange
 //------------------------------------------------------------------------------
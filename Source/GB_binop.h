@@ -65,5 +65,87 @@ GrB_Monoid *GB_binop_to_monoid      // return the corresponding monoid, or NULL
     const GrB_BinaryOp op_in        // binary op to convert
 ) ;
 
+//------------------------------------------------------------------------------
+// operators on vector-valued entries
+//------------------------------------------------------------------------------
+
+// An operator created by GxB_BinaryOp_new_vector has no function pointer.
+// Its entries are k float or double values, where k is only known at run
+// time, so every kernel that calls the function of a user-defined operator
+// computes z = op (x,y) with GB_BINOP_CALL instead.  GB_BINOP_VECTOR (f, op)
+// declares the variables that GB_BINOP_CALL (f, z, x, y) needs, for the
+// function f of the operator op (which may be NULL).  For any other operator,
+// GB_BINOP_CALL (f, z, x, y) is just f (z, x, y).
+
+// MIN and MAX have the same 'omitnan' behavior as the built-in operators
+// (fmin and fmax), but are written as comparisons so that they vectorize
+#define GB_VECTOR_MIN(x,y) (((x) < (y) || (y) != (y)) ? (x) : (y))
+#define GB_VECTOR_MAX(x,y) (((x) > (y) || (y) != (y)) ? (x) : (y))
+
+#define GB_VECTOR_LOOP(T,z_equals)                                          \
+{                                                                           \
+    T *zt = (T *) z ;                                                       \
+    const T *xt = (const T *) x ;                                           \
+    const T *yt = (const T *) y ;                                           \
+    (void) xt ; (void) yt ;     /* one is unused by FIRST and SECOND */     \
+    GB_PRAGMA_SIMD                                                          \
+    for (int t = 0 ; t < k ; t++)                                           \
+    {                                                                       \
+        zt [t] = z_equals ;                                                 \
+    }                                                                       \
+}
+
+#define GB_VECTOR_SWITCH(T)                                                 \
+    switch (opcode)                                                         \
+    {                                                                       \
+        case GB_FIRST_opcode  : GB_VECTOR_LOOP (T, xt [t]) ; break ;        \
+        case GB_SECOND_opcode : GB_VECTOR_LOOP (T, yt [t]) ; break ;        \
+        case GB_MIN_opcode    :                                             \
+            GB_VECTOR_LOOP (T, GB_VECTOR_MIN (xt [t], yt [t])) ; break ;    \
+        case GB_MAX_opcode    :                                             \
+            GB_VECTOR_LOOP (T, GB_VECTOR_MAX (xt [t], yt [t])) ; break ;    \
+        case GB_PLUS_opcode   :                                             \
+            GB_VECTOR_LOOP (T, xt [t] + yt [t]) ; break ;                   \
+        case GB_TIMES_opcode  :                                             \
+            GB_VECTOR_LOOP (T, xt [t] * yt [t]) ; break ;                   \
+        default: ;                                                          \
+    }
+
+// z (t) = op (x (t), y (t)) for t = 0:k-1.  z may be the same as x or y,
+// since each z (t) depends only on x (t) and y (t).
+static inline void GB_vector_binop
+(
+    void *z,                        // output vector of k values
+    const void *x,                  // input vector of k values
+    const void *y,                  // input vector of k values
+    const GB_Opcode opcode,         // opcode of the op on each value
+    const bool fp32,                // true if float, false if double
+    const int k                     // # of values in each vector
+)
+{
+    if (fp32)
+    { 
+        GB_VECTOR_SWITCH (float) ;
+    }
+    else
+    { 
+        GB_VECTOR_SWITCH (double) ;
+    }
+}
+
+#define GB_BINOP_VECTOR(f,op)                                               \
+    const GB_Opcode f ## _vector_opcode =                                   \
+        ((op) == NULL) ? GB_NOP_opcode : (op)->vector_opcode ;              \
+    const int f ## _veclen = (f ## _vector_opcode == GB_NOP_opcode) ?       \
+        0 : (op)->ztype->veclen ;                                           \
+    const bool f ## _fp32 = (f ## _veclen > 0) &&                           \
+        ((op)->ztype->etype->code == GB_FP32_code) ;
+
+#define GB_BINOP_CALL(f,z,x,y)                                              \
+    ((f ## _veclen > 0) ?                                                   \
+        GB_vector_binop (z, x, y, f ## _vector_opcode, f ## _fp32,          \
+            f ## _veclen) :                                                 \
+        f (z, x, y))
+
 #endif
 
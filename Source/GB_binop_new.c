@@ -8,7 +8,8 @@
 //------------------------------------------------------------------------------
 
 // Create a new a binary operator: z = f (x,y).  The function pointer may
-// be NULL, for implied functions (FIRST and SECOND).  It may not be NULL
+// be NULL, for implied functions (FIRST and SECOND), and for operators on
+// vector-valued entries (see GxB_BinaryOp_new_vector).  It may not be NULL
 // otherwise.
 
 // The binary op header is allocated by the caller, and passed in
@@ -49,6 +50,7 @@ void GB_binop_new
     op->ztype = ztype ;
     op->function = function ;       // may be NULL
     op->opcode = opcode ;
+    op->vector_opcode = GB_NOP_opcode ; // see GxB_BinaryOp_new_vector
     op->name [0] = '\0' ;
 
     //--------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 #ifndef GB_BITMAP_ASSIGN_METHODS_H
 #define GB_BITMAP_ASSIGN_METHODS_H
 #include "GB_bitmap_assign.h"
+#include "GB_binop.h"
 #include "GB_ek_slice.h"
 #include "GB_partition.h"
 #include "GB_ij.h"
@@ -127,6 +128,7 @@
     ASSERT_BINARYOP_OK (accum, "accum for bitmap assign", GB0) ;            \
     ASSERT (!GB_OP_IS_POSITIONAL (accum)) ;                                 \
     GxB_binary_function faccum = accum->function ;                          \
+    GB_BINOP_VECTOR (faccum, accum) ;                                       \
     GB_cast_function cast_A_to_Y = GB_cast_factory (accum->ytype->code, acode);\
     GB_cast_function cast_C_to_X = GB_cast_factory (accum->xtype->code, ccode);\
     GB_cast_function cast_Z_to_C = GB_cast_factory (ccode, accum->ztype->code);\
@@ -166,7 +168,7 @@
     GB_void xwork [GB_VLA(xsize)] ;                         \
     cast_C_to_X (xwork, Cx +((pC)*csize), csize) ;          \
     GB_void zwork [GB_VLA(zsize)] ;                         \
-    faccum (zwork, xwork, ywork) ;                          \
+    GB_BINOP_CALL (faccum, zwork, xwork, ywork) ;           \
     cast_Z_to_C (Cx +((pC)*csize), zwork, csize) ;          \
 }                                                           \
 
@@ -65,6 +65,10 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
     A->x_size = 0 ;
     A->x_shallow = false ;
 
+    // any deferred operator is discarded with the values it applies to
+    A->deferred_op = NULL ;
+    A->deferred_type = NULL ;
+
     A->nzmax = 0 ;
     A->nvals = 0 ;
 
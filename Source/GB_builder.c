@@ -19,7 +19,10 @@
 // The indices are provided either as (I_input,J_input) or (I_work,J_work), not
 // both.  The values are provided as S_input or S_work, not both.  On return,
 // the *work arrays are either transplanted into T, or freed, since they are
-// temporary workspaces.
+// temporary workspaces.  The caller allocates them with GB_MALLOC, never from
+// the workspace arena, since they may become part of T.  GB_builder counts
+// them as workspace while it uses them (see GB_werk_adopt), and counts I_work
+// and S_work back as storage if they are transplanted into T.
 
 // The work is done in major 5 Steps, some of which can be skipped, depending
 // on how the tuples are provided (*_work or *_input), and whether or not they
@@ -99,13 +102,13 @@
 #define GB_J_WORK(t) (((t) < 0) ? -1 : ((J_work == NULL) ? 0 : J_work [t]))
 #define GB_K_WORK(t) (((t) < 0) ? -1 : ((K_work == NULL) ? t : K_work [t]))
 
-#define GB_FREE_WORK                                \
-{                                                   \
-    GB_WERK_POP (Work, int64_t) ;                   \
-    GB_FREE (I_work_handle, *I_work_size_handle) ;  \
-    GB_FREE (J_work_handle, *J_work_size_handle) ;  \
-    GB_FREE (S_work_handle, *S_work_size_handle) ;  \
-    GB_FREE_WERK (&K_work, K_work_size) ;           \
+#define GB_FREE_WORK                                                \
+{                                                                   \
+    GB_WERK_POP (Work, int64_t) ;                                   \
+    GB_FREE_WERK (I_work_handle, *I_work_size_handle, Context) ;    \
+    GB_FREE_WERK (J_work_handle, *J_work_size_handle, Context) ;    \
+    GB_FREE_WERK (S_work_handle, *S_work_size_handle, Context) ;    \
+    GB_FREE_WERK (&K_work, K_work_size, Context) ;                  \
 }
 
 //------------------------------------------------------------------------------
@@ -191,6 +194,12 @@ GrB_Info GB_builder                 // build a matrix from tuples
     int64_t *restrict K_work = NULL ; size_t K_work_size = 0 ;
     ASSERT (*J_work_size_handle == GB_Global_memtable_size (J_work)) ;
 
+    // the *work arrays are counted as workspace until they are freed or
+    // transplanted into T
+    GB_werk_adopt (I_work, *I_work_size_handle, Context) ;
+    GB_werk_adopt (J_work, *J_work_size_handle, Context) ;
+    GB_werk_adopt (S_work, *S_work_size_handle, Context) ;
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use
     //--------------------------------------------------------------------------
@@ -277,6 +286,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
 
         ASSERT (J_work == NULL) ;
         I_work = GB_MALLOC (nvals, int64_t, I_work_size_handle) ;
+        GB_werk_adopt (I_work, *I_work_size_handle, Context) ;
         (*I_work_handle) = I_work ;
         ijslen = nvals ;
         if (I_work == NULL)
@@ -399,6 +409,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
             {
                 // copy J_input into J_work, so the tuples can be sorted
                 J_work = GB_MALLOC (nvals, int64_t, J_work_size_handle) ;
+                GB_werk_adopt (J_work, *J_work_size_handle, Context) ;
                 (*J_work_handle) = J_work ;
                 if (J_work == NULL)
                 { 
@@ -534,7 +545,8 @@ GrB_Info GB_builder                 // build a matrix from tuples
         {
 
             // sort a set of (j,i,k) tuples
-            info = GB_msort_3b (J_work, I_work, K_work, nvals, nthreads) ;
+            info = GB_msort_3b (J_work, I_work, K_work, nvals, nthreads,
+                Context) ;
 
             #ifdef GB_DEBUG
             if (info == GrB_SUCCESS)
@@ -556,7 +568,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
         else
         {
             // sort a set of (i,k) tuples
-            info = GB_msort_2b (I_work, K_work, nvals, nthreads) ;
+            info = GB_msort_2b (I_work, K_work, nvals, nthreads, Context) ;
 
             #ifdef GB_DEBUG
             if (info == GrB_SUCCESS)
@@ -880,7 +892,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
     //--------------------------------------------------------------------------
 
     ASSERT (J_work_handle != NULL) ;
-    GB_FREE (J_work_handle, *J_work_size_handle) ;
+    GB_FREE_WERK (J_work_handle, *J_work_size_handle, Context) ;
     J_work = NULL ;
 
     //--------------------------------------------------------------------------
@@ -891,6 +903,8 @@ GrB_Info GB_builder                 // build a matrix from tuples
 
     if (ndupl == 0)
     {
+        // I_work becomes T->i, so it is counted as storage from here on
+        GB_werk_transplant (I_work, *I_work_size_handle, Context) ;
         // shrink I_work from size ijslen to size T->nzmax
         if (T->nzmax < ijslen)
         { 
@@ -1023,6 +1037,8 @@ GrB_Info GB_builder                 // build a matrix from tuples
         op_2nd = GB_op_is_second (dup, ttype) ;
     }
 
+    GB_BINOP_VECTOR (fdup, dup) ;   // for an op on vector-valued entries
+
     //--------------------------------------------------------------------------
     // get the sizes and codes of each type
     //--------------------------------------------------------------------------
@@ -1067,6 +1083,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
         // rarely be used for GB_transpose, in the case when op is NULL and the
         // transposed tuples happen to be sorted (which is unlikely).
 
+        GB_werk_transplant (S_work, *S_work_size_handle, Context) ;
         T->x = S_work ; T->x_size = (*S_work_size_handle) ;
         S_work = NULL ;
         (*S_work_handle) = NULL ;
@@ -1219,7 +1236,8 @@ GrB_Info GB_builder                 // build a matrix from tuples
                     // Tx [p] += (ttype) S [k], but with no typecasting
                     #undef  GB_ADD_CAST_ARRAY_TO_ARRAY
                     #define GB_ADD_CAST_ARRAY_TO_ARRAY(Tx,p,S,k)        \
-                        fdup (Tx +((p)*tsize), Tx +((p)*tsize), S +((k)*tsize));
+                        GB_BINOP_CALL (fdup, Tx +((p)*tsize),           \
+                            Tx +((p)*tsize), S +((k)*tsize)) ;
                     #include "GB_reduce_build_template.c"
                 }
             }
@@ -1289,7 +1307,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
                     cast_T_to_X (xwork, Tx +((p)*tsize), tsize) ;           \
                     /* zwork = f (xwork, ywork) */                          \
                     GB_void zwork [GB_VLA(zsize)] ;                         \
-                    fdup (zwork, xwork, ywork) ;                            \
+                    GB_BINOP_CALL (fdup, zwork, xwork, ywork) ;             \
                     /* Tx [tnz-1] = (ttype) zwork */                        \
                     cast_Z_to_T (Tx +((p)*tsize), zwork, zsize) ;           \
                 }
@@ -7,7 +7,10 @@
 
 //------------------------------------------------------------------------------
 
-// A wrapper for calloc.  Space is set to zero.
+// A wrapper for calloc.  Space is set to zero.  A large block newly obtained
+// from malloc is backed with huge pages if GxB_HUGE_PAGE is set (see
+// GB_huge_page.c), and placed on the NUMA nodes according to the
+// GxB_NUMA_POLICY (see GB_numa.c), and cleared by the threads that place it.
 
 #include "GB.h"
 
@@ -62,8 +65,14 @@ static inline void *GB_calloc_helper
             {
                 p = GB_Global_malloc_function (*size) ;
             }
-            // memset is required if the block comes from malloc
-            do_memset = (p != NULL) ;
+            // advise huge pages before the block is first touched
+            GB_huge_page_advise (p, *size) ;
+            // memset is required if the block comes from malloc, unless
+            // it has already been cleared when placed on the NUMA nodes
+            GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+            bool cleared = GB_numa_place (p, size_requested, true,
+                nthreads_max) ;
+            do_memset = (p != NULL) && !cleared ;
         }
         if (p != NULL && malloc_tracking)
         { 
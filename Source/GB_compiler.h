@@ -144,5 +144,21 @@
     #define GB_VLA(s) GB_VLA_MAXSIZE
 
 #endif
+
+//------------------------------------------------------------------------------
+// thread-local storage
+//------------------------------------------------------------------------------
+
+// GB_THREAD_LOCAL declares a static variable with a separate instance for
+// each user thread (see GB_Context_engaged.c).
+
+#if GB_MICROSOFT
+    #define GB_THREAD_LOCAL __declspec ( thread )
+#elif defined ( __cplusplus )
+    #define GB_THREAD_LOCAL thread_local
+#else
+    #define GB_THREAD_LOCAL _Thread_local
+#endif
+
 #endif
 
@@ -9,8 +9,8 @@
 
 #define GB_FREE_ALL                 \
     GB_FREE (&Wi, Wi_size) ;        \
-    GB_FREE_WERK (&Wj, Wj_size) ;   \
-    GB_FREE_WERK (&Wx, Wx_size) ;   \
+    GB_FREE (&Wj, Wj_size) ;        \
+    GB_FREE (&Wx, Wx_size) ;        \
     GB_phbix_free (C) ;
 
 #include "GB_concat.h"
@@ -54,8 +54,10 @@ GrB_Info GB_concat_hyper            // concatenate into a hypersparse matrix
     GB_phbix_free (C) ;
 
     Wi = GB_MALLOC (cnz, int64_t, &Wi_size) ;               // becomes C->i
-    Wj = GB_MALLOC_WERK (cnz, int64_t, &Wj_size) ;          // freed below
-    Wx = GB_MALLOC_WERK (cnz * csize, GB_void, &Wx_size) ;  // freed below
+    // Wj and Wx are freed by GB_builder, so they are not taken from the
+    // workspace arena (see GB_werk_adopt)
+    Wj = GB_MALLOC (cnz, int64_t, &Wj_size) ;               // freed below
+    Wx = GB_MALLOC (cnz * csize, GB_void, &Wx_size) ;       // freed below
     if (Wi == NULL || Wj == NULL || Wx == NULL)
     { 
         // out of memory
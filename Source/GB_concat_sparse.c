@@ -15,8 +15,8 @@
             GB_Matrix_free (&(S [k])) ;         \
         }                                       \
     }                                           \
-    GB_FREE_WERK (&S, S_size) ;                 \
-    GB_FREE_WERK (&Work, Work_size) ;           \
+    GB_FREE_WERK (&S, S_size, Context) ;        \
+    GB_FREE_WERK (&Work, Work_size, Context) ;  \
     GB_WERK_POP (A_ek_slicing, int64_t) ;
 
 #define GB_FREE_ALL         \
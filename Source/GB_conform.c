@@ -18,6 +18,30 @@
 
 #define GB_FREE_ALL ;
 
+//------------------------------------------------------------------------------
+// GB_sparse_to_bitmap_damped, GB_bitmap_to_sparse_damped: damped tests
+//------------------------------------------------------------------------------
+
+// These tests are used only when A->sparsity allows A to be either sparse or
+// bitmap.  Their hysteresis band is widened if A has recently been converted
+// back and forth (see GB_matrix.h).
+
+static inline bool GB_sparse_to_bitmap_damped (GrB_Matrix A)
+{ 
+    float bitmap_switch = GB_switch_damped (A->bitmap_switch,
+        A->conform_damping, true) ;
+    return (GB_convert_sparse_to_bitmap_test (bitmap_switch,
+        GB_NNZ (A), A->vlen, A->vdim)) ;
+}
+
+static inline bool GB_bitmap_to_sparse_damped (GrB_Matrix A)
+{ 
+    float bitmap_switch = GB_switch_damped (A->bitmap_switch,
+        A->conform_damping, false) ;
+    return (GB_convert_bitmap_to_sparse_test (bitmap_switch,
+        GB_NNZ (A), A->vlen, A->vdim)) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_hyper_or_bitmap: ensure a matrix is either hypersparse or bitmap
 //------------------------------------------------------------------------------
@@ -29,16 +53,12 @@ static inline GrB_Info GB_hyper_or_bitmap
 )
 {
     GrB_Info info ;
-    if (is_full || ((is_hyper || is_sparse) &&
-        GB_convert_sparse_to_bitmap_test (A->bitmap_switch,
-            GB_NNZ (A), A->vlen, A->vdim)))
+    if (is_full || ((is_hyper || is_sparse) && GB_sparse_to_bitmap_damped (A)))
     { 
         // if full or sparse/hypersparse with many entries: to bitmap
         GB_OK (GB_convert_any_to_bitmap (A, Context)) ;
     }
-    else if (is_sparse || (is_bitmap &&
-        GB_convert_bitmap_to_sparse_test (A->bitmap_switch,
-            GB_NNZ (A), A->vlen, A->vdim)))
+    else if (is_sparse || (is_bitmap && GB_bitmap_to_sparse_damped (A)))
     { 
         // if sparse or bitmap with few entries: to hypersparse
         GB_OK (GB_convert_any_to_hyper (A, Context)) ;
@@ -57,16 +77,12 @@ static inline GrB_Info GB_sparse_or_bitmap
 )
 {
     GrB_Info info ;
-    if (is_full || ((is_hyper || is_sparse) &&
-        GB_convert_sparse_to_bitmap_test (A->bitmap_switch,
-            GB_NNZ (A), A->vlen, A->vdim)))
+    if (is_full || ((is_hyper || is_sparse) && GB_sparse_to_bitmap_damped (A)))
     { 
         // if full or sparse/hypersparse with many entries: to bitmap
         GB_OK (GB_convert_any_to_bitmap (A, Context)) ;
     }
-    else if (is_hyper || (is_bitmap &&
-        GB_convert_bitmap_to_sparse_test (A->bitmap_switch,
-            GB_NNZ (A), A->vlen, A->vdim)))
+    else if (is_hyper || (is_bitmap && GB_bitmap_to_sparse_damped (A)))
     { 
         // if hypersparse or bitmap with few entries: to sparse
         GB_OK (GB_convert_any_to_sparse (A, Context)) ;
@@ -85,17 +101,14 @@ static inline GrB_Info GB_hyper_sparse_or_bitmap
 )
 {
     GrB_Info info ;
-    if (is_full || ((is_hyper || is_sparse) &&
-        GB_convert_sparse_to_bitmap_test (A->bitmap_switch,
-            GB_NNZ (A), A->vlen, A->vdim)))
+    if (is_full || ((is_hyper || is_sparse) && GB_sparse_to_bitmap_damped (A)))
     { 
         // if full or sparse/hypersparse with many entries: to bitmap
         GB_OK (GB_convert_any_to_bitmap (A, Context)) ;
     }
     else if (is_bitmap)
     {
-        if (GB_convert_bitmap_to_sparse_test (A->bitmap_switch,
-            GB_NNZ (A), A->vlen, A->vdim))
+        if (GB_bitmap_to_sparse_damped (A))
         { 
             // if bitmap with few entries: to sparse
             GB_OK (GB_convert_bitmap_to_sparse (A, Context)) ;
@@ -137,12 +150,15 @@ GrB_Info GB_conform     // conform a matrix to its desired sparsity structure
     bool is_bitmap = GB_IS_BITMAP (A) ;
     bool is_full_or_dense_with_no_pending_work = is_full || (GB_is_dense (A)
         && !GB_ZOMBIES (A) && !GB_JUMBLED (A) && !GB_PENDING (A)) ;
+    int sparsity_in = GB_sparsity (A) ;
+    double t = (A->stats == NULL) ? 0 : GB_OPENMP_GET_WTIME ;
 
     //--------------------------------------------------------------------------
     // select the sparsity structure
     //--------------------------------------------------------------------------
 
-    switch (GB_sparsity_control (A->sparsity, A->vdim))
+    int sparsity_control = GB_sparsity_control (A->sparsity, A->vdim) ;
+    switch (sparsity_control)
     {
 
         //----------------------------------------------------------------------
@@ -380,6 +396,31 @@ GrB_Info GB_conform     // conform a matrix to its desired sparsity structure
             break ;
     }
 
+    //--------------------------------------------------------------------------
+    // update the conversion counters and the damping of A
+    //--------------------------------------------------------------------------
+
+    int sparsity_out = GB_sparsity (A) ;
+    if (sparsity_out != sparsity_in)
+    { 
+        GB_stats_conform (A, sparsity_out, t) ;
+        if (sparsity_control & sparsity_in)
+        { 
+            // A has been converted from one allowed structure to another
+            A->conform_damping =
+                GB_IMIN (A->conform_damping + 1, GB_CONFORM_DAMPING_MAX) ;
+            A->conform_stable = 0 ;
+        }
+    }
+    else if (A->conform_damping > 0 &&
+        ++(A->conform_stable) >= GB_CONFORM_DECAY)
+    { 
+        // A has kept its structure for a while: narrow the bands again
+        A->conform_damping-- ;
+        A->conform_stable = 0 ;
+    }
+    GB_stats_werk (A, Context) ;
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
@@ -45,13 +45,20 @@ GrB_Info GB_conform_hyper       // conform a matrix to sparse/hypersparse
         A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
     }
 
-    if (A->h == NULL && GB_convert_sparse_to_hyper_test (A->hyper_switch,
+    // the hysteresis band is widened if A has recently been converted back
+    // and forth by GB_conform (see GB_matrix.h)
+    float hyper_lower = GB_switch_damped (A->hyper_switch,
+        A->conform_damping, false) ;
+    float hyper_upper = GB_switch_damped (A->hyper_switch,
+        A->conform_damping, true) ;
+
+    if (A->h == NULL && GB_convert_sparse_to_hyper_test (hyper_lower,
         A->nvec_nonempty, A->vdim)) // A->nvec_nonempty used here
     { 
         // A is sparse but should be converted to hypersparse
         GB_OK (GB_convert_sparse_to_hyper (A, Context)) ;
     }
-    else if (A->h != NULL && GB_convert_hyper_to_sparse_test (A->hyper_switch,
+    else if (A->h != NULL && GB_convert_hyper_to_sparse_test (hyper_upper,
         A->nvec_nonempty, A->vdim)) // A->nvec_nonempty used here
     { 
         // A is hypersparse but should be converted to sparse
@@ -34,6 +34,17 @@
 // For those methods the default rule is always used (nthreads_max =
 // GxB_DEFAULT), which then relies on the global nthreads_max.
 
+// A user thread can engage a GxB_Context (see GxB_Context_engage).  Its
+// settings then take the place of the global nthreads_max and chunk, and the
+// descriptor (if any) takes precedence over both.  The engaged context also
+// controls the burble, limits the workspace of each method (memory_budget,
+// which otherwise follows the global GxB_MEMORY_BUDGET), and can provide an
+// arena for workspace (see GB_memory.h), which can be resized at the start
+// of each method (see GB_Context_arena_resize).
+
+// If GxB_THREAD_BUDGET is set, GB_GET_NTHREADS_MAX also reduces nthreads_max
+// to the threads not in use by other user threads (see GB_thread_budget.c).
+
 // GB_WERK_SIZE is the size of a small fixed-sized array in the Context, used
 // for small werkspace allocations (typically O(# of threads or # tasks)).
 // GB_WERK_SIZE must be a multiple of 8.  The Werk array is placed first in the
@@ -50,11 +61,33 @@ typedef struct
     size_t *logger_size_handle ;
     int nthreads_max ;              // max # of threads to use
     int pwerk ;                     // top of Werk stack, initially zero
+    int64_t werk_inuse ;            // workspace in use by GB_MALLOC_WERK
+    int64_t werk_peak ;             // peak workspace, in bytes
+    int64_t memory_budget ;         // max workspace, in bytes, or 0 if none
+    GxB_Context engaged ;           // context engaged by this thread, if any
 }
 GB_Context_struct ;
 
 typedef GB_Context_struct *GB_Context ;
 
+// GxB_Context engaged by the calling thread (see GB_Context_engaged.c)
+GB_PUBLIC GxB_Context GB_Context_engaged (void) ;
+          void   GB_Context_engaged_set (GxB_Context context) ;
+GB_PUBLIC int    GB_Context_nthreads_max_get (void) ;
+GB_PUBLIC double GB_Context_chunk_get (void) ;
+GB_PUBLIC int64_t GB_Context_memory_budget_get (void) ;
+          void  *GB_Context_arena_malloc (GxB_Context context, size_t nbytes,
+                    size_t *size_allocated) ;
+          bool   GB_Context_arena_free (GxB_Context context, void *p,
+                    size_t size_allocated) ;
+          bool   GB_Context_arena_owns (GxB_Context context, void *p) ;
+          void   GB_Context_arena_resize (GxB_Context context) ;
+
+// thread budget shared by all user threads (see GB_thread_budget.c)
+GB_PUBLIC void   GB_thread_budget_begin (void) ;
+GB_PUBLIC void   GB_thread_budget_end (void) ;
+GB_PUBLIC int    GB_thread_budget_acquire (int nthreads_max) ;
+
 // GB_WHERE keeps track of the currently running user-callable function.
 // User-callable functions in this implementation are written so that they do
 // not call other unrelated user-callable functions (except for GrB_*free).
@@ -71,17 +104,27 @@ typedef GB_Context_struct *GB_Context ;
     GB_Context Context = &Context_struct ;                          \
     /* set Context->where so GrB_error can report it if needed */   \
     Context->where = where_string ;                                 \
-    /* get the default max # of threads and default chunk size */   \
-    Context->nthreads_max = GB_Global_nthreads_max_get ( ) ;        \
-    Context->chunk = GB_Global_chunk_get ( ) ;                      \
+    /* get the default max # of threads and default chunk size, */  \
+    /* from the context engaged by this thread, if any */           \
+    Context->engaged = GB_Context_engaged ( ) ;                     \
+    /* size the arena to the workspace of the recent methods */     \
+    GB_Context_arena_resize (Context->engaged) ;                    \
+    Context->nthreads_max = GB_Context_nthreads_max_get ( ) ;       \
+    Context->chunk = GB_Context_chunk_get ( ) ;                     \
+    Context->memory_budget = GB_Context_memory_budget_get ( ) ;     \
     /* get the pointer to where any error will be logged */         \
     Context->logger_handle = NULL ;                                 \
     Context->logger_size_handle = NULL ;                            \
-    /* initialize the Werk stack */                                 \
-    Context->pwerk = 0 ;
+    /* initialize the Werk stack and the workspace counters */      \
+    Context->pwerk = 0 ;                                            \
+    Context->werk_inuse = 0 ;                                       \
+    Context->werk_peak = 0 ;
 
 // C is a matrix, vector, scalar, or descriptor
-#define GB_WHERE(C,where_string)                                    \
+// create the Context, with error logging into the object C (a matrix,
+// vector, scalar, or descriptor).  Any content C shares with a snapshot
+// remains shared.
+#define GB_WHERE_LOG(C,where_string)                                \
     if (!GB_Global_GrB_init_called_get ( ))                         \
     {                                                               \
         return (GrB_PANIC) ; /* GrB_init not called */              \
@@ -95,6 +138,16 @@ typedef GB_Context_struct *GB_Context ;
         Context->logger_size_handle = &(C->logger_size) ;           \
     }
 
+// create the Context for a method that modifies the matrix C, with error
+// logging.  If C shares its content with a snapshot, C is given its own copy.
+#define GB_WHERE(C,where_string)                                    \
+    GB_WHERE_LOG (C, where_string)                                  \
+    if (C != NULL && C->magic == GB_MAGIC && C->shared != NULL)     \
+    {                                                               \
+        GrB_Info unshare_info = GB_unshare ((GrB_Matrix) C, Context) ; \
+        if (unshare_info != GrB_SUCCESS) return (unshare_info) ;    \
+    }
+
 // create the Context, with no error logging
 #define GB_WHERE1(where_string)                                     \
     if (!GB_Global_GrB_init_called_get ( ))                         \
@@ -103,6 +156,26 @@ typedef GB_Context_struct *GB_Context ;
     }                                                               \
     GB_CONTEXT (where_string)
 
+// create a Context for one of many tasks that call internal methods in
+// parallel (see GB_AxB_tiled.c), each with its own Werk stack and at most
+// nthreads threads.  The tasks do not log errors, and do not use the arena of
+// the engaged context, which is not safe to share among them.
+#define GB_CONTEXT_TASK(Task_Context,Context,nthreads)              \
+    GB_Context_struct Task_Context ## _struct ;                     \
+    GB_Context Task_Context = &(Task_Context ## _struct) ;          \
+    Task_Context->where = (Context == NULL) ? "" : Context->where ; \
+    Task_Context->engaged = NULL ;                                  \
+    Task_Context->nthreads_max = nthreads ;                         \
+    Task_Context->chunk = (Context == NULL) ?                       \
+        GxB_DEFAULT : Context->chunk ;                              \
+    Task_Context->memory_budget = (Context == NULL) ?               \
+        0 : Context->memory_budget ;                                \
+    Task_Context->logger_handle = NULL ;                            \
+    Task_Context->logger_size_handle = NULL ;                       \
+    Task_Context->pwerk = 0 ;                                       \
+    Task_Context->werk_inuse = 0 ;                                  \
+    Task_Context->werk_peak = 0 ;
+
 //------------------------------------------------------------------------------
 // GB_GET_NTHREADS_MAX:  determine max # of threads for OpenMP parallelism.
 //------------------------------------------------------------------------------
@@ -113,20 +186,37 @@ typedef GB_Context_struct *GB_Context ;
 //      automatically: between 1 and nthreads_max, depending on the problem
 //      size.  Below is the default rule.  Any function can use its own rule
 //      instead, based on Context, chunk, nthreads_max, and the problem size.
-//      No rule can exceed nthreads_max.
+//      No rule can exceed nthreads_max.  If the thread budget is in use,
+//      nthreads_max is first reduced to the threads leased by this method.
 
 #define GB_GET_NTHREADS_MAX(nthreads_max,chunk,Context)                     \
     int nthreads_max = (Context == NULL) ? 1 : Context->nthreads_max ;      \
     if (nthreads_max <= GxB_DEFAULT)                                        \
     {                                                                       \
-        nthreads_max = GB_Global_nthreads_max_get ( ) ;                     \
+        nthreads_max = GB_Context_nthreads_max_get ( ) ;                    \
     }                                                                       \
     double chunk = (Context == NULL) ? GxB_DEFAULT : Context->chunk ;       \
     if (chunk <= GxB_DEFAULT)                                               \
     {                                                                       \
-        chunk = GB_Global_chunk_get ( ) ;                                   \
+        chunk = GB_Context_chunk_get ( ) ;                                  \
+    }                                                                       \
+    if (Context != NULL)                                                    \
+    {                                                                       \
+        nthreads_max = GB_thread_budget_acquire (nthreads_max) ;            \
     }
 
+//------------------------------------------------------------------------------
+// GB_MEMORY_BUDGET: max workspace of a method, in bytes, or 0 if no limit
+//------------------------------------------------------------------------------
+
+// Methods that can choose between strategies that need more or less workspace
+// use this to pick one that fits in the budget (see GB_AxB_saxpy_sparsity and
+// GB_AxB_saxpy3_slice_balanced).  Workspace allocations beyond the budget
+// fail (see GB_werk_alloc in GB_memory.h).
+
+#define GB_MEMORY_BUDGET(Context)                                           \
+    ((Context == NULL) ? 0 : Context->memory_budget)
+
 //------------------------------------------------------------------------------
 // GB_nthreads: determine # of threads to use for a parallel loop or region
 //------------------------------------------------------------------------------
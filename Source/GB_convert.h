@@ -106,6 +106,26 @@ bool GB_convert_sparse_to_bitmap_test    // test for hyper/sparse to bitmap
     int64_t vdim            // A->vdim
 ) ;
 
+// GB_switch_damped: widen a hysteresis band of GB_conform (see GB_matrix.h).
+// The upper threshold (hypersparse to sparse, or sparse to bitmap) is
+// multiplied by 2^damping, and the lower threshold (sparse to hypersparse, or
+// bitmap to sparse) is divided by it.  A switch outside the range (0,1) means
+// always or never convert, and is returned unchanged.
+static inline float GB_switch_damped
+(
+    float sparsity_switch,  // A->hyper_switch or A->bitmap_switch
+    int damping,            // A->conform_damping
+    bool upper              // true for the upper threshold
+)
+{
+    if (damping <= 0 || sparsity_switch <= 0 || sparsity_switch >= 1)
+    { 
+        return (sparsity_switch) ;
+    }
+    float scale = (float) (1 << GB_IMIN (damping, GB_CONFORM_DAMPING_MAX)) ;
+    return (upper ? (sparsity_switch * scale) : (sparsity_switch / scale)) ;
+}
+
 GrB_Info GB_convert_full_to_sparse      // convert matrix from full to sparse
 (
     GrB_Matrix A,               // matrix to convert from full to sparse
@@ -225,7 +225,7 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
     // free workspace return result
     //--------------------------------------------------------------------------
 
-    GB_FREE_WERK (&W, W_size) ;
+    GB_FREE_WERK (&W, W_size, Context) ;
     return (GrB_SUCCESS) ;
 }
 
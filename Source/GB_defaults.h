@@ -34,5 +34,10 @@
 // initial size of the pending tuples
 #define GB_PENDING_INIT 256
 
+// GB_conform widens its hysteresis bands by at most 2^4 = 16, and narrows them
+// again by a factor of 2 after 8 calls that make no conversion
+#define GB_CONFORM_DAMPING_MAX 4
+#define GB_CONFORM_DECAY 8
+
 #endif
 
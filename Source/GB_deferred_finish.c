@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+// GB_deferred_finish: apply the deferred unary operator of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// In GrB_NONBLOCKING mode, GB_apply can defer C=op(A), where op is a unary
+// operator.  C then shares the content of A, and C->x still holds the values
+// of A, of type C->deferred_type.  This method computes C->x = op (C->x).  The
+// pattern of C is not modified, and remains shared with A.
+
+// If C is the only matrix still using the shared content (A has since been
+// freed or modified), and the two types have the same size, the operator is
+// applied in-place, so the temporary matrix A costs no extra allocation and
+// no extra pass.  Otherwise, C is given a new C->x.
+
+#include "GB_apply.h"
+#include "GB_atomics.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_deferred_finish     // apply the deferred operator of A
+(
+    GrB_Matrix A,               // matrix with a deferred operator
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (!GB_DEFERRED (A))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A with deferred op", GB0) ;
+    ASSERT (A->shared != NULL) ;
+    ASSERT (!GB_PENDING (A) && !GB_ZOMBIES (A)) ;
+
+    GrB_Info info ;
+    GrB_UnaryOp op = A->deferred_op ;
+    GrB_Type xtype = A->deferred_type ;
+    ASSERT (op->ztype == A->type) ;
+    GB_BURBLE_MATRIX (A, "(deferred %s) ", op->name) ;
+
+    //--------------------------------------------------------------------------
+    // X: a shallow copy of A, with its values still of type xtype
+    //--------------------------------------------------------------------------
+
+    struct GB_Matrix_opaque X_header ;
+    GrB_Matrix X = GB_clear_static_header (&X_header) ;
+    memcpy (X, A, sizeof (struct GB_Matrix_opaque)) ;
+    X->static_header = true ;
+    X->type = xtype ;
+    X->deferred_op = NULL ;
+    X->deferred_type = NULL ;
+    X->p_shallow = (X->p != NULL) ;
+    X->h_shallow = (X->h != NULL) ;
+    X->b_shallow = (X->b != NULL) ;
+    X->i_shallow = (X->i != NULL) ;
+    X->x_shallow = (X->x != NULL) ;
+    X->shared = NULL ;
+    X->stats = NULL ;
+    X->logger = NULL ;
+    GB_profile_invalidate (X) ;
+
+    //--------------------------------------------------------------------------
+    // A->x = op (X->x)
+    //--------------------------------------------------------------------------
+
+    int64_t nshared ;
+    GB_ATOMIC_READ
+    nshared = A->shared->nshared ;
+
+    size_t zsize = A->type->size ;
+    if (nshared == 1 && A->x == A->shared->x && xtype->size == zsize)
+    {
+        // A is the only matrix using the content: apply the op in-place.
+        // A->x remains shallow, and GB_unshare takes it back.
+        info = GB_apply_op ((GB_void *) A->x, op, NULL, NULL, false, X,
+            Context) ;
+    }
+    else
+    {
+        // give A a new A->x
+        size_t Ax_size = 0 ;
+        GB_void *Ax_new = GB_MALLOC (GB_IMAX (A->nzmax, 1) * zsize, GB_void,
+            &Ax_size) ;
+        if (Ax_new == NULL)
+        {
+            // out of memory; A is unchanged
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        info = GB_apply_op (Ax_new, op, NULL, NULL, false, X, Context) ;
+        if (info != GrB_SUCCESS)
+        {
+            GB_FREE (&Ax_new, Ax_size) ;
+            return (info) ;
+        }
+        A->x = Ax_new ;
+        A->x_size = Ax_size ;
+        A->x_shallow = false ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_SUCCESS)
+    {
+        A->deferred_op = NULL ;
+        A->deferred_type = NULL ;
+        ASSERT_MATRIX_OK (A, "A with deferred op applied", GB0) ;
+    }
+    return (info) ;
+}
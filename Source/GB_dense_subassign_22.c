@@ -133,6 +133,7 @@ GrB_Info GB_dense_subassign_22      // C += b where C is dense and b is a scalar
         //----------------------------------------------------------------------
 
         GxB_binary_function fadd = accum->function ;
+        GB_BINOP_VECTOR (fadd, accum) ;
 
         //----------------------------------------------------------------------
         // C += b via function pointers, and typecasting
@@ -140,7 +141,7 @@ GrB_Info GB_dense_subassign_22      // C += b where C is dense and b is a scalar
 
         // C(i,j) = C(i,j) + scalar
         #define GB_BINOP(cout_ij, cin_aij, bwork, i, j) \
-            fadd (cout_ij, cin_aij, bwork)
+            GB_BINOP_CALL (fadd, cout_ij, cin_aij, bwork)
 
         // address of Cx [p]
         #define GB_CX(p) Cx +((p)*csize)
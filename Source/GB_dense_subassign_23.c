@@ -166,6 +166,7 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
         GB_BURBLE_MATRIX (B, "(generic C+=B) ") ;
 
         GxB_binary_function fadd = accum->function ;
+        GB_BINOP_VECTOR (fadd, accum) ;
 
         size_t csize = C->type->size ;
         size_t bsize = B->type->size ;
@@ -195,7 +196,7 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
         // no vectorization
         #define GB_PRAGMA_SIMD_VECTORIZE ;
 
-        #define GB_BINOP(z,x,y,i,j) fadd (z,x,y)
+        #define GB_BINOP(z,x,y,i,j) GB_BINOP_CALL (fadd,z,x,y)
         #include "GB_dense_subassign_23_template.c"
     }
 
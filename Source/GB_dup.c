@@ -48,10 +48,12 @@ GrB_Info GB_dup             // make an exact copy of a matrix
     (*Chandle) = NULL ;
 
     //--------------------------------------------------------------------------
-    // delete any lingering zombies and assemble any pending tuples
+    // assemble any pending tuples
     //--------------------------------------------------------------------------
 
-    GB_MATRIX_WAIT (A) ;        // TODO: keep zombies and jumbled
+    // Zombies and the jumbled state are copied into C as-is, and are dealt
+    // with only when C or A are used by a method that cannot tolerate them.
+    GB_MATRIX_WAIT_IF_PENDING (A) ;
 
     //--------------------------------------------------------------------------
     // C = A
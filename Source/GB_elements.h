@@ -0,0 +1,138 @@
+//------------------------------------------------------------------------------
+// GB_elements.h: definitions for the batched element methods
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_*_setElements, GxB_*_removeElements, and GxB_*_extractElements operate
+// on a list of tuples at once, with a single GB_WHERE, a single check of the
+// inputs, and a parallel sweep over the list.
+
+#ifndef GB_ELEMENTS_H
+#define GB_ELEMENTS_H
+#include "GB.h"
+
+GrB_Info GB_setElements         // C(I(k),J(k)) = X(k) for k = 0:nvals-1
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices (NULL if C is a GrB_Vector)
+    const void *X,              // values to set
+    const GrB_Index nvals,      // number of tuples
+    const GB_Type_code xcode,   // type of X
+    GB_Context Context
+) ;
+
+GrB_Info GB_removeElements      // remove C(I(k),J(k)) for k = 0:nvals-1
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices (NULL if C is a GrB_Vector)
+    const GrB_Index nvals,      // number of tuples
+    GB_Context Context
+) ;
+
+GrB_Info GB_extractElements     // X(k) = A(I(k),J(k)) for k = 0:nvals-1
+(
+    void *X,                    // extracted values
+    bool *Present,              // Present [k] true if A(I(k),J(k)) present
+    const GB_Type_code xcode,   // type of X
+    const GrB_Matrix A,         // matrix to extract entries from
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices (NULL if A is a GrB_Vector)
+    const GrB_Index nvals,      // number of tuples
+    GB_Context Context
+) ;
+
+GrB_Info GB_elements_sort       // check and sort a list of tuples
+(
+    // output:
+    int64_t **I_work_handle,    // index of each tuple within its vector
+    size_t *I_work_size_handle,
+    int64_t **J_work_handle,    // vector index of each tuple
+    size_t *J_work_size_handle,
+    int64_t **K_work_handle,    // original position of each tuple, or NULL
+    size_t *K_work_size_handle,
+    // input:
+    const GrB_Matrix C,         // matrix the tuples refer to
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices (NULL if C is a GrB_Vector)
+    const int64_t nvals,        // number of tuples
+    GB_Context Context
+) ;
+
+//------------------------------------------------------------------------------
+// GB_elements_last: true if tuple t is the last of a set of duplicates
+//------------------------------------------------------------------------------
+
+// The tuples have been sorted by GB_elements_sort, so duplicates are adjacent,
+// and the last one in the list is the last one given by the user.  Only that
+// tuple is used, so no two tasks ever modify the same entry.
+
+static inline bool GB_elements_last
+(
+    const int64_t *restrict I_work,
+    const int64_t *restrict J_work,
+    const int64_t t,
+    const int64_t nvals
+)
+{
+    return (t == nvals - 1 ||
+        I_work [t] != I_work [t+1] || J_work [t] != J_work [t+1]) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_elements_lookup: find C(i,j) in a sparse or hypersparse matrix
+//------------------------------------------------------------------------------
+
+// C may have zombies but must not be jumbled.  Each task visits its tuples in
+// sorted order, so the vector C(:,j) is looked up only once per task, and the
+// search for C(i,j) starts where the search for the prior tuple in the same
+// vector left off.  The caller initializes *jlast to -1 and *kleft to 0.
+// nzombies must be nonzero if other tasks can create zombies in C during the
+// search.
+
+static inline bool GB_elements_lookup   // true if C(i,j) found
+(
+    // output:
+    int64_t *pC,                // position of C(i,j), if found
+    bool *is_zombie,            // true if C(i,j) is a zombie
+    // input:
+    const GrB_Matrix C,
+    const int64_t i,
+    const int64_t j,
+    const int64_t nzombies,     // C->nzombies, or 1 if zombies can appear
+    // input/output:
+    int64_t *jlast,             // vector of the prior lookup, or -1
+    int64_t *kleft,             // where to start the search of C->h
+    int64_t *pstart,            // search C->i [pstart...pend-1] for C(i,j)
+    int64_t *pend
+)
+{
+    if (j != (*jlast))
+    {
+        // find the vector C(:,j)
+        GB_lookup (C->h != NULL, C->h, C->p, C->vlen, kleft, C->nvec-1, j,
+            pstart, pend) ;
+        (*jlast) = j ;
+    }
+    int64_t pleft = (*pstart) ;
+    int64_t pright = (*pend) - 1 ;
+    bool found, zombie ;
+    const int64_t *restrict Ci = C->i ;
+    GB_BINARY_SEARCH_ZOMBIE (i, Ci, pleft, pright, found, nzombies, zombie) ;
+    if (pleft >= 0)
+    {
+        // all entries before pleft have indices less than i
+        (*pstart) = pleft ;
+    }
+    (*pC) = pleft ;
+    (*is_zombie) = found && zombie ;
+    return (found) ;
+}
+
+#endif
+
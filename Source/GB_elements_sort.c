@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+// GB_elements_sort: check and sort a list of tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The tuples (I(k),J(k)) for k = 0:nvals-1 are checked, converted into the
+// (i,j) tuples of the CSR/CSC format of C, where j is the vector index and i
+// is the index within the vector, and then sorted by (j,i,k).  The K_work
+// array holds the original position k of each tuple in the sorted list, so
+// that its value X(k) can be found.  If the tuples are already sorted on
+// input, no sort is done and K_work is returned as NULL, which implicitly
+// means K_work [t] = t.  Duplicates are kept, and appear in the order given.
+
+#include "GB_elements.h"
+#include "GB_sort.h"
+
+#define GB_FREE_ALL                                                  \
+{                                                                    \
+    GB_FREE_WERK (I_work_handle, *I_work_size_handle, Context) ;     \
+    GB_FREE_WERK (J_work_handle, *J_work_size_handle, Context) ;     \
+    GB_FREE_WERK (K_work_handle, *K_work_size_handle, Context) ;     \
+}
+
+GrB_Info GB_elements_sort       // check and sort a list of tuples
+(
+    // output:
+    int64_t **I_work_handle,    // index of each tuple within its vector
+    size_t *I_work_size_handle,
+    int64_t **J_work_handle,    // vector index of each tuple
+    size_t *J_work_size_handle,
+    int64_t **K_work_handle,    // original position of each tuple, or NULL
+    size_t *K_work_size_handle,
+    // input:
+    const GrB_Matrix C,         // matrix the tuples refer to
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices (NULL if C is a GrB_Vector)
+    const int64_t nvals,        // number of tuples
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (I != NULL) ;
+    ASSERT (J != NULL || C->vdim == 1) ;
+    (*I_work_handle) = NULL ;
+    (*J_work_handle) = NULL ;
+    (*K_work_handle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict I_work = GB_MALLOC_WERK (nvals, int64_t,
+        I_work_size_handle) ;
+    int64_t *restrict J_work = GB_MALLOC_WERK (nvals, int64_t,
+        J_work_size_handle) ;
+    (*I_work_handle) = I_work ;
+    (*J_work_handle) = J_work ;
+    if (I_work == NULL || J_work == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the tuples into the workspace and check the indices
+    //--------------------------------------------------------------------------
+
+    const bool is_csc = C->is_csc ;
+    const int64_t vlen = C->vlen ;
+    const int64_t vdim = C->vdim ;
+    const GrB_Index *I_input = (is_csc || J == NULL) ? I : J ;
+    const GrB_Index *J_input = (is_csc || J == NULL) ? J : I ;
+
+    int64_t k, nbad = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nbad)
+    for (k = 0 ; k < nvals ; k++)
+    {
+        GrB_Index i = I_input [k] ;
+        GrB_Index j = (J_input == NULL) ? 0 : J_input [k] ;
+        nbad += (i >= vlen || j >= vdim) ;
+        I_work [k] = i ;
+        J_work [k] = j ;
+    }
+
+    if (nbad > 0)
+    {
+        // report the first invalid index
+        for (k = 0 ; k < nvals ; k++)
+        {
+            GrB_Index row = I [k] ;
+            GrB_Index col = (J == NULL) ? 0 : J [k] ;
+            if (row >= GB_NROWS (C))
+            {
+                GB_FREE_ALL ;
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Row index " GBu " out of range; must be < " GBd,
+                    row, GB_NROWS (C)) ;
+            }
+            if (col >= GB_NCOLS (C))
+            {
+                GB_FREE_ALL ;
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Column index " GBu " out of range; must be < " GBd,
+                    col, GB_NCOLS (C)) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // check if the tuples are already sorted
+    //--------------------------------------------------------------------------
+
+    bool known_sorted = true ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:known_sorted)
+    for (k = 1 ; k < nvals ; k++)
+    {
+        int64_t jlast = J_work [k-1] ;
+        int64_t j = J_work [k] ;
+        known_sorted = known_sorted &&
+            ((jlast < j) || (jlast == j && I_work [k-1] <= I_work [k])) ;
+    }
+
+    if (known_sorted)
+    {
+        // no need to sort; K_work is implicitly K_work [t] = t
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the tuples
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict K_work = GB_MALLOC_WERK (nvals, int64_t,
+        K_work_size_handle) ;
+    (*K_work_handle) = K_work ;
+    if (K_work == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // k is unique, so the sort is stable and duplicates keep their order
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < nvals ; k++)
+    {
+        K_work [k] = k ;
+    }
+
+    if (vdim > 1)
+    {
+        // sort a set of (j,i,k) tuples
+        info = GB_msort_3b (J_work, I_work, K_work, nvals, nthreads,
+            Context) ;
+    }
+    else
+    {
+        // sort a set of (i,k) tuples; all j are zero
+        info = GB_msort_2b (I_work, K_work, nvals, nthreads, Context) ;
+    }
+
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory in GB_msort_*
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
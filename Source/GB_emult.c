@@ -33,12 +33,12 @@
 #include "GB_emult.h"
 #include "GB_add.h"
 
-#define GB_FREE_WORK                            \
-{                                               \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
-    GB_FREE_WERK (&C_to_M, C_to_M_size) ;       \
-    GB_FREE_WERK (&C_to_A, C_to_A_size) ;       \
-    GB_FREE_WERK (&C_to_B, C_to_B_size) ;       \
+#define GB_FREE_WORK                                     \
+{                                                        \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
+    GB_FREE_WERK (&C_to_M, C_to_M_size, Context) ;       \
+    GB_FREE_WERK (&C_to_A, C_to_A_size, Context) ;       \
+    GB_FREE_WERK (&C_to_B, C_to_B_size, Context) ;       \
 }
 
 #define GB_FREE_ALL             \
@@ -436,7 +436,7 @@ GrB_Info GB_emult_01_phase0     // find vectors in C for C=A.*B or C<M>=A.*B
         if (C_to_A == NULL)
         { 
             // out of memory
-            GB_FREE_WERK (&C_to_M, C_to_M_size) ;
+            GB_FREE_WERK (&C_to_M, C_to_M_size, Context) ;
             return (GrB_OUT_OF_MEMORY) ;
         }
 
@@ -466,8 +466,8 @@ GrB_Info GB_emult_01_phase0     // find vectors in C for C=A.*B or C<M>=A.*B
         if (C_to_B == NULL)
         { 
             // out of memory
-            GB_FREE_WERK (&C_to_M, C_to_M_size) ;
-            GB_FREE_WERK (&C_to_A, C_to_A_size) ;
+            GB_FREE_WERK (&C_to_M, C_to_M_size, Context) ;
+            GB_FREE_WERK (&C_to_A, C_to_A_size, Context) ;
             return (GrB_OUT_OF_MEMORY) ;
         }
 
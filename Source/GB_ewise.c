@@ -191,6 +191,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         MT = GB_clear_static_header (&MT_header) ;
         GB_OK (GB_transpose (&MT, GrB_BOOL, T_is_csc, M,    // MT static
             NULL, NULL, NULL, false, Context)) ;
+        GB_stats_transpose (C) ;
         M1 = MT ;
     }
 
@@ -206,6 +207,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         GBURBLE ("(A transpose) ") ;
         GB_OK (GB_transpose (&AT, NULL, T_is_csc, A,        // AT static
             NULL, NULL, NULL, false, Context)) ;
+        GB_stats_transpose (C) ;
         A1 = AT ;
         ASSERT_MATRIX_OK (AT, "AT from transpose", GB0) ;
     }
@@ -222,6 +224,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         GBURBLE ("(B transpose) ") ;
         GB_OK (GB_transpose (&BT, NULL, T_is_csc, B,        // BT static
             NULL, NULL, NULL, false, Context)) ;
+        GB_stats_transpose (C) ;
         B1 = BT ;
     }
 
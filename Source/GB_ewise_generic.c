@@ -94,6 +94,7 @@ void GB_ewise_generic       // generic ewise
     const bool flipxy = (ewise_method == GB_EMULT_METHOD_02B) ;
 
     const GxB_binary_function fop = op->function ; // NULL if op positional
+    GB_BINOP_VECTOR (fop, op) ;     // for an op on vector-valued entries
     const size_t csize = ctype->size ;
     const size_t asize = A->type->size ;
     const size_t bsize = B->type->size ;
@@ -223,25 +224,25 @@ void GB_ewise_generic       // generic ewise
         {
             // handle flipxy
             #undef  GB_BINOP
-            #define GB_BINOP(cij, aij, bij, i, j)   \
-                GB_void z [GB_VLA(zsize)] ;         \
-                if (flipxy)                         \
-                {                                   \
-                    fop (z, bij, aij) ;             \
-                }                                   \
-                else                                \
-                {                                   \
-                    fop (z, aij, bij) ;             \
-                }                                   \
+            #define GB_BINOP(cij, aij, bij, i, j)       \
+                GB_void z [GB_VLA(zsize)] ;             \
+                if (flipxy)                             \
+                {                                       \
+                    GB_BINOP_CALL (fop, z, bij, aij) ;  \
+                }                                       \
+                else                                    \
+                {                                       \
+                    GB_BINOP_CALL (fop, z, aij, bij) ;  \
+                }                                       \
                 cast_Z_to_C (cij, z, csize) ;
             #include "GB_emult_02_template.c"
         }
         else if (ewise_method == GB_EMULT_METHOD_03)
         {
             #undef  GB_BINOP
-            #define GB_BINOP(cij, aij, bij, i, j)   \
-                GB_void z [GB_VLA(zsize)] ;         \
-                fop (z, aij, bij) ;                 \
+            #define GB_BINOP(cij, aij, bij, i, j)       \
+                GB_void z [GB_VLA(zsize)] ;             \
+                GB_BINOP_CALL (fop, z, aij, bij) ;      \
                 cast_Z_to_C (cij, z, csize) ;
             #include "GB_emult_03_template.c"
         }
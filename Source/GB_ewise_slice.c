@@ -15,16 +15,16 @@
 // M, A, B: any sparsity structure (hypersparse, sparse, bitmap, or full).
 // C: constructed as sparse or hypersparse in the caller.
 
-#define GB_FREE_WORK                            \
-{                                               \
-    GB_WERK_POP (Coarse, int64_t) ;             \
-    GB_FREE_WERK (&Cwork, Cwork_size) ;         \
+#define GB_FREE_WORK                                     \
+{                                                        \
+    GB_WERK_POP (Coarse, int64_t) ;                      \
+    GB_FREE_WERK (&Cwork, Cwork_size, Context) ;         \
 }
 
-#define GB_FREE_ALL                             \
-{                                               \
-    GB_FREE_WORK ;                              \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
+#define GB_FREE_ALL                                      \
+{                                                        \
+    GB_FREE_WORK ;                                       \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
 }
 
 #include "GB.h"
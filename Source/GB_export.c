@@ -110,6 +110,8 @@ GrB_Info GB_export      // export a matrix in any format
     #ifdef GB_DEBUG
     GB_Global_memtable_remove ((*A)->x) ;
     #endif
+    GB_Global_memory_inuse_add (GB_MEMORY_STORAGE,
+        -((int64_t) (*A)->x_size)) ;
     (*Ax) = (*A)->x ; (*A)->x = NULL ;
     (*Ax_size) = (*A)->x_size ;
 
@@ -122,6 +124,8 @@ GrB_Info GB_export      // export a matrix in any format
             #ifdef GB_DEBUG
             GB_Global_memtable_remove ((*A)->h) ;
             #endif
+            GB_Global_memory_inuse_add (GB_MEMORY_STORAGE,
+                -((int64_t) (*A)->h_size)) ;
             (*Ah) = (GrB_Index *) ((*A)->h) ; (*A)->h = NULL ;
             (*Ah_size) = (*A)->h_size ;
 
@@ -141,6 +145,8 @@ GrB_Info GB_export      // export a matrix in any format
                 #ifdef GB_DEBUG
                 GB_Global_memtable_remove ((*A)->p) ;
                 #endif
+                GB_Global_memory_inuse_add (GB_MEMORY_STORAGE,
+                    -((int64_t) (*A)->p_size)) ;
                 (*Ap) = (GrB_Index *) ((*A)->p) ; (*A)->p = NULL ;
                 (*Ap_size) = (*A)->p_size ;
             }
@@ -149,6 +155,8 @@ GrB_Info GB_export      // export a matrix in any format
             #ifdef GB_DEBUG
             GB_Global_memtable_remove ((*A)->i) ;
             #endif
+            GB_Global_memory_inuse_add (GB_MEMORY_STORAGE,
+                -((int64_t) (*A)->i_size)) ;
             (*Ai) = (GrB_Index *) ((*A)->i) ; (*A)->i = NULL ;
             (*Ai_size) = (*A)->i_size ;
             break ;
@@ -160,6 +168,8 @@ GrB_Info GB_export      // export a matrix in any format
             #ifdef GB_DEBUG
             GB_Global_memtable_remove ((*A)->b) ;
             #endif
+            GB_Global_memory_inuse_add (GB_MEMORY_STORAGE,
+                -((int64_t) (*A)->b_size)) ;
             (*Ab) = (*A)->b ; (*A)->b = NULL ;
             (*Ab_size) = (*A)->b_size ;
 
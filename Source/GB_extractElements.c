@@ -0,0 +1,265 @@
+//------------------------------------------------------------------------------
+// GB_extractElements: X(k) = A(I(k),J(k)) for k = 0:nvals-1
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Extracts a list of entries from A, with the same result as calling
+// GrB_*_extractElement for each tuple, typecasting from the type of A to the
+// type of X, as needed.  Not user-callable; does the work for
+// GxB_*_extractElements_*.
+
+// If A(I(k),J(k)) is present, X(k) is set to its value and Present [k] is
+// true.  Otherwise, X(k) is not modified and Present [k] is false.  Present
+// may be NULL.  Returns GrB_SUCCESS if all entries are present, or
+// GrB_NO_VALUE if any are not.
+
+// The list is not sorted, since A is not modified.  Each task handles a
+// contiguous part of the list, and looks up a vector of A only when the
+// vector differs from that of the prior tuple.  Zombies and pending tuples are
+// handled as in GrB_*_extractElement.
+
+#include "GB_elements.h"
+#include "GB_Pending.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_extractElements     // X(k) = A(I(k),J(k)) for k = 0:nvals-1
+(
+    void *X,                    // extracted values
+    bool *Present,              // Present [k] true if A(I(k),J(k)) present
+    const GB_Type_code xcode,   // type of X
+    const GrB_Matrix A,         // matrix to extract entries from
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices (NULL if A is a GrB_Vector)
+    const GrB_Index nvals,      // number of tuples
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (A != NULL) ;
+    GB_RETURN_IF_NULL (X) ;
+    GB_RETURN_IF_NULL (I) ;
+    ASSERT (xcode <= GB_UDT_code) ;
+
+    // xcode and A must be compatible
+    GrB_Type atype = A->type ;
+    GB_Type_code acode = atype->code ;
+    if (!GB_code_compatible (xcode, acode))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Entries of type [%s]\n"
+            "cannot be typecast to output values of type [%s]",
+            atype->name, GB_code_string (xcode)) ;
+    }
+
+    if (nvals > GxB_INDEX_MAX)
+    {
+        // problem too large
+        GB_ERROR (GrB_INVALID_VALUE,
+            "Problem too large: nvals " GBu " exceeds " GBu,
+            nvals, GxB_INDEX_MAX) ;
+    }
+
+    if (nvals == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, (int64_t) nvals) ;
+
+    //--------------------------------------------------------------------------
+    // check the indices
+    //--------------------------------------------------------------------------
+
+    const GrB_Index nrows = GB_NROWS (A) ;
+    const GrB_Index ncols = GB_NCOLS (A) ;
+    int64_t k, nbad = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nbad)
+    for (k = 0 ; k < (int64_t) nvals ; k++)
+    {
+        nbad += (I [k] >= nrows || (J != NULL && J [k] >= ncols)) ;
+    }
+
+    if (nbad > 0)
+    {
+        // report the first invalid index
+        for (k = 0 ; k < (int64_t) nvals ; k++)
+        {
+            if (I [k] >= nrows)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Row index " GBu " out of range; must be < " GBd,
+                    I [k], nrows) ;
+            }
+            if (J != NULL && J [k] >= ncols)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Column index " GBu " out of range; must be < " GBd,
+                    J [k], ncols) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // unjumble A, and assemble any pending tuples that are slow to search
+    //--------------------------------------------------------------------------
+
+    if (A->jumbled || GB_DEFERRED (A) || !GB_Pending_searchable (A))
+    {
+        GB_OK (GB_Matrix_wait (A, "A", Context)) ;
+    }
+
+    ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (GB_PENDING_OK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // get A and the typecasting functions
+    //--------------------------------------------------------------------------
+
+    const bool is_csc = A->is_csc ;
+    const GrB_Index *I_input = (is_csc || J == NULL) ? I : J ;
+    const GrB_Index *J_input = (is_csc || J == NULL) ? J : I ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int8_t  *restrict Ab = A->b ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const int64_t avlen = A->vlen ;
+    const int64_t anvec = A->nvec ;
+    const int64_t nzombies = A->nzombies ;
+    const bool A_has_entries = (A->nzmax > 0) ;
+    const size_t asize = atype->size ;
+    const size_t xsize = GB_code_type (xcode, atype)->size ;
+    GB_void *restrict Xx = (GB_void *) X ;
+    GB_cast_function cast_A_to_X = GB_cast_factory (xcode, acode) ;
+
+    // pending tuples are typecast to the type of A, as GB_Matrix_wait would
+    // do, and then to the type of X
+    GB_Pending Pending = A->Pending ;
+    GB_cast_function cast_P_to_A = NULL ;
+    if (Pending != NULL && Pending->type != atype)
+    {
+        cast_P_to_A = GB_cast_factory (acode, Pending->type->code) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // extract the entries
+    //--------------------------------------------------------------------------
+
+    int64_t nmissing = 0 ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:nmissing)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t tstart, tend ;
+        GB_PARTITION (tstart, tend, (int64_t) nvals, tid, ntasks) ;
+        int64_t jlast = -1, pA_start = 0, pA_end = 0 ;
+        for (int64_t t = tstart ; t < tend ; t++)
+        {
+
+            //------------------------------------------------------------------
+            // find A(i,j)
+            //------------------------------------------------------------------
+
+            int64_t i = I_input [t] ;
+            int64_t j = (J_input == NULL) ? 0 : J_input [t] ;
+            int64_t pA = -1 ;
+            bool found = false ;
+
+            if (!A_has_entries)
+            {
+                // A has no entries, only pending tuples (if any)
+                found = false ;
+            }
+            else if (Ap != NULL)
+            {
+                // A is sparse or hypersparse; find the vector A(:,j) only if
+                // it differs from the vector of the prior tuple
+                if (j != jlast)
+                {
+                    int64_t kleft = 0 ;
+                    GB_lookup (Ah != NULL, Ah, Ap, avlen, &kleft, anvec-1, j,
+                        &pA_start, &pA_end) ;
+                    jlast = j ;
+                }
+                int64_t pleft = pA_start ;
+                int64_t pright = pA_end - 1 ;
+                bool is_zombie ;
+                GB_BINARY_SEARCH_ZOMBIE (i, Ai, pleft, pright, found,
+                    nzombies, is_zombie) ;
+                if (found && is_zombie)
+                {
+                    // A(i,j) has been deleted.  It cannot also be pending.
+                    nmissing++ ;
+                    if (Present != NULL) Present [t] = false ;
+                    continue ;
+                }
+                pA = pleft ;
+            }
+            else
+            {
+                // A is bitmap or full
+                pA = i + j * avlen ;
+                found = (Ab == NULL) ? true : (Ab [pA] == 1) ;
+            }
+
+            //------------------------------------------------------------------
+            // extract the entry
+            //------------------------------------------------------------------
+
+            if (found)
+            {
+                // typecast the value from A into X(t)
+                cast_A_to_X (Xx +(t*xsize), Ax +(pA*asize), asize) ;
+            }
+            else if (Pending != NULL)
+            {
+                // look for A(i,j) in the list of pending tuples
+                int64_t p = GB_Pending_lookup (Pending, i, j) ;
+                found = (p >= 0) ;
+                if (found)
+                {
+                    GB_void *px = ((GB_void *) Pending->x) + (p*Pending->size);
+                    GB_void aij [GB_VLA(asize)] ;
+                    if (cast_P_to_A != NULL)
+                    {
+                        cast_P_to_A (aij, px, Pending->size) ;
+                        px = aij ;
+                    }
+                    cast_A_to_X (Xx +(t*xsize), px, asize) ;
+                }
+            }
+
+            if (!found) nmissing++ ;
+            if (Present != NULL) Present [t] = found ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    return ((nmissing > 0) ? GrB_NO_VALUE : GrB_SUCCESS) ;
+}
+
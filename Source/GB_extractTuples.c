@@ -18,10 +18,10 @@
 
 #include "GB.h"
 
-#define GB_FREE_ALL                             \
-{                                               \
-    GB_FREE_WERK (&Ap, Ap_size) ;               \
-    GB_FREE_WERK (&X_bitmap, X_bitmap_size) ;   \
+#define GB_FREE_ALL                                      \
+{                                                        \
+    GB_FREE_WERK (&Ap, Ap_size, Context) ;               \
+    GB_FREE_WERK (&X_bitmap, X_bitmap_size, Context) ;   \
 }
 
 GrB_Info GB_extractTuples       // extract all tuples from a matrix
@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// GB_huge_page: advise the OS to back a large block with huge pages
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Random access to a large array (the Gustavson workspace Hf and Hx in saxpy3,
+// hash tables, bitmaps, or Ai and Ax themselves) touches a different 4 KB page
+// on nearly every access, and so it misses in the TLB.  Backing the array with
+// 2 MB transparent huge pages reduces the number of TLB entries it needs by a
+// factor of 512.  If the kernel is configured with
+// /sys/kernel/mm/transparent_hugepage/enabled set to "madvise" (a common
+// default), only regions marked with madvise (MADV_HUGEPAGE) are backed this
+// way.
+
+// GB_huge_page_advise is called by GB_malloc_memory, GB_calloc_memory, and
+// GB_realloc_memory for each block freshly obtained from the malloc or realloc
+// functions, if GxB_HUGE_PAGE is set to a size of at least 2 MB and the block
+// is at least that large.  The block cannot be realigned, since it must be
+// passed back to the user-provided free function as-is.  Instead, the part of
+// the block from its first to its last 2 MB boundary is advised, which loses
+// at most 4 MB at the two ends of the block.  The block must be advised before
+// it is first touched (by GB_numa_place or GB_memset), so that its pages are
+// created as huge pages.
+
+// Blocks returned to the free_pool keep the advice.  To reuse large huge-page
+// blocks across calls, instead of returning them to the OS, set the free_pool
+// limit for their sizes with GxB_set (GxB_MEMORY_POOL, ...).
+
+#if defined ( __linux__ ) && !defined ( _DEFAULT_SOURCE )
+// MADV_HUGEPAGE is not defined by <sys/mman.h> with -std=c11 alone
+#define _DEFAULT_SOURCE
+#endif
+
+#include "GB.h"
+
+#if defined ( __linux__ )
+#include <sys/mman.h>
+#endif
+
+#if defined ( MADV_HUGEPAGE )
+#define GB_HAVE_MADV_HUGEPAGE 1
+#else
+#define GB_HAVE_MADV_HUGEPAGE 0
+#endif
+
+void GB_huge_page_advise
+(
+    void *p,                // block just obtained from malloc or realloc
+    size_t size             // size of the block, in bytes
+)
+{
+
+    #if GB_HAVE_MADV_HUGEPAGE
+
+    //--------------------------------------------------------------------------
+    // check the size of the block
+    //--------------------------------------------------------------------------
+
+    int64_t size_min = GB_Global_huge_page_get ( ) ;
+    if (p == NULL || size_min < GB_HUGE_PAGE_SIZE || size < (size_t) size_min)
+    {
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // advise the part of the block from its first to last 2 MB boundary
+    //--------------------------------------------------------------------------
+
+    uintptr_t first = ((uintptr_t) p + GB_HUGE_PAGE_SIZE - 1)
+        & ~((uintptr_t) GB_HUGE_PAGE_SIZE - 1) ;
+    uintptr_t last  = ((uintptr_t) p + size)
+        & ~((uintptr_t) GB_HUGE_PAGE_SIZE - 1) ;
+    if (last > first)
+    {
+        // this is only a hint; if it fails, the block is left as-is
+        madvise ((void *) first, (size_t) (last - first), MADV_HUGEPAGE) ;
+    }
+
+    #endif
+}
+
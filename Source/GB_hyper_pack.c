@@ -49,6 +49,15 @@ GrB_Matrix GB_hyper_pack            // return C
     C->i_shallow = true ;
     C->x_shallow = true ;
 
+    // C does not hold a reference to any content A shares with a snapshot
+    C->shared = NULL ;
+
+    // C does not own the instrumentation counters of A
+    C->stats = NULL ;
+
+    // C has different vectors than A, so the summary of A does not apply
+    GB_profile_invalidate (C) ;
+
     // C reduces in dimension to the # of vectors in A
     C->vdim = C->nvec ;
     C->plen = C->nvec ;
@@ -19,9 +19,9 @@
 #include "GB_ij.h"
 #include "GB_sort.h"
 
-#define GB_FREE_WORK                    \
-{                                       \
-    GB_FREE_WERK (&Work, Work_size) ;   \
+#define GB_FREE_WORK                             \
+{                                                \
+    GB_FREE_WERK (&Work, Work_size, Context) ;   \
 }
 
 GrB_Info GB_ijsort
@@ -108,7 +108,8 @@ GrB_Info GB_ijsort
     // sort [I1 I1k]
     //--------------------------------------------------------------------------
 
-    info = GB_msort_2b ((int64_t *) I1, (int64_t *) I1k, ni, nthreads) ;
+    info = GB_msort_2b ((int64_t *) I1, (int64_t *) I1k, ni, nthreads,
+        Context) ;
     if (info != GrB_SUCCESS)
     { 
         // out of memory
@@ -149,8 +150,8 @@ GrB_Info GB_ijsort
     { 
         // out of memory
         GB_FREE_WORK ;
-        GB_FREE_WERK (&I2, I2_size) ;
-        GB_FREE_WERK (&I2k, I2k_size) ;
+        GB_FREE_WERK (&I2, I2_size, Context) ;
+        GB_FREE_WERK (&I2k, I2k_size, Context) ;
         return (GrB_OUT_OF_MEMORY) ;
     }
 
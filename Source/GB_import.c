@@ -222,6 +222,7 @@ GrB_Info GB_import      // import a matrix in any format
             #ifdef GB_DEBUG
             GB_Global_memtable_add ((*A)->h, (*A)->h_size) ;
             #endif
+            GB_Global_memory_inuse_add (GB_MEMORY_STORAGE, (*A)->h_size) ;
 
         case GxB_SPARSE : 
             (*A)->jumbled = jumbled ;   // import jumbled status
@@ -242,6 +243,7 @@ GrB_Info GB_import      // import a matrix in any format
                 #ifdef GB_DEBUG
                 GB_Global_memtable_add ((*A)->p, (*A)->p_size) ;
                 #endif
+                GB_Global_memory_inuse_add (GB_MEMORY_STORAGE, (*A)->p_size) ;
             }
 
             // import A->i
@@ -250,6 +252,7 @@ GrB_Info GB_import      // import a matrix in any format
             #ifdef GB_DEBUG
             GB_Global_memtable_add ((*A)->i, (*A)->i_size) ;
             #endif
+            GB_Global_memory_inuse_add (GB_MEMORY_STORAGE, (*A)->i_size) ;
             break ;
 
         case GxB_BITMAP : 
@@ -262,6 +265,7 @@ GrB_Info GB_import      // import a matrix in any format
             #ifdef GB_DEBUG
             GB_Global_memtable_add ((*A)->b, (*A)->b_size) ;
             #endif
+            GB_Global_memory_inuse_add (GB_MEMORY_STORAGE, (*A)->b_size) ;
             break ;
 
         case GxB_FULL : 
@@ -279,6 +283,7 @@ GrB_Info GB_import      // import a matrix in any format
         #ifdef GB_DEBUG
         GB_Global_memtable_add ((*A)->x, (*A)->x_size) ;
         #endif
+        GB_Global_memory_inuse_add (GB_MEMORY_STORAGE, (*A)->x_size) ;
     }
 
     //--------------------------------------------------------------------------
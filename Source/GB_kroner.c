@@ -23,6 +23,7 @@
 // accounted for in the parallel load-balancing.
 
 #include "GB_kron.h"
+#include "GB_binop.h"
 
 #define GB_FREE_WORK        \
 {                           \
@@ -164,6 +165,7 @@ GrB_Info GB_kroner                  // C = kron (A,B)
     const int64_t csize = C->type->size ;
 
     GxB_binary_function fmult = op->function ;
+    GB_BINOP_VECTOR (fmult, op) ;
     GB_Opcode opcode = op->opcode ;
     bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
     GB_cast_function cast_A = NULL, cast_B = NULL ;
@@ -331,7 +333,7 @@ GrB_Info GB_kroner                  // C = kron (A,B)
                 else
                 { 
                     // standard binary operator
-                    fmult (Cx +(pC*csize), awork, bwork) ;
+                    GB_BINOP_CALL (fmult, Cx +(pC*csize), awork, bwork) ;
                 }
                 pC++ ;
             }
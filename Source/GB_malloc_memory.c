@@ -7,7 +7,10 @@
 
 //------------------------------------------------------------------------------
 
-// A wrapper for malloc.  Space is not initialized.
+// A wrapper for malloc.  Space is not initialized.  A large block newly
+// obtained from malloc is backed with huge pages if GxB_HUGE_PAGE is set (see
+// GB_huge_page.c), and placed on the NUMA nodes according to the
+// GxB_NUMA_POLICY (see GB_numa.c).
 
 #include "GB.h"
 
@@ -57,6 +60,10 @@ static inline void *GB_malloc_helper
             // success
             GB_Global_nmalloc_increment ( ) ;
         }
+
+        // advise huge pages and place a large block on the NUMA nodes
+        GB_huge_page_advise (p, *size) ;
+        GB_numa_place (p, *size, false, GB_Context_nthreads_max_get ( )) ;
 //      printf ("hard malloc %p %ld\n", p, *size) ;
     }
 //  GB_Global_free_pool_dump (2) ; GB_Global_memtable_dump ( ) ;
@@ -249,8 +249,8 @@ GrB_Info GB_mask                // C<M> = Z
         //----------------------------------------------------------------------
 
         // delete any lingering zombies and assemble any pending tuples
-        GB_MATRIX_WAIT (M) ;        // also sort M if jumbled
-        GB_MATRIX_WAIT (Z) ;        // also sort Z if jumbled
+        GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (M) ;
+        GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (Z) ;
 
         // R has the same CSR/CSC format as C_result.  It is hypersparse if
         // both C and Z are hypersparse.
@@ -303,9 +303,17 @@ GrB_Info GB_mask                // C<M> = Z
         ASSERT (!GB_IS_BITMAP (C)) ;
         ASSERT (!GB_IS_FULL (C)) ;
 
+        // If R is bitmap, M and Z are scattered into R, and can be jumbled.
+        // Otherwise they are merged with C, and must be sorted.
+        if (GB_masker_sparsity (C, M, Mask_comp, Z) != GxB_BITMAP)
+        { 
+            GB_MATRIX_WAIT_IF_JUMBLED (M) ;
+            GB_MATRIX_WAIT_IF_JUMBLED (Z) ;
+        }
+
         // no more zombies or pending tuples in M or C
         ASSERT (!GB_PENDING (M)) ;
-        ASSERT (!GB_JUMBLED (M)) ;
+        ASSERT (GB_JUMBLED_OK (M)) ;
         ASSERT (!GB_ZOMBIES (M)) ;
         ASSERT (!GB_PENDING (C)) ;
         ASSERT (!GB_JUMBLED (C)) ;
@@ -73,7 +73,7 @@ GrB_Info GB_masker          // R = masker (C, M, Z)
 
     ASSERT_MATRIX_OK (M, "M for masker", GB0) ;
     ASSERT (!GB_PENDING (M)) ;
-    ASSERT (!GB_JUMBLED (M)) ;
+    ASSERT (GB_JUMBLED_OK (M)) ;
     ASSERT (!GB_ZOMBIES (M)) ;
 
     ASSERT_MATRIX_OK (C, "C for masker", GB0) ;
@@ -83,7 +83,7 @@ GrB_Info GB_masker          // R = masker (C, M, Z)
 
     ASSERT_MATRIX_OK (Z, "Z for masker", GB0) ;
     ASSERT (!GB_PENDING (Z)) ;
-    ASSERT (!GB_JUMBLED (Z)) ;
+    ASSERT (GB_JUMBLED_OK (Z)) ;
     ASSERT (!GB_ZOMBIES (Z)) ;
 
     ASSERT (!GB_IS_BITMAP (C)) ;    // GB_masker not used if C is bitmap
@@ -98,6 +98,10 @@ GrB_Info GB_masker          // R = masker (C, M, Z)
 
     int R_sparsity = GB_masker_sparsity (C, M, Mask_comp, Z) ;
 
+    // M and Z can be jumbled only if R is bitmap
+    ASSERT (GB_IMPLIES (R_sparsity != GxB_BITMAP,
+        !GB_JUMBLED (M) && !GB_JUMBLED (Z))) ;
+
     //--------------------------------------------------------------------------
     // initializations
     //--------------------------------------------------------------------------
@@ -165,9 +169,9 @@ GrB_Info GB_masker          // R = masker (C, M, Z)
         { 
             // out of memory; free everything allocated by GB_add_phase0
             GB_FREE (&Rh, Rh_size) ;
-            GB_FREE_WERK (&R_to_M, R_to_M_size) ;
-            GB_FREE_WERK (&R_to_C, R_to_C_size) ;
-            GB_FREE_WERK (&R_to_Z, R_to_Z_size) ;
+            GB_FREE_WERK (&R_to_M, R_to_M_size, Context) ;
+            GB_FREE_WERK (&R_to_C, R_to_C_size, Context) ;
+            GB_FREE_WERK (&R_to_Z, R_to_Z_size, Context) ;
             return (info) ;
         }
 
@@ -184,11 +188,11 @@ GrB_Info GB_masker          // R = masker (C, M, Z)
         if (info != GrB_SUCCESS)
         { 
             // out of memory; free everything allocated by GB_add_phase0
-            GB_FREE_WERK (&TaskList, TaskList_size) ;
+            GB_FREE_WERK (&TaskList, TaskList_size, Context) ;
             GB_FREE (&Rh, Rh_size) ;
-            GB_FREE_WERK (&R_to_M, R_to_M_size) ;
-            GB_FREE_WERK (&R_to_C, R_to_C_size) ;
-            GB_FREE_WERK (&R_to_Z, R_to_Z_size) ;
+            GB_FREE_WERK (&R_to_M, R_to_M_size, Context) ;
+            GB_FREE_WERK (&R_to_C, R_to_C_size, Context) ;
+            GB_FREE_WERK (&R_to_Z, R_to_Z_size, Context) ;
             return (info) ;
         }
 
@@ -226,10 +230,10 @@ GrB_Info GB_masker          // R = masker (C, M, Z)
     // if successful, Rh and Rp must not be freed; they are now R->h and R->p
 
     // free workspace
-    GB_FREE_WERK (&TaskList, TaskList_size) ;
-    GB_FREE_WERK (&R_to_M, R_to_M_size) ;
-    GB_FREE_WERK (&R_to_C, R_to_C_size) ;
-    GB_FREE_WERK (&R_to_Z, R_to_Z_size) ;
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;
+    GB_FREE_WERK (&R_to_M, R_to_M_size, Context) ;
+    GB_FREE_WERK (&R_to_C, R_to_C_size, Context) ;
+    GB_FREE_WERK (&R_to_Z, R_to_Z_size, Context) ;
 
     if (info != GrB_SUCCESS)
     { 
@@ -76,7 +76,7 @@ GrB_Info GB_masker_phase2           // phase2 for R = masker (C,M,Z)
 
     ASSERT_MATRIX_OK (M, "M for mask phase2", GB0) ;
     ASSERT (!GB_ZOMBIES (M)) ; 
-    ASSERT (!GB_JUMBLED (M)) ;
+    ASSERT (GB_IMPLIES (R_sparsity != GxB_BITMAP, !GB_JUMBLED (M))) ;
     ASSERT (!GB_PENDING (M)) ; 
 
     ASSERT_MATRIX_OK (C, "C for mask phase2", GB0) ;
@@ -86,7 +86,7 @@ GrB_Info GB_masker_phase2           // phase2 for R = masker (C,M,Z)
 
     ASSERT_MATRIX_OK (Z, "Z for mask phase2", GB0) ;
     ASSERT (!GB_ZOMBIES (Z)) ; 
-    ASSERT (!GB_JUMBLED (Z)) ;
+    ASSERT (GB_IMPLIES (R_sparsity != GxB_BITMAP, !GB_JUMBLED (Z))) ;
     ASSERT (!GB_PENDING (Z)) ; 
 
     ASSERT (!GB_IS_BITMAP (C)) ;        // not used if C is bitmap
@@ -370,6 +370,8 @@ bool GB_matlab_helper9  // true if successful, false if out of memory
     GB_Global_memtable_remove (List) ;
     GB_Global_memtable_remove (Degree) ;
     #endif
+    GB_Global_memory_inuse_add (GB_MEMORY_STORAGE,
+        -((int64_t) (List_size + Degree_size))) ;
 
     int64_t *Ah = A->h ;
     int64_t *Ap = A->p ;
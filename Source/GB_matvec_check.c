@@ -111,6 +111,10 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     { 
         GBPR0 (" (jumbled)") ;
     }
+    if (GB_DEFERRED (A))
+    { 
+        GBPR0 (" (deferred %s)", A->deferred_op->name) ;
+    }
     GBPR0 (" %s\n", A->is_csc ? "by col" : "by row") ;
 
     #if GB_DEVELOPER
@@ -388,6 +392,21 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         return (GrB_INVALID_OBJECT) ;
     }
 
+    //--------------------------------------------------------------------------
+    // check the deferred operator, if any
+    //--------------------------------------------------------------------------
+
+    if (GB_DEFERRED (A))
+    {
+        if (A->deferred_op->magic != GB_MAGIC || A->deferred_type == NULL
+            || A->deferred_op->ztype != A->type
+            || !GB_Type_compatible (A->deferred_type, A->deferred_op->xtype))
+        { 
+            GBPR0 ("  %s has an invalid deferred operator\n", kind) ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // report shallow structure
     //--------------------------------------------------------------------------
@@ -646,8 +665,24 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
                 else if (A->x != NULL)
                 { 
                     GB_void *Ax = (GB_void *) A->x ;
-                    info = GB_entry_check (A->type, Ax +(p * (A->type->size)),
-                        pr, f) ;
+                    if (GB_DEFERRED (A))
+                    { 
+                        // A->x has type A->deferred_type; print op (A(i,j))
+                        GrB_UnaryOp op = A->deferred_op ;
+                        size_t dsize = A->deferred_type->size ;
+                        GB_void xwork [GB_VLA(op->xtype->size)] ;
+                        GB_void zwork [GB_VLA(op->ztype->size)] ;
+                        GB_cast_function cast_A_to_X = GB_cast_factory
+                            (op->xtype->code, A->deferred_type->code) ;
+                        cast_A_to_X (xwork, Ax +(p * dsize), dsize) ;
+                        op->function (zwork, xwork) ;
+                        info = GB_entry_check (A->type, zwork, pr, f) ;
+                    }
+                    else
+                    { 
+                        info = GB_entry_check (A->type,
+                            Ax +(p * (A->type->size)), pr, f) ;
+                    }
                     if (info != GrB_SUCCESS) return (info) ;
                 }
             }
@@ -69,6 +69,133 @@ void GB_dealloc_memory      // free memory, return to free_pool or free it
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 void GB_free_pool_finalize (void) ;
 
+void GB_memcpy                  // parallel memcpy
+(
+    void *dest,                 // destination
+    const void *src,            // source
+    size_t n,                   // # of bytes to copy
+    int nthreads                // # of threads to use
+) ;
+
+void GB_memset                  // parallel memset
+(
+    void *dest,                 // destination
+    const int c,                // value to to set
+    size_t n,                   // # of bytes to set
+    int nthreads                // # of threads to use
+) ;
+
+//------------------------------------------------------------------------------
+// NUMA placement of large blocks (see GB_numa.c)
+//------------------------------------------------------------------------------
+
+// blocks smaller than this are not placed
+#define GB_NUMA_MIN_SIZE (1024 * 1024)
+
+int GB_numa_nodes (void) ;  // # of NUMA nodes the process may allocate from
+
+bool GB_numa_place          // return true if the block has been cleared
+(
+    void *p,                // block just obtained from malloc
+    size_t size,            // size of the block, in bytes
+    bool clear,             // if true, the block must be set to zero
+    int nthreads_max        // max # of threads to use
+) ;
+
+//------------------------------------------------------------------------------
+// huge pages for large blocks (see GB_huge_page.c)
+//------------------------------------------------------------------------------
+
+#define GB_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+void GB_huge_page_advise
+(
+    void *p,                // block just obtained from malloc or realloc
+    size_t size             // size of the block, in bytes
+) ;
+
+//------------------------------------------------------------------------------
+// malloc/calloc/realloc/free: counted in the global memory usage
+//------------------------------------------------------------------------------
+
+// These functions wrap GB_*_memory, and add the size of each block to the
+// global count of the memory in use (see GB_Global_memory_inuse_add), for
+// either matrix storage (kind is GB_MEMORY_STORAGE) or workspace
+// (GB_MEMORY_WORKSPACE).  A block must be freed with the same kind as it was
+// allocated with.  Blocks in the free_pool are not counted.
+
+static inline void *GB_malloc_counted
+(
+    int kind,                       // GB_MEMORY_STORAGE or GB_MEMORY_WORKSPACE
+    size_t nitems,                  // number of items to allocate
+    size_t size_of_item,            // sizeof each item
+    size_t *size_allocated          // # of bytes actually allocated
+)
+{
+    void *p = GB_malloc_memory (nitems, size_of_item, size_allocated) ;
+    if (p != NULL)
+    { 
+        GB_Global_memory_inuse_add (kind, (int64_t) (*size_allocated)) ;
+    }
+    return (p) ;
+}
+
+static inline void *GB_calloc_counted
+(
+    int kind,                       // GB_MEMORY_STORAGE or GB_MEMORY_WORKSPACE
+    size_t nitems,                  // number of items to allocate
+    size_t size_of_item,            // sizeof each item
+    size_t *size_allocated,         // # of bytes actually allocated
+    GB_Context Context
+)
+{
+    void *p = GB_calloc_memory (nitems, size_of_item, size_allocated,
+        Context) ;
+    if (p != NULL)
+    { 
+        GB_Global_memory_inuse_add (kind, (int64_t) (*size_allocated)) ;
+    }
+    return (p) ;
+}
+
+static inline void *GB_realloc_counted
+(
+    int kind,                       // GB_MEMORY_STORAGE or GB_MEMORY_WORKSPACE
+    size_t nitems_new,              // new number of items in the object
+    size_t nitems_old,              // old number of items in the object
+    size_t size_of_item,            // sizeof each item
+    void *p,                        // old block to reallocate
+    size_t *size_allocated,         // # of bytes actually allocated
+    bool *ok,                       // true if successful, false otherwise
+    GB_Context Context
+)
+{
+    int64_t size_old = (p == NULL) ? 0 : ((int64_t) (*size_allocated)) ;
+    p = GB_realloc_memory (nitems_new, nitems_old, size_of_item, p,
+        size_allocated, ok, Context) ;
+    if (p != NULL)
+    { 
+        // if the realloc failed, p and its size are unchanged
+        GB_Global_memory_inuse_add (kind,
+            ((int64_t) (*size_allocated)) - size_old) ;
+    }
+    return (p) ;
+}
+
+static inline void GB_free_counted
+(
+    int kind,                       // GB_MEMORY_STORAGE or GB_MEMORY_WORKSPACE
+    void **p,                       // pointer to block to free
+    size_t size_allocated           // # of bytes actually allocated
+)
+{
+    if (p != NULL && (*p) != NULL)
+    { 
+        GB_Global_memory_inuse_add (kind, -((int64_t) size_allocated)) ;
+        GB_dealloc_memory (p, size_allocated) ;
+    }
+}
+
 //------------------------------------------------------------------------------
 // malloc/calloc/realloc/free: for permanent contents of GraphBLAS objects
 //------------------------------------------------------------------------------
@@ -79,39 +206,41 @@ void GB_free_pool_finalize (void) ;
     { \
         printf ("dealloc (%s, line %d): %p size %lu\n", \
             __FILE__, __LINE__, p, s) ; \
-        GB_dealloc_memory (p, s) ; \
+        GB_free_counted (GB_MEMORY_STORAGE, (void **) p, s) ; \
     }
 
     #define GB_CALLOC(n,type,s) \
-        (type *) GB_calloc_memory (n, sizeof (type), s, Context) ; \
+        (type *) GB_calloc_counted (GB_MEMORY_STORAGE, n, sizeof (type), s, \
+            Context) ; \
         ; printf ("calloc  (%s, line %d): size %lu\n", \
             __FILE__, __LINE__, *(s)) ; \
 
     #define GB_MALLOC(n,type,s) \
-        (type *) GB_malloc_memory (n, sizeof (type), s) ; \
+        (type *) GB_malloc_counted (GB_MEMORY_STORAGE, n, sizeof (type), s) ; \
         ; printf ("malloc  (%s, line %d): size %lu\n", \
             __FILE__, __LINE__, *(s)) ; \
 
     #define GB_REALLOC(p,nnew,nold,type,s,ok,Context) \
-        p = (type *) GB_realloc_memory (nnew, nold, sizeof (type), \
-            (void *) p, s, ok, Context) ; \
+        p = (type *) GB_realloc_counted (GB_MEMORY_STORAGE, nnew, nold, \
+            sizeof (type), (void *) p, s, ok, Context) ; \
         ; printf ("realloc (%s, line %d): size %lu\n", \
             __FILE__, __LINE__, *(s)) ; \
 
 #else
 
     #define GB_FREE(p,s) \
-        GB_dealloc_memory ((void **) p, s)
+        GB_free_counted (GB_MEMORY_STORAGE, (void **) p, s)
 
     #define GB_CALLOC(n,type,s) \
-        (type *) GB_calloc_memory (n, sizeof (type), s, Context)
+        (type *) GB_calloc_counted (GB_MEMORY_STORAGE, n, sizeof (type), s, \
+            Context)
 
     #define GB_MALLOC(n,type,s) \
-        (type *) GB_malloc_memory (n, sizeof (type), s)
+        (type *) GB_malloc_counted (GB_MEMORY_STORAGE, n, sizeof (type), s)
 
     #define GB_REALLOC(p,nnew,nold,type,s,ok,Context) \
-        p = (type *) GB_realloc_memory (nnew, nold, sizeof (type), \
-            (void *) p, s, ok, Context)
+        p = (type *) GB_realloc_counted (GB_MEMORY_STORAGE, nnew, nold, \
+            sizeof (type), (void *) p, s, ok, Context)
 
 #endif
 
@@ -119,16 +248,250 @@ void GB_free_pool_finalize (void) ;
 // malloc/calloc/realloc/free: for workspace
 //------------------------------------------------------------------------------
 
-// These macros currently do the same thing as the 4 macros above, but that may
-// change in the future.  Even if they always do the same thing, it's useful to
-// tag the source code for the allocation of workspace differently from the
+// These macros do the same thing as the 4 macros above, except that the
+// workspace is also counted in Context->werk_inuse, and its high-water mark
+// in Context->werk_peak, so that the peak workspace of an operation can be
+// attributed to its output matrix (see GB_stats.h).  It's also useful to tag
+// the source code for the allocation of workspace differently from the
 // allocation of permament space for a GraphBLAS object, such as a GrB_Matrix.
 
-#define GB_CALLOC_WERK(n,type,s) GB_CALLOC(n,type,s)
-#define GB_MALLOC_WERK(n,type,s) GB_MALLOC(n,type,s)
-#define GB_REALLOC_WERK(p,nnew,nold,type,s,ok,Context) \
-             GB_REALLOC(p,nnew,nold,type,s,ok,Context) 
-#define GB_FREE_WERK(p,s) GB_FREE(p,s)
+// The workspace in use by a single method is limited to the memory_budget of
+// the GxB_Context engaged by the calling thread, or to the global
+// GxB_MEMORY_BUDGET (if nonzero); an allocation that would exceed it fails,
+// and the method returns GrB_OUT_OF_MEMORY.  If the calling thread has engaged
+// a GxB_Context, workspace is taken from the arena of the context, if it has
+// one and the block fits.  Blocks in the arena are freed by
+// GB_Context_arena_free.  The peak workspace of each method is also recorded in
+// the engaged context, so that GB_Context_arena_resize can size its arena to
+// fit.  Workspace not taken from an arena is counted in the global
+// GB_MEMORY_WORKSPACE usage; the arenas themselves are counted there when they
+// are allocated.
+
+static inline void GB_werk_count    // count workspace in the Context
+(
+    GB_Context Context,
+    int64_t delta                   // # of bytes allocated (>0) or freed (<0)
+)
+{
+    if (Context != NULL)
+    { 
+        Context->werk_inuse += delta ;
+        Context->werk_peak = GB_IMAX (Context->werk_peak, Context->werk_inuse);
+        GxB_Context context = Context->engaged ;
+        if (context != NULL)
+        { 
+            // the peak is used to size the arena (see GB_Context_arena_resize)
+            context->arena_peak = GB_IMAX (context->arena_peak,
+                Context->werk_peak) ;
+        }
+    }
+}
+
+static inline GxB_Context GB_werk_context  // context engaged for workspace
+(
+    GB_Context Context
+)
+{
+    return ((Context == NULL) ? GB_Context_engaged ( ) : Context->engaged) ;
+}
+
+static inline void *GB_werk_alloc   // malloc or calloc workspace, count it
+(
+    size_t nitems,                  // number of items to allocate
+    size_t size_of_item,            // sizeof each item
+    size_t *size_allocated,         // # of bytes actually allocated
+    bool do_calloc,                 // if true, set the workspace to zero
+    GB_Context Context
+)
+{
+    void *p = NULL ;
+    int64_t budget = GB_MEMORY_BUDGET (Context) ;
+    GxB_Context context = (Context == NULL) ? NULL : Context->engaged ;
+    if (context != NULL || budget > 0)
+    {
+        // check the memory budget
+        nitems = GB_IMAX (nitems, 1) ;
+        size_of_item = GB_IMAX (size_of_item, 1) ;
+        size_t nbytes = nitems * size_of_item ;
+        if (nbytes / size_of_item != nitems)
+        { 
+            // overflow
+            (*size_allocated) = 0 ;
+            return (NULL) ;
+        }
+        if (budget > 0 && Context->werk_inuse + (int64_t) nbytes > budget)
+        { 
+            // the workspace would exceed the memory budget
+            (*size_allocated) = 0 ;
+            return (NULL) ;
+        }
+        // try the arena of the context
+        p = GB_Context_arena_malloc (context, nbytes, size_allocated) ;
+        if (p != NULL && do_calloc)
+        { 
+            GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+            GB_memset (p, 0, nbytes, nthreads_max) ;
+        }
+    }
+    if (p == NULL)
+    { 
+        p = do_calloc ?
+            GB_calloc_counted (GB_MEMORY_WORKSPACE, nitems, size_of_item,
+                size_allocated, Context) :
+            GB_malloc_counted (GB_MEMORY_WORKSPACE, nitems, size_of_item,
+                size_allocated) ;
+    }
+    if (p != NULL) GB_werk_count (Context, (int64_t) (*size_allocated)) ;
+    return (p) ;
+}
+
+static inline void *GB_werk_malloc  // malloc workspace and count it
+(
+    size_t nitems,                  // number of items to allocate
+    size_t size_of_item,            // sizeof each item
+    size_t *size_allocated,         // # of bytes actually allocated
+    GB_Context Context
+)
+{ 
+    return (GB_werk_alloc (nitems, size_of_item, size_allocated, false,
+        Context)) ;
+}
+
+static inline void *GB_werk_calloc  // calloc workspace and count it
+(
+    size_t nitems,                  // number of items to allocate
+    size_t size_of_item,            // sizeof each item
+    size_t *size_allocated,         // # of bytes actually allocated
+    GB_Context Context
+)
+{ 
+    return (GB_werk_alloc (nitems, size_of_item, size_allocated, true,
+        Context)) ;
+}
+
+static inline void *GB_werk_realloc // realloc workspace and count it
+(
+    size_t nitems_new,              // new number of items in the object
+    size_t nitems_old,              // old number of items in the object
+    size_t size_of_item,            // sizeof each item
+    void *p,                        // old workspace to reallocate
+    size_t *size_allocated,         // # of bytes actually allocated
+    bool *ok,                       // true if successful, false otherwise
+    GB_Context Context_realloc,     // Context for GB_realloc_memory
+    GB_Context Context              // Context for counting the workspace
+)
+{
+    int64_t werk_size_old = (p == NULL) ? 0 : ((int64_t) (*size_allocated)) ;
+    GxB_Context context = GB_werk_context (Context) ;
+    if (p != NULL && GB_Context_arena_owns (context, p))
+    {
+        // move the workspace out of the arena
+        size_t size_new = 0 ;
+        void *pnew = GB_malloc_counted (GB_MEMORY_WORKSPACE, nitems_new,
+            size_of_item, &size_new) ;
+        (*ok) = (pnew != NULL) ;
+        if (pnew == NULL) return (p) ;
+        memcpy (pnew, p, GB_IMIN (nitems_new, nitems_old) * size_of_item) ;
+        GB_Context_arena_free (context, p, *size_allocated) ;
+        p = pnew ;
+        (*size_allocated) = size_new ;
+    }
+    else
+    { 
+        p = GB_realloc_counted (GB_MEMORY_WORKSPACE, nitems_new, nitems_old,
+            size_of_item, p, size_allocated, ok, Context_realloc) ;
+    }
+    if (p != NULL)
+    { 
+        GB_werk_count (Context, ((int64_t) (*size_allocated)) - werk_size_old) ;
+    }
+    return (p) ;
+}
+
+static inline void GB_werk_free     // free workspace and uncount it
+(
+    void **p,                       // pointer to workspace to free
+    size_t size_allocated,          // # of bytes actually allocated
+    GB_Context Context
+)
+{
+    if (p != NULL && (*p) != NULL)
+    { 
+        GB_werk_count (Context, -((int64_t) size_allocated)) ;
+        if (GB_Context_arena_free (GB_werk_context (Context), *p,
+            size_allocated))
+        { 
+            // the workspace was in the arena
+            (*p) = NULL ;
+        }
+        else
+        { 
+            GB_free_counted (GB_MEMORY_WORKSPACE, p, size_allocated) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// reclassify a block between storage and workspace
+//------------------------------------------------------------------------------
+
+// The work arrays of GB_builder are allocated as storage (with GB_MALLOC) by
+// its callers, or are the pending tuples of a matrix.  GB_builder counts them
+// as workspace while it uses them, and counts each one back as storage if it
+// is transplanted into the matrix it builds.  Such a block is never in an
+// arena, so it can be freed with GB_FREE_WERK once it has been adopted.
+
+static inline void GB_werk_adopt    // count a block of storage as workspace
+(
+    void *p,                        // block allocated by GB_MALLOC
+    size_t size_allocated,          // # of bytes actually allocated
+    GB_Context Context
+)
+{
+    if (p != NULL)
+    { 
+        GB_Global_memory_inuse_add (GB_MEMORY_STORAGE,
+            -((int64_t) size_allocated)) ;
+        GB_Global_memory_inuse_add (GB_MEMORY_WORKSPACE,
+            (int64_t) size_allocated) ;
+        GB_werk_count (Context, (int64_t) size_allocated) ;
+    }
+}
+
+static inline void GB_werk_transplant   // count adopted workspace as storage
+(
+    void *p,                        // block adopted by GB_werk_adopt
+    size_t size_allocated,          // # of bytes actually allocated
+    GB_Context Context
+)
+{
+    if (p != NULL)
+    { 
+        GB_werk_count (Context, -((int64_t) size_allocated)) ;
+        GB_Global_memory_inuse_add (GB_MEMORY_WORKSPACE,
+            -((int64_t) size_allocated)) ;
+        GB_Global_memory_inuse_add (GB_MEMORY_STORAGE,
+            (int64_t) size_allocated) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// workspace macros
+//------------------------------------------------------------------------------
+
+// GB_MALLOC_WERK and GB_CALLOC_WERK use the Context in scope, as GB_CALLOC
+// does.  GB_FREE_WERK takes it as an explicit argument, since GB_FREE does
+// not need one.  It must be the Context the workspace was allocated with.
+
+#define GB_CALLOC_WERK(n,type,s) \
+    (type *) GB_werk_calloc (n, sizeof (type), s, Context)
+#define GB_MALLOC_WERK(n,type,s) \
+    (type *) GB_werk_malloc (n, sizeof (type), s, Context)
+#define GB_REALLOC_WERK(p,nnew,nold,type,s,ok,Context_realloc)      \
+    p = (type *) GB_werk_realloc (nnew, nold, sizeof (type),        \
+        (void *) p, s, ok, Context_realloc, Context)
+#define GB_FREE_WERK(p,s,Context) \
+    GB_werk_free ((void **) (p), s, Context)
 
 #endif
 
@@ -0,0 +1,101 @@
+//------------------------------------------------------------------------------
+// GB_memoryUsage: return the memory held by a matrix or vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each of the arrays A->[phixb] is reported by the size of its malloc'd block,
+// and the part of the block not in use (beyond A->nvec+1 entries of A->p,
+// A->nvec entries of A->h, and the entries held in A->i, A->x, and A->b) is
+// added to usage [GxB_MEMORY_SLACK].  The sizes come from A->[phixb]_size,
+// which also hold the size of content shared with snapshots.  No pending work
+// is finished.
+
+#include "GB.h"
+
+GrB_Info GB_memoryUsage         // get the memory held by a matrix
+(
+    size_t usage [GxB_NMEMORY_USAGE],   // bytes held, indexed by GxB_MEMORY_*
+    const GrB_Matrix A,         // matrix to query
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (usage) ;
+    ASSERT_MATRIX_OK (A, "A for memoryUsage", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // get the size of each array
+    //--------------------------------------------------------------------------
+
+    memset (usage, 0, GxB_NMEMORY_USAGE * sizeof (size_t)) ;
+    usage [GxB_MEMORY_P] = (A->p == NULL) ? 0 : A->p_size ;
+    usage [GxB_MEMORY_H] = (A->h == NULL) ? 0 : A->h_size ;
+    usage [GxB_MEMORY_I] = (A->i == NULL) ? 0 : A->i_size ;
+    usage [GxB_MEMORY_X] = (A->x == NULL) ? 0 : A->x_size ;
+    usage [GxB_MEMORY_B] = (A->b == NULL) ? 0 : A->b_size ;
+
+    GB_Pending Pending = A->Pending ;
+    if (Pending != NULL)
+    { 
+        usage [GxB_MEMORY_PENDING] = Pending->header_size
+            + ((Pending->i == NULL) ? 0 : Pending->i_size)
+            + ((Pending->j == NULL) ? 0 : Pending->j_size)
+            + ((Pending->x == NULL) ? 0 : Pending->x_size) ;
+    }
+
+    usage [GxB_MEMORY_OTHER] = A->header_size
+        + ((A->logger == NULL) ? 0 : A->logger_size)
+        + ((A->stats  == NULL) ? 0 : A->stats->header_size)
+        + ((A->shared == NULL) ? 0 : A->shared->header_size) ;
+
+    //--------------------------------------------------------------------------
+    // find the part of the arrays not in use
+    //--------------------------------------------------------------------------
+
+    // the values of a matrix with a deferred operator are still of the type
+    // of the matrix it was computed from
+    size_t xsize = (A->deferred_op != NULL) ? A->deferred_type->size :
+        A->type->size ;
+    int64_t anz_held = GB_NNZ_HELD (A) ;
+    size_t used [5] ;
+    used [GxB_MEMORY_P] = (A->p == NULL) ? 0 : (A->nvec + 1) * sizeof (int64_t);
+    used [GxB_MEMORY_H] = (A->h == NULL) ? 0 : A->nvec * sizeof (int64_t) ;
+    used [GxB_MEMORY_I] = (A->i == NULL) ? 0 : anz_held * sizeof (int64_t) ;
+    used [GxB_MEMORY_X] = (A->x == NULL) ? 0 : anz_held * xsize ;
+    used [GxB_MEMORY_B] = (A->b == NULL) ? 0 : anz_held * sizeof (int8_t) ;
+
+    size_t slack = 0 ;
+    for (int k = 0 ; k < 5 ; k++)
+    { 
+        if (usage [k] > used [k]) slack += usage [k] - used [k] ;
+    }
+    if (Pending != NULL && Pending->nmax > Pending->n)
+    { 
+        size_t tuple_size = ((Pending->i == NULL) ? 0 : sizeof (int64_t))
+                          + ((Pending->j == NULL) ? 0 : sizeof (int64_t))
+                          + ((Pending->x == NULL) ? 0 : Pending->size) ;
+        slack += (Pending->nmax - Pending->n) * tuple_size ;
+    }
+    usage [GxB_MEMORY_SLACK] = slack ;
+
+    //--------------------------------------------------------------------------
+    // find the total
+    //--------------------------------------------------------------------------
+
+    size_t total = 0 ;
+    for (int k = 0 ; k <= GxB_MEMORY_OTHER ; k++)
+    { 
+        total += usage [k] ;
+    }
+    usage [GxB_MEMORY_TOTAL] = total ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -300,7 +300,8 @@ GrB_Info GB_msort_2b    // sort array A of size 2-by-n, using 2 keys (A [0:1][])
     int64_t *restrict A_0,   // size n array
     int64_t *restrict A_1,   // size n array
     const int64_t n,
-    int nthreads                // # of threads to use
+    int nthreads,               // # of threads to use
+    GB_Context Context
 )
 {
 
@@ -442,7 +443,7 @@ GrB_Info GB_msort_2b    // sort array A of size 2-by-n, using 2 keys (A [0:1][])
     // free workspace and return result
     //--------------------------------------------------------------------------
 
-    GB_FREE_WERK (&W, W_size) ;
+    GB_FREE_WERK (&W, W_size, Context) ;
     return (GrB_SUCCESS) ;
 }
 
@@ -312,7 +312,8 @@ GrB_Info GB_msort_3b    // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     int64_t *restrict A_1,   // size n array
     int64_t *restrict A_2,   // size n array
     const int64_t n,
-    int nthreads                // # of threads to use
+    int nthreads,               // # of threads to use
+    GB_Context Context
 )
 {
 
@@ -452,7 +453,7 @@ GrB_Info GB_msort_3b    // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     // free workspace and return result
     //--------------------------------------------------------------------------
 
-    GB_FREE_WERK (&W, W_size) ;
+    GB_FREE_WERK (&W, W_size, Context) ;
     return (GrB_SUCCESS) ;
 }
 
@@ -136,13 +136,31 @@ GrB_Info GB_mxm                     // C<M> = A*B
     // semiring->add->ztype if accum is not present.  To compute in-place,
     // C must also not be transposed, and it cannot be aliased with M, A, or B.
 
+    // If GxB_TILE_SIZE is set, and a dimension of T=A*B (or the inner
+    // dimension) is larger than the tile size, T is computed one pair of
+    // tiles of A and B at a time, without the mask (see GB_AxB_tiled.c).
+    // A positional multiplier would see the indices within each tile, so it
+    // is never tiled.
+
     bool mask_applied = false ;
     bool done_in_place = false ;
     bool M_transposed = false ;
-    GB_OK (GB_AxB_meta (T, C, C_replace, C->is_csc, MT, &M_transposed, M,
-        Mask_comp, Mask_struct, accum, A, B, semiring, A_transpose,
-        B_transpose, flipxy, &mask_applied, &done_in_place, AxB_method,
-        do_sort, Context)) ;
+    int64_t tile_size = GB_Global_tile_size_get ( ) ;
+    if (tile_size > 0 && M == NULL
+        && !GB_OP_IS_POSITIONAL (semiring->multiply)
+        && anrows > 0 && ancols > 0 && bncols > 0
+        && (anrows > tile_size || ancols > tile_size || bncols > tile_size))
+    { 
+        GB_OK (GB_AxB_tiled (T, C->is_csc, A, A_transpose, B, B_transpose,
+            semiring, flipxy, AxB_method, do_sort, tile_size, Context)) ;
+    }
+    else
+    { 
+        GB_OK (GB_AxB_meta (T, C, C_replace, C->is_csc, MT, &M_transposed, M,
+            Mask_comp, Mask_struct, accum, A, B, semiring, A_transpose,
+            B_transpose, flipxy, &mask_applied, &done_in_place, AxB_method,
+            do_sort, Context)) ;
+    }
 
     if (done_in_place)
     { 
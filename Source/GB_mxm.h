@@ -11,6 +11,11 @@
 #define GB_MXM_H
 #include "GB_AxB_saxpy.h"
 
+// With GxB_LOAD_BALANCE_DYNAMIC, the saxpy3 and dot3 methods create
+// GB_DYNAMIC_GRAIN times as many tasks as they do by default, each at least
+// chunk/GB_DYNAMIC_GRAIN in size.
+#define GB_DYNAMIC_GRAIN 8
+
 //------------------------------------------------------------------------------
 
 GrB_Info GB_mxm                     // C<M> = A*B
@@ -32,6 +37,22 @@ GrB_Info GB_mxm                     // C<M> = A*B
     GB_Context Context
 ) ;
 
+GrB_Info GB_AxB_tiled               // C=A*B, one pair of tiles at a time
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const bool C_is_csc,            // desired CSR/CSC format of C
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    const int64_t tile_size,        // max dimension of each tile
+    GB_Context Context
+) ;
+
 GrB_Info GB_AxB_dot                 // dot product (multiple methods)
 (
     GrB_Matrix C,                   // output matrix, static header
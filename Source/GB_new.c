@@ -107,6 +107,18 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->bitmap_switch = GB_Global_bitmap_switch_matrix_get (vlen, vdim) ;
     A->sparsity = GxB_AUTO_SPARSITY ;
 
+    // conversion counters and instrumentation: these belong to the header,
+    // and are kept if the matrix is recreated in an existing dynamic header
+    if (allocated_header || A_static_header)
+    { 
+        A->conform_damping = 0 ;
+        A->conform_stable = 0 ;
+        A->stats = NULL ;
+    }
+
+    // the cached structural summary describes the content, not the header
+    GB_profile_invalidate (A) ;
+
     if (sparsity == GxB_HYPERSPARSE)
     { 
         A_is_hyper = true ;             // force A to be hypersparse
@@ -168,6 +180,9 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->nzombies = 0 ;
     A->jumbled = false ;
     A->Pending = NULL ;
+    A->shared = NULL ;
+    A->deferred_op = NULL ;
+    A->deferred_type = NULL ;
 
     //--------------------------------------------------------------------------
     // Allocate A->p and A->h if requested
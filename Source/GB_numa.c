@@ -0,0 +1,193 @@
+//------------------------------------------------------------------------------
+// GB_numa: NUMA placement of large blocks of memory
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// On a multi-socket system, the operating system places each page of memory
+// on the NUMA node of the thread that first touches it.  A block obtained from
+// malloc and then cleared or filled by a single thread thus lies entirely on
+// one node, and threads on the other sockets access it at remote bandwidth.
+// GB_numa_place is called by GB_malloc_memory and GB_calloc_memory for each
+// large block freshly obtained from malloc, and places it according to the
+// GxB_NUMA_POLICY setting:
+
+// GxB_NUMA_DEFAULT: the block is left as-is.
+
+// GxB_NUMA_FIRST_TOUCH: the block is split into nthreads contiguous slices,
+// one per thread, and each thread touches (or clears) its own slice.  This
+// is the same static partition used by GB_pslice and GB_ek_slice when a
+// method uses one task per thread, so each slice of Ai and Ax tends to lie on
+// the node of the thread that later works on it.  This requires the OpenMP
+// threads to be bound to cores (OMP_PROC_BIND=close or spread, and
+// OMP_PLACES=cores); otherwise the threads migrate and the placement is lost.
+
+// GxB_NUMA_INTERLEAVE: the pages of the block are interleaved round-robin
+// across all NUMA nodes the process may use, with the Linux mbind system call
+// (libnuma is not required).  Each thread then sees the average bandwidth of
+// all nodes, regardless of how the work is later partitioned.  If mbind is
+// not available or fails, the block is placed as for GxB_NUMA_FIRST_TOUCH.
+
+// Blocks taken from the free_pool, and small blocks, are not placed.
+
+#if defined ( __linux__ ) && !defined ( _GNU_SOURCE )
+// syscall is not declared by <unistd.h> with -std=c11 alone
+#define _GNU_SOURCE
+#endif
+
+#include "GB.h"
+
+#if defined ( __linux__ )
+#include <unistd.h>
+#include <sys/syscall.h>
+#if defined ( SYS_mbind ) && defined ( SYS_get_mempolicy )
+#define GB_HAVE_MBIND 1
+#endif
+#endif
+
+#ifndef GB_HAVE_MBIND
+#define GB_HAVE_MBIND 0
+#endif
+
+#define GB_NUMA_PAGE 4096
+
+//------------------------------------------------------------------------------
+// NUMA nodes available to the process
+//------------------------------------------------------------------------------
+
+#if GB_HAVE_MBIND
+
+// from <linux/mempolicy.h>
+#define GB_MPOL_INTERLEAVE      3
+#define GB_MPOL_F_MEMS_ALLOWED  (1 << 2)
+
+#define GB_NUMA_MAXNODE 1024
+#define GB_NUMA_MASKLEN (GB_NUMA_MAXNODE / (8 * sizeof (unsigned long)))
+
+static unsigned long GB_numa_mask [GB_NUMA_MASKLEN] ;
+static int GB_numa_nnodes = -1 ;   // -1 if not yet known
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_numa_nodes: return the # of NUMA nodes the process may allocate from
+//------------------------------------------------------------------------------
+
+// This is called by GxB_Global_Option_set (GxB_NUMA_POLICY, ...) before the
+// policy is changed, so the node mask is known before GB_numa_place needs it.
+// It is also called by GxB_Global_Option_get (GxB_NUMA_NODES, ...).
+
+int GB_numa_nodes (void)
+{
+    #if GB_HAVE_MBIND
+    if (GB_numa_nnodes < 0)
+    {
+        memset (GB_numa_mask, 0, sizeof (GB_numa_mask)) ;
+        long result = syscall (SYS_get_mempolicy, NULL, GB_numa_mask,
+            (unsigned long) GB_NUMA_MAXNODE, NULL,
+            (unsigned long) GB_MPOL_F_MEMS_ALLOWED) ;
+        int nnodes = 0 ;
+        if (result == 0)
+        {
+            for (int k = 0 ; k < GB_NUMA_MAXNODE ; k++)
+            {
+                unsigned long bit = 1UL << (k % (8 * sizeof (unsigned long))) ;
+                if (GB_numa_mask [k / (8 * sizeof (unsigned long))] & bit)
+                {
+                    nnodes++ ;
+                }
+            }
+        }
+        GB_numa_nnodes = GB_IMAX (nnodes, 1) ;
+    }
+    return (GB_numa_nnodes) ;
+    #else
+    return (1) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_numa_place: place a newly allocated block on the NUMA nodes
+//------------------------------------------------------------------------------
+
+bool GB_numa_place          // return true if the block has been cleared
+(
+    void *p,                // block just obtained from malloc
+    size_t size,            // size of the block, in bytes
+    bool clear,             // if true, the block must be set to zero
+    int nthreads_max        // max # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check the policy
+    //--------------------------------------------------------------------------
+
+    int policy = GB_Global_numa_policy_get ( ) ;
+    if (p == NULL || policy == GxB_NUMA_DEFAULT || size < GB_NUMA_MIN_SIZE)
+    {
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // interleave the pages across all nodes
+    //--------------------------------------------------------------------------
+
+    #if GB_HAVE_MBIND
+    if (policy == GxB_NUMA_INTERLEAVE && GB_numa_nnodes > 1)
+    {
+        // mbind requires a page-aligned start; a partial page at either
+        // end of the block is left to the default policy
+        uintptr_t first = ((uintptr_t) p + GB_NUMA_PAGE - 1)
+            & ~((uintptr_t) GB_NUMA_PAGE - 1) ;
+        uintptr_t last  = ((uintptr_t) p + size)
+            & ~((uintptr_t) GB_NUMA_PAGE - 1) ;
+        if (last > first &&
+            syscall (SYS_mbind, (void *) first, (unsigned long) (last - first),
+                GB_MPOL_INTERLEAVE, GB_numa_mask,
+                (unsigned long) GB_NUMA_MAXNODE, 0) == 0)
+        {
+            // pages are placed when first touched, by any thread
+            return (false) ;
+        }
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // first touch: each thread touches its own slice of the block
+    //--------------------------------------------------------------------------
+
+    int64_t npages = (int64_t) (size / GB_NUMA_PAGE) ;
+    int nthreads = (int) GB_IMIN (nthreads_max, npages) ;
+    if (nthreads <= 1)
+    {
+        // a single thread would place the block just as malloc does
+        return (false) ;
+    }
+
+    GB_void *block = (GB_void *) p ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t pstart, pend ;
+        GB_PARTITION (pstart, pend, npages, tid, nthreads) ;
+        size_t start = (size_t) pstart * GB_NUMA_PAGE ;
+        size_t end = (tid == nthreads-1) ? size : (size_t) pend * GB_NUMA_PAGE ;
+        if (clear)
+        {
+            memset (block + start, 0, end - start) ;
+        }
+        else
+        {
+            for (size_t k = start ; k < end ; k += GB_NUMA_PAGE)
+            {
+                block [k] = 0 ;
+            }
+        }
+    }
+    return (clear) ;
+}
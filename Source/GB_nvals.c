@@ -25,8 +25,9 @@ GrB_Info GB_nvals           // get the number of entries in a matrix
 
     GB_RETURN_IF_NULL (nvals) ;
 
-    // leave zombies alone, and leave jumbled, but assemble any pending tuples
-    GB_MATRIX_WAIT_IF_PENDING (A) ;
+    // leave zombies alone, and leave jumbled, but assemble any pending tuples.
+    // A deferred op does not change the pattern, so it is left deferred.
+    GB_WAIT_IF (GB_PENDING (A), A, "A") ;
 
     //--------------------------------------------------------------------------
     // return the number of entries in the matrix
@@ -42,6 +42,7 @@
     #define GB_OPENMP_GET_NUM_THREADS   omp_get_num_threads ( )
     #define GB_OPENMP_GET_WTIME         omp_get_wtime ( )
     #define GB_OPENMP_GET_THREAD_ID     omp_get_thread_num ( )
+    #define GB_OPENMP_GET_LEVEL         omp_get_level ( )
 
 #else
 
@@ -49,6 +50,7 @@
     #define GB_OPENMP_GET_NUM_THREADS   (1)
     #define GB_OPENMP_GET_WTIME         (0)
     #define GB_OPENMP_GET_THREAD_ID     (0)
+    #define GB_OPENMP_GET_LEVEL         (0)
 
 #endif
 
@@ -332,6 +332,8 @@ struct GB_Type_opaque       // content of GrB_Type
     size_t size ;           // size of the type
     GB_Type_code code ;     // the type code
     char name [GB_LEN] ;    // name of the type
+    GrB_Type etype ;        // type of each value, for GxB_Type_new_vector
+    int veclen ;            // # of values, for GxB_Type_new_vector, else 0
 } ;
 
 struct GB_UnaryOp_opaque    // content of GrB_UnaryOp
@@ -355,6 +357,8 @@ struct GB_BinaryOp_opaque   // content of GrB_BinaryOp
     GxB_binary_function function ;        // a pointer to the binary function
     char name [GB_LEN] ;    // name of the binary operator
     GB_Opcode opcode ;      // operator opcode
+    GB_Opcode vector_opcode ;   // opcode of the op on each value, for
+                            // GxB_BinaryOp_new_vector, else GB_NOP_opcode
 } ;
 
 struct GB_SelectOp_opaque   // content of GxB_SelectOp
@@ -405,6 +409,40 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     bool do_sort ;          // if nonzero, do the sort in GrB_mxm
 } ;
 
+//------------------------------------------------------------------------------
+// GxB_Context: an execution context for a user thread
+//------------------------------------------------------------------------------
+
+// A setting at its default (GxB_DEFAULT, or NULL) is taken from the global
+// options.  The arena is a single block of workspace, handed out in stack
+// order by GB_Context_arena_malloc; it is reset whenever none of its blocks
+// are in use.  See GB_Context_engaged.c.
+
+struct GB_Context_opaque    // content of GxB_Context
+{
+    // first 4 items exactly match GrB_Matrix, GrB_Vector, GxB_Scalar structs:
+    int64_t magic ;         // for detecting uninitialized objects
+    size_t header_size ;    // size of the malloc'd block for this struct, or 0
+    char *logger ;          // error logger string
+    size_t logger_size ;    // size of the malloc'd block for logger, or 0
+    // specific to the context struct:
+    double chunk ;          // chunk size for # of threads for small problems
+    int nthreads_max ;      // max # threads to use
+    int burble ;            // burble on (1), off (0), or global option (-1)
+    GB_printf_function_t printf_func ;  // printf for the burble, or NULL
+    GB_flush_function_t flush_func ;    // flush for the burble, or NULL
+    int64_t memory_budget ; // max workspace per method, in bytes, or 0
+    GB_void *arena ;        // workspace arena, or NULL
+    size_t arena_size ;     // size of the malloc'd block for the arena
+    size_t arena_top ;      // # of bytes of the arena handed out
+    int64_t arena_nblocks ; // # of blocks of the arena in use
+    int64_t arena_peak ;    // peak workspace of methods since the last resize
+    double arena_hwm ;      // high-water mark of workspace, with decay
+    bool arena_auto ;       // if true, the arena is sized automatically
+    int32_t engaged ;       // 1 if engaged by a thread, 0 otherwise
+    int engaged_level ;     // OpenMP nesting level of the engaging thread
+} ;
+
 //------------------------------------------------------------------------------
 // GB_Pending data structure: for scalars, vectors, and matrices
 //------------------------------------------------------------------------------
@@ -431,6 +469,84 @@ struct GB_Pending_struct    // list of pending tuples for a matrix
 
 typedef struct GB_Pending_struct *GB_Pending ;
 
+//------------------------------------------------------------------------------
+// GB_Shared data structure: content shared by a matrix and its snapshots
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_snapshot and GxB_Vector_snapshot create a read-only copy of a
+// matrix, S, without copying its content.  The arrays A->[phbix] are moved
+// into a GB_Shared object, and both A and S hold shallow pointers to them.
+// The arrays are freed when the last matrix that uses them is freed, or
+// given its own copy of the content by GB_unshare.  See GB_snapshot.c.
+
+struct GB_Shared_struct     // content shared by a matrix and its snapshots
+{
+    size_t header_size ;    // size of the malloc'd block for this struct, or 0
+    int64_t nshared ;       // # of matrices that use this content
+    int64_t *p ;            // A->p, A->h, A->b, A->i, and A->x, and their
+    size_t p_size ;         // sizes, from the matrix A when the first
+    int64_t *h ;            // snapshot of A was created.
+    size_t h_size ;
+    int8_t *b ;
+    size_t b_size ;
+    int64_t *i ;
+    size_t i_size ;
+    void *x ;
+    size_t x_size ;
+} ;
+
+typedef struct GB_Shared_struct *GB_Shared ;
+
+//------------------------------------------------------------------------------
+// GB_Stats data structure: instrumentation counters for a matrix
+//------------------------------------------------------------------------------
+
+// GxB_set (A, GxB_STATS, true) allocates A->stats, and GraphBLAS then counts
+// the work done on A, which is returned by GxB_get (A, GxB_STATS, stats).
+// The counters are listed in GraphBLAS.h (GxB_STATS_WAIT and so on).  See
+// GB_stats.h for where they are updated.
+
+struct GB_Stats_struct      // per-matrix instrumentation counters
+{
+    size_t header_size ;    // size of the malloc'd block for this struct
+    double s [GxB_NSTATS] ; // the counters, indexed by GxB_STATS_*
+} ;
+
+typedef struct GB_Stats_struct *GB_Stats ;
+
+//------------------------------------------------------------------------------
+// GB_Profile data structure: cached structural summary of a matrix
+//------------------------------------------------------------------------------
+
+// A->profile caches the distribution of the vector degrees of A (the number of
+// entries in each vector A(:,j) if A is held by column).  It is computed by
+// GB_profile, in O(A->nvec) time, and is valid only while the key matches the
+// content of A.  It is cached only when A is finished by GrB_Matrix_wait or
+// GrB_Vector_wait.  See GB_profile.h.
+
+#define GB_PROFILE_NBINS 24
+
+struct GB_Profile_struct    // cached vector-degree summary of a matrix
+{
+    // key: the summary is valid only while these are unchanged
+    bool valid ;            // true if the summary has been computed
+    const void *p_key ;     // A->p, A->h, and A->i when computed
+    const void *h_key ;
+    const void *i_key ;
+    int64_t nvec_key ;      // A->nvec when computed
+    int64_t nvals_key ;     // GB_NNZ (A) when computed
+    int64_t nzombies_key ;  // A->nzombies when computed
+
+    // summary
+    int64_t nvec_nonempty ; // # of non-empty vectors
+    int64_t maxdeg ;        // max # of entries in any vector
+    double avgdeg ;         // average # of entries in the non-empty vectors
+    int64_t hist [GB_PROFILE_NBINS] ;   // hist [0]: # of empty vectors;
+                            // hist [k]: # of vectors with degree in the range
+                            // 2^(k-1) to 2^k-1, for k > 0.  The last bin also
+                            // holds all vectors with larger degree.
+} ;
+
 //------------------------------------------------------------------------------
 // scalar, vector, and matrix types
 //------------------------------------------------------------------------------
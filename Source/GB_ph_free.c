@@ -54,6 +54,7 @@ void GB_ph_free                 // free A->p and A->h of a matrix
     A->plen = 0 ;
     A->nvec = 0 ;
     A->nvec_nonempty = 0 ;
+    GB_profile_invalidate (A) ;
 
     //--------------------------------------------------------------------------
     // set the status to invalid
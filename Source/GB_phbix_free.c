@@ -23,6 +23,7 @@ void GB_phbix_free              // free all content of a matrix
     {
         GB_ph_free (A) ;            // free A->p and A->h
         GB_bix_free (A) ;           // free A->b, A->i, and A->x
+        GB_shared_free (&(A->shared)) ; // release content shared w/ snapshots
         GB_FREE (&(A->logger), A->logger_size) ;        // free the error logger
     }
 }
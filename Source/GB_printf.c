@@ -29,7 +29,7 @@ void GB_burble_assign
     // quick return if burble is disabled
     //--------------------------------------------------------------------------
 
-    if (!GB_Global_burble_get ( ))
+    if (!GB_Context_burble_get ( ))
     {
         return ;
     }
@@ -25,7 +25,7 @@
 // is used for the BURBLE, and for debugging output. 
 #define GBDUMP(...)                                                     \
 {                                                                       \
-    GB_printf_function_t printf_func = GB_Global_printf_get ( ) ;       \
+    GB_printf_function_t printf_func = GB_Context_printf_get ( ) ;      \
     if (printf_func != NULL)                                            \
     {                                                                   \
         printf_func (__VA_ARGS__) ;                                     \
@@ -34,7 +34,7 @@
     {                                                                   \
         printf (__VA_ARGS__) ;                                          \
     }                                                                   \
-    GB_flush_function_t flush_func = GB_Global_flush_get ( ) ;          \
+    GB_flush_function_t flush_func = GB_Context_flush_get ( ) ;         \
     if (flush_func != NULL)                                             \
     {                                                                   \
         flush_func ( ) ;                                                \
@@ -124,6 +124,7 @@
 // GB_BURBLE provides diagnostic output.
 // Use GxB_set (GxB_BURBLE, true) to turn it on
 // and GxB_set (GxB_BURBLE, false) to turn it off.
+// A GxB_Context engaged by the calling thread can override both settings.
 
 #if GB_BURBLE
 
@@ -143,7 +144,7 @@ void GB_burble_assign
 // define the function to use to burble
 #define GBURBLE(...)                                \
 {                                                   \
-    if (GB_Global_burble_get ( ))                   \
+    if (GB_Context_burble_get ( ))                  \
     {                                               \
         GBDUMP (__VA_ARGS__) ;                      \
     }                                               \
@@ -172,7 +173,7 @@ void GB_burble_assign
     #define GB_BURBLE_START(func)                       \
     double t_burble = 0 ;                               \
     {                                                   \
-        if (GB_Global_burble_get ( ))                   \
+        if (GB_Context_burble_get ( ))                  \
         {                                               \
             GBURBLE (" [ " func " ") ;                  \
             t_burble = GB_OPENMP_GET_WTIME ;            \
@@ -181,7 +182,7 @@ void GB_burble_assign
 
     #define GB_BURBLE_END                               \
     {                                                   \
-        if (GB_Global_burble_get ( ))                   \
+        if (GB_Context_burble_get ( ))                  \
         {                                               \
             t_burble = GB_OPENMP_GET_WTIME - t_burble ; \
             GBURBLE ("\n   %.3g sec ]\n", t_burble) ;   \
@@ -210,6 +211,40 @@ void GB_burble_assign
     if (!(A->vlen <= 1 && A->vdim <= 1)) GBURBLE (__VA_ARGS__)      \
 }
 
+// The parallel task loops of GrB_mxm time each task if the burble is on.
+// GB_TASK_TIMING is declared before the loop, GB_TASK_TIME_START at the
+// start of each task, and GB_TASK_TIME_END (Tasks [taskid].time) at its end.
+// GB_BURBLE_TASK_TIMES then reports the spread of the times of all tasks.
+// The ratio max/mean is 1 if all tasks took the same time.
+
+#define GB_TASK_TIMING                                              \
+    const bool task_timing = GB_Context_burble_get ( ) ;
+
+#define GB_TASK_TIME_START                                          \
+    double t_task = (task_timing) ? GB_OPENMP_GET_WTIME : 0 ;
+
+#define GB_TASK_TIME_END(time)                                      \
+    if (task_timing) (time) += GB_OPENMP_GET_WTIME - t_task ;
+
+#define GB_BURBLE_TASK_TIMES(Tasks,ntasks)                          \
+{                                                                   \
+    if (GB_Context_burble_get ( ) && (ntasks) > 1)                  \
+    {                                                               \
+        double tmin = Tasks [0].time, tmax = tmin, tsum = 0 ;       \
+        for (int t = 0 ; t < (ntasks) ; t++)                        \
+        {                                                           \
+            double tt = Tasks [t].time ;                            \
+            tmin = GB_IMIN (tmin, tt) ;                             \
+            tmax = GB_IMAX (tmax, tt) ;                             \
+            tsum += tt ;                                            \
+        }                                                           \
+        double tmean = tsum / (ntasks) ;                            \
+        GBURBLE ("(task time: min %.3g mean %.3g max %.3g sec, "    \
+            "max/mean %.3g) ", tmin, tmean, tmax,                   \
+            (tmean > 0) ? (tmax / tmean) : 1) ;                     \
+    }                                                               \
+}
+
 #else
 
 // no burble
@@ -219,6 +254,10 @@ void GB_burble_assign
 #define GB_BURBLE_N(n,...)
 #define GB_BURBLE_MATRIX(A,...)
 #define GB_BURBLE_DENSE(A,format)
+#define GB_TASK_TIMING const bool task_timing = false ;
+#define GB_TASK_TIME_START
+#define GB_TASK_TIME_END(time)
+#define GB_BURBLE_TASK_TIMES(Tasks,ntasks)
 
 #endif
 #endif
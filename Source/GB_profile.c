@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+// GB_profile: compute or return the cached structural summary of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// See GB_profile.h.  The summary is computed in O(A->nvec) time from A->p.
+// GB_profile never modifies A, since A may be an input matrix read by other
+// user threads at the same time.  Only GB_profile_cache, which is given a
+// matrix that the caller owns, caches the summary in A->profile (and also
+// sets A->nvec_nonempty if not already known).
+
+#include "GB.h"
+
+#define GB_FREE_ALL                                  \
+{                                                    \
+    GB_FREE_WERK (&Work, Work_size, Context) ;       \
+}
+
+// bin of a vector with d entries
+#define GB_PROFILE_BIN(d) \
+    (((d) == 0) ? 0 : GB_IMIN (GB_FLOOR_LOG2 (d) + 1, GB_PROFILE_NBINS - 1))
+
+//------------------------------------------------------------------------------
+// GB_profile_compute: compute the summary of A in P; false if out of memory
+//------------------------------------------------------------------------------
+
+static bool GB_profile_compute
+(
+    GB_Profile *P,
+    const GrB_Matrix A,
+    GB_Context Context
+)
+{
+
+    ASSERT (!GB_IS_BITMAP (A) && !GB_PENDING (A)) ;
+    const int64_t anvec = A->nvec ;
+    const int64_t anz = GB_NNZ (A) ;
+
+    //--------------------------------------------------------------------------
+    // compute the summary
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Work = NULL ; size_t Work_size = 0 ;
+    memset (P->hist, 0, GB_PROFILE_NBINS * sizeof (int64_t)) ;
+    int64_t maxdeg = 0 ;
+
+    if (GB_IS_FULL (A))
+    { 
+
+        //----------------------------------------------------------------------
+        // A is full: all vectors have A->vlen entries
+        //----------------------------------------------------------------------
+
+        P->hist [GB_PROFILE_BIN (A->vlen)] = anvec ;
+        maxdeg = (anvec == 0) ? 0 : A->vlen ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // A is sparse or hypersparse: each task computes its own histogram
+        //----------------------------------------------------------------------
+
+        GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+        int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+        const int64_t *restrict Ap = A->p ;
+
+        // Work [tid*(NBINS+1) ... ] holds the histogram of task tid, followed
+        // by the max degree of its vectors
+        const int64_t wsize = GB_PROFILE_NBINS + 1 ;
+        Work = GB_CALLOC_WERK (nthreads * wsize, int64_t, &Work_size) ;
+        if (Work == NULL)
+        { 
+            // out of memory; the caller uses its default heuristics instead
+            P->valid = false ;
+            return (false) ;
+        }
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t kfirst, klast ;
+            GB_PARTITION (kfirst, klast, anvec, tid, nthreads) ;
+            int64_t *restrict W = Work + tid * wsize ;
+            int64_t my_maxdeg = 0 ;
+            for (int64_t k = kfirst ; k < klast ; k++)
+            { 
+                int64_t d = Ap [k+1] - Ap [k] ;
+                W [GB_PROFILE_BIN (d)]++ ;
+                my_maxdeg = GB_IMAX (my_maxdeg, d) ;
+            }
+            W [GB_PROFILE_NBINS] = my_maxdeg ;
+        }
+
+        // sum up the results of each task
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            const int64_t *restrict W = Work + tid * wsize ;
+            for (int k = 0 ; k < GB_PROFILE_NBINS ; k++)
+            { 
+                P->hist [k] += W [k] ;
+            }
+            maxdeg = GB_IMAX (maxdeg, W [GB_PROFILE_NBINS]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize the summary and its key
+    //--------------------------------------------------------------------------
+
+    P->nvec_nonempty = anvec - P->hist [0] ;
+    P->maxdeg = maxdeg ;
+    P->avgdeg = (double) anz / (double) GB_IMAX (P->nvec_nonempty, 1) ;
+
+    P->p_key = A->p ;
+    P->h_key = A->h ;
+    P->i_key = A->i ;
+    P->nvec_key = anvec ;
+    P->nvals_key = anz ;
+    P->nzombies_key = A->nzombies ;
+    P->valid = true ;
+
+    GB_FREE_ALL ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_profile: return the summary of A, without modifying A
+//------------------------------------------------------------------------------
+
+const GB_Profile *GB_profile    // return the summary of A, or NULL
+(
+    GB_Profile *P,              // workspace for the summary, if not cached
+    const GrB_Matrix A,
+    GB_Context Context
+)
+{
+
+    ASSERT (A != NULL && P != NULL) ;
+    ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (GB_PENDING_OK (A)) ;
+
+    if (GB_IS_BITMAP (A) || GB_PENDING (A))
+    { 
+        // no summary is computed for a bitmap matrix, or pending tuples
+        return (NULL) ;
+    }
+    else if (GB_profile_cached (A))
+    { 
+        // return the summary cached in A
+        return (&(A->profile)) ;
+    }
+    else
+    { 
+        // compute the summary in P
+        return (GB_profile_compute (P, A, Context) ? P : NULL) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_profile_cache: compute the summary of A and cache it in A->profile
+//------------------------------------------------------------------------------
+
+void GB_profile_cache
+(
+    GrB_Matrix A,               // matrix to summarize, owned by the caller
+    GB_Context Context
+)
+{
+
+    ASSERT (A != NULL) ;
+    if (GB_IS_BITMAP (A) || GB_PENDING (A) || GB_profile_cached (A))
+    { 
+        // no summary is cached, or it is already valid
+        return ;
+    }
+    if (GB_profile_compute (&(A->profile), A, Context) &&
+        A->nvec_nonempty < 0)
+    { 
+        A->nvec_nonempty = A->profile.nvec_nonempty ;
+    }
+}
+
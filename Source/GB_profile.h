@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+// GB_profile.h: cached structural summary of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_profile (&P, A, Context) returns a summary of the vector degrees of A (see
+// GB_Profile_struct in GB_opaque.h): A->profile if it is valid, or else the
+// summary computed in the caller's workspace P.  A is not modified, since it
+// may be an input matrix read by other user threads at the same time.  The
+// summary is cached in A->profile only by GB_profile_cache, when A is
+// finished by GrB_Matrix_wait or GrB_Vector_wait, and for the tiles of
+// GB_AxB_tiled.  The summary is used by the heuristics that select the
+// method for C=A*B:
+//
+//  GB_AxB_dot2_control: dot2 vs saxpy for C=A'*B, using the number of
+//      non-empty vectors of A and B, and the median vector degree of A
+//      instead of its mean, which is misleading for skewed matrices.
+//  GB_AxB_saxpy3_slice_balanced: Hash vs Gustavson, and the number of
+//      initial coarse tasks, if the degrees of A or B are skewed.
+//
+// A->profile is valid while its key (A->p, A->h, A->i, A->nvec, GB_NNZ (A),
+// and A->nzombies) matches A.  It is also invalidated explicitly when the
+// content of A is freed (GB_ph_free) or its pending work is finished
+// (GB_Matrix_wait), since a new allocation may reuse the same addresses.  The
+// degrees include any zombies.  No summary is computed for a bitmap matrix,
+// since this would take O(vlen*vdim) time, nor for a matrix with pending
+// tuples; GB_profile returns NULL in these cases (or if out of memory), and
+// the callers then fall back to their default heuristics.  The summary
+// describes only the vectors of A; the degrees of the other dimension (the
+// rows of a CSC matrix) would take O(nnz(A)) time and workspace, and are not
+// computed.
+
+#ifndef GB_PROFILE_H
+#define GB_PROFILE_H
+
+// a matrix is skewed if its largest vector has GB_PROFILE_SKEW times more
+// entries than the average non-empty vector, and at least GB_PROFILE_HUB
+// entries
+#define GB_PROFILE_SKEW 32
+#define GB_PROFILE_HUB 256
+
+typedef struct GB_Profile_struct GB_Profile ;
+
+const GB_Profile *GB_profile    // return the summary of A, or NULL
+(
+    GB_Profile *P,              // workspace for the summary, if not cached
+    const GrB_Matrix A,
+    GB_Context Context
+) ;
+
+void GB_profile_cache
+(
+    GrB_Matrix A,               // matrix to summarize, owned by the caller
+    GB_Context Context
+) ;
+
+// GB_profile_cached: true if A->profile is valid for the content of A
+static inline bool GB_profile_cached (const GrB_Matrix A)
+{
+    const GB_Profile *P = &(A->profile) ;
+    return (P->valid && P->p_key == A->p && P->h_key == A->h
+        && P->i_key == A->i && P->nvec_key == A->nvec
+        && P->nvals_key == GB_NNZ (A) && P->nzombies_key == A->nzombies) ;
+}
+
+// GB_profile_invalidate: mark the cached summary of A as invalid
+static inline void GB_profile_invalidate (GrB_Matrix A)
+{
+    A->profile.valid = false ;
+}
+
+// GB_profile_skewed: true if the vector degrees of A are highly skewed
+static inline bool GB_profile_skewed (const GB_Profile *P)
+{
+    return (P != NULL && P->maxdeg >= GB_PROFILE_HUB &&
+        P->maxdeg > GB_PROFILE_SKEW * P->avgdeg) ;
+}
+
+// GB_profile_median: estimate of the median degree of the non-empty vectors
+static inline int64_t GB_profile_median (const GB_Profile *P)
+{
+    // returns the lower bound 2^(k-1) of the bin k holding the median
+    int64_t half = P->nvec_nonempty / 2, count = 0 ;
+    for (int k = 1 ; k < GB_PROFILE_NBINS ; k++)
+    {
+        count += P->hist [k] ;
+        if (count > half) return (((int64_t) 1) << (k-1)) ;
+    }
+    return (0) ;
+}
+
+#endif
+
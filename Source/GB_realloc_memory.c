@@ -163,6 +163,8 @@ void *GB_realloc_memory     // pointer to reallocated block of memory, or
 //          printf ("hard realloc %p oldsize %ld newsize %ld\n",
 //              p, oldsize_allocated, newsize_allocated) ;
             pnew = GB_Global_realloc_function (p, newsize_allocated) ;
+            // the block may have moved, or grown past the huge-page threshold
+            GB_huge_page_advise (pnew, newsize_allocated) ;
 //          GB_Global_free_pool_dump (2) ; GB_Global_memtable_dump ( ) ;
         }
     }
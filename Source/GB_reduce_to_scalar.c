@@ -22,8 +22,12 @@
 // case when nvals(A) is zero, the existence of the identity value makes the
 // code a little simpler.
 
+// If A has a deferred unary operator (see GB_apply.c), s = reduce (op (A)) is
+// computed in blocks, without constructing op(A) in full.
+
 #include "GB_reduce.h"
 #include "GB_binop.h"
+#include "GB_apply.h"
 #include "GB_atomics.h"
 #ifndef GBCOMPACT
 #include "GB_red__include.h"
@@ -35,6 +39,102 @@
     GB_WERK_POP (W, GB_void) ;      \
 }
 
+// # of entries of op(A) in each block, per thread, for a deferred op
+#define GB_REDUCE_DEFERRED_BLOCK (64*1024)
+
+//------------------------------------------------------------------------------
+// GB_reduce_deferred: s += reduce (op (A)) for a matrix with a deferred op
+//------------------------------------------------------------------------------
+
+// A is not bitmap, and has no zombies or pending tuples, so its values are
+// held in A->x [0..anz-1].  Each block X of A->x is computed as T = op (X),
+// in a small workspace, and then s = s + reduce (T).
+
+static GrB_Info GB_reduce_deferred
+(
+    GB_void *s,                 // scalar to accumulate into
+    const GrB_Monoid reduce,    // monoid to do the reduction
+    const GrB_Matrix A,         // matrix with a deferred op
+    GB_Context Context
+)
+{
+
+    GrB_Info info ;
+    ASSERT (GB_DEFERRED (A)) ;
+    ASSERT (!GB_IS_BITMAP (A) && !GB_ZOMBIES (A) && !GB_PENDING (A)) ;
+    GrB_UnaryOp op = A->deferred_op ;
+    GrB_Type xtype = A->deferred_type ;
+    GrB_Type ttype = A->type ;
+    GrB_Type ztype = reduce->op->ztype ;
+    size_t xsize = xtype->size ;
+    size_t tsize = ttype->size ;
+    int64_t anz = GB_NNZ_HELD (A) ;
+    GB_BURBLE_MATRIX (A, "(fused reduce of deferred %s) ", op->name) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for a single block of op(A)
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int64_t bsize = GB_REDUCE_DEFERRED_BLOCK * (int64_t) nthreads_max ;
+    bsize = GB_IMAX (GB_IMIN (bsize, anz), 1) ;
+    size_t Tx_size = 0 ;
+    GB_void *Tx = GB_MALLOC_WERK (bsize * tsize, GB_void, &Tx_size) ;
+    if (Tx == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // s += reduce (op (A)), one block at a time
+    //--------------------------------------------------------------------------
+
+    struct GB_Matrix_opaque X_header, T_header ;
+    GrB_Matrix X = GB_clear_static_header (&X_header) ;
+    GrB_Matrix T = GB_clear_static_header (&T_header) ;
+    GB_void *terminal = (GB_void *) reduce->terminal ;
+    info = GrB_SUCCESS ;
+
+    for (int64_t pstart = 0 ; pstart < anz && info == GrB_SUCCESS ;
+        pstart += bsize)
+    {
+        // X and T are bsize-by-1 full matrices, with shallow values
+        int64_t len = GB_IMIN (bsize, anz - pstart) ;
+        info = GB_new (&X, true, xtype, len, 1, GB_Ap_null, true,
+            GxB_FULL, GxB_NEVER_HYPER, 0, Context) ;
+        if (info != GrB_SUCCESS) break ;
+        info = GB_new (&T, true, ttype, len, 1, GB_Ap_null, true,
+            GxB_FULL, GxB_NEVER_HYPER, 0, Context) ;
+        if (info != GrB_SUCCESS) break ;
+        X->x = ((GB_void *) A->x) + pstart * xsize ;
+        X->x_shallow = true ;
+        X->nzmax = len ;
+        X->magic = GB_MAGIC ;
+        T->x = Tx ;
+        T->x_shallow = true ;
+        T->nzmax = len ;
+        T->magic = GB_MAGIC ;
+
+        // T = op (X)
+        info = GB_apply_op (Tx, op, NULL, NULL, false, X, Context) ;
+        if (info != GrB_SUCCESS) break ;
+
+        // s = s + reduce (T)
+        info = GB_reduce_to_scalar (s, ztype, reduce->op, reduce, T, Context) ;
+
+        // stop early if the terminal value has been reached
+        if (terminal != NULL && memcmp (s, terminal, ztype->size) == 0) break ;
+    }
+
+    GB_FREE_WERK (&Tx, Tx_size, Context) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_reduce_to_scalar: c = accum (c, reduce_to_scalar (A))
+//------------------------------------------------------------------------------
+
 GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
 (
     void *c,                    // result scalar
@@ -76,7 +176,12 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     // assemble any pending tuples; zombies are OK
     //--------------------------------------------------------------------------
 
-    GB_MATRIX_WAIT_IF_PENDING (A) ;
+    // a deferred op on A is fused with the reduction, unless A is bitmap
+    bool A_deferred = GB_DEFERRED (A) && !GB_IS_BITMAP (A) ;
+    if (!A_deferred)
+    { 
+        GB_MATRIX_WAIT_IF_PENDING (A) ;
+    }
     GB_BURBLE_DENSE (A, "(A %s) ") ;
 
     ASSERT (GB_ZOMBIES_OK (A)) ;
@@ -99,6 +204,17 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     // s = reduce_to_scalar (A) on the GPU(s) or CPU
     //--------------------------------------------------------------------------
 
+    if (A_deferred)
+    { 
+
+        //----------------------------------------------------------------------
+        // s = reduce (op (A)), fused with the deferred op of A
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_reduce_deferred (s, reduce, A, Context)) ;
+
+    }
+    else
     #if defined ( GBCUDA )
     if (GB_reduce_to_scalar_cuda_branch (reduce, A, Context))
     {
@@ -205,6 +321,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
 
                 // the switch factory didn't handle this case
                 GxB_binary_function freduce = reduce->op->function ;
+                GB_BINOP_VECTOR (freduce, reduce->op) ;
 
                 #define GB_ATYPE GB_void
 
@@ -227,7 +344,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
 
                 // s += W [k], no typecast
                 #define GB_ADD_ARRAY_TO_SCALAR(s,W,k)                   \
-                    freduce (s, s, W +((k)*zsize))
+                    GB_BINOP_CALL (freduce, s, s, W +((k)*zsize))
 
                 // break if terminal value reached
                 #define GB_HAS_TERMINAL 1
@@ -240,7 +357,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
 
                 // t += (ztype) Ax [p], but no typecasting needed
                 #define GB_ADD_CAST_ARRAY_TO_SCALAR(t,Ax,p)             \
-                    freduce (t, t, Ax +((p)*zsize))
+                    GB_BINOP_CALL (freduce, t, t, Ax +((p)*zsize))
 
                 #include "GB_reduce_to_scalar_template.c"
             }
@@ -257,6 +374,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
                 " %s) ", reduce->op->name) ;
 
             GxB_binary_function freduce = reduce->op->function ;
+            GB_BINOP_VECTOR (freduce, reduce->op) ;
             GB_cast_function
                 cast_A_to_Z = GB_cast_factory (ztype->code, A->type->code) ;
 
@@ -270,7 +388,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
                 #define GB_ADD_CAST_ARRAY_TO_SCALAR(t,Ax,p)             \
                     GB_void awork [GB_VLA(zsize)] ;                     \
                     cast_A_to_Z (awork, Ax +((p)*asize), asize) ;       \
-                    freduce (t, t, awork)
+                    GB_BINOP_CALL (freduce, t, t, awork)
 
                 #include "GB_reduce_to_scalar_template.c"
         }
@@ -293,6 +411,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     else
     { 
         GxB_binary_function faccum = accum->function ;
+        GB_BINOP_VECTOR (faccum, accum) ;
 
         GB_cast_function cast_C_to_xaccum, cast_Z_to_yaccum, cast_zaccum_to_C ;
         cast_C_to_xaccum = GB_cast_factory (accum->xtype->code, ctype->code) ;
@@ -311,7 +430,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
         cast_Z_to_yaccum (yaccum, s, zsize) ;
 
         // zaccum = xaccum "+" yaccum
-        faccum (zaccum, xaccum, yaccum) ;
+        GB_BINOP_CALL (faccum, zaccum, xaccum, yaccum) ;
 
         // c = (ctype) zaccum
         cast_zaccum_to_C (c, zaccum, ctype->size) ;
@@ -0,0 +1,239 @@
+//------------------------------------------------------------------------------
+// GB_removeElements: remove C(I(k),J(k)) for k = 0:nvals-1
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Removes a list of entries from C, with the same result as calling
+// GrB_*_removeElement for each tuple.  Not user-callable; does the work for
+// GxB_*_removeElements.
+
+// The tuples are sorted by GB_elements_sort, and then split into tasks that
+// remove their entries in parallel, turning them into zombies.  If any entry
+// is not found and C has pending tuples, the pending tuples are assembled and
+// the list is swept once more, just like GrB_*_removeElement.
+
+#include "GB_elements.h"
+
+#define GB_FREE_ALL                                      \
+{                                                        \
+    GB_FREE_WERK (&I_work, I_work_size, Context) ;       \
+    GB_FREE_WERK (&J_work, J_work_size, Context) ;       \
+    GB_FREE_WERK (&K_work, K_work_size, Context) ;       \
+}
+
+//------------------------------------------------------------------------------
+// GB_removeElements_sweep: remove the entries of a sorted list
+//------------------------------------------------------------------------------
+
+// Returns the number of entries not found in C.  C is sparse, hypersparse, or
+// bitmap, and not jumbled.
+
+static int64_t GB_removeElements_sweep
+(
+    GrB_Matrix C,
+    const int64_t *restrict I_work,
+    const int64_t *restrict J_work,
+    const int64_t nvals,
+    const int nthreads,
+    const int ntasks
+)
+{
+
+    ASSERT (!GB_IS_FULL (C)) ;
+    ASSERT (!GB_JUMBLED (C)) ;
+
+    int64_t *restrict Ci = C->i ;
+    int8_t  *restrict Cb = C->b ;
+    const int64_t cvlen = C->vlen ;
+    int64_t nremoved = 0, nmissing = 0 ;
+
+    if (Cb == NULL && C->nzmax == 0)
+    {
+        // C has no entries, just pending tuples (if any)
+        return (nvals) ;
+    }
+
+    // Other tasks can turn entries into zombies while a task searches the
+    // same vector, so the search must always tolerate zombies.
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:nremoved,nmissing)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t tstart, tend ;
+        GB_PARTITION (tstart, tend, nvals, tid, ntasks) ;
+        int64_t jlast = -1, kleft = 0, pstart = 0, pend = 0 ;
+        for (int64_t t = tstart ; t < tend ; t++)
+        {
+            if (!GB_elements_last (I_work, J_work, t, nvals))
+            {
+                // a later tuple in the list removes the same entry
+                continue ;
+            }
+            int64_t i = I_work [t] ;
+            int64_t j = J_work [t] ;
+            if (Cb != NULL)
+            {
+                // C is bitmap; C(i,j) is always found, present or not
+                int64_t pC = i + j * cvlen ;
+                nremoved += Cb [pC] ;
+                Cb [pC] = 0 ;
+            }
+            else
+            {
+                // C is sparse or hypersparse
+                int64_t pC ;
+                bool is_zombie ;
+                if (GB_elements_lookup (&pC, &is_zombie, C, i, j, 1,
+                    &jlast, &kleft, &pstart, &pend))
+                {
+                    if (!is_zombie)
+                    {
+                        // C(i,j) becomes a zombie
+                        Ci [pC] = GB_FLIP (i) ;
+                        nremoved++ ;
+                    }
+                }
+                else
+                {
+                    // C(i,j) might be a pending tuple
+                    nmissing++ ;
+                }
+            }
+        }
+    }
+
+    if (Cb != NULL)
+    {
+        C->nvals -= nremoved ;
+    }
+    else
+    {
+        C->nzombies += nremoved ;
+    }
+    return (nmissing) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_removeElements
+//------------------------------------------------------------------------------
+
+GrB_Info GB_removeElements      // remove C(I(k),J(k)) for k = 0:nvals-1
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices (NULL if C is a GrB_Vector)
+    const GrB_Index nvals,      // number of tuples
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *I_work = NULL ; size_t I_work_size = 0 ;
+    int64_t *J_work = NULL ; size_t J_work_size = 0 ;
+    int64_t *K_work = NULL ; size_t K_work_size = 0 ;
+
+    ASSERT (C != NULL) ;
+    GB_RETURN_IF_NULL (I) ;
+
+    if (nvals > GxB_INDEX_MAX)
+    {
+        // problem too large
+        GB_ERROR (GrB_INVALID_VALUE,
+            "Problem too large: nvals " GBu " exceeds " GBu,
+            nvals, GxB_INDEX_MAX) ;
+    }
+
+    if (nvals == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT (GB_JUMBLED_OK (C)) ;
+    ASSERT (GB_PENDING_OK (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    //--------------------------------------------------------------------------
+    // check and sort the tuples
+    //--------------------------------------------------------------------------
+
+    // K_work is not needed since no values are used; duplicates are simply
+    // removed once.
+    GB_OK (GB_elements_sort (&I_work, &I_work_size, &J_work, &J_work_size,
+        &K_work, &K_work_size, C, I, J, (int64_t) nvals, Context)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, (int64_t) nvals) ;
+
+    //--------------------------------------------------------------------------
+    // remove the entries
+    //--------------------------------------------------------------------------
+
+    // If any entry is not found and C has pending tuples, GB_Matrix_wait
+    // assembles them and the list is swept again.  GB_Matrix_wait leaves C
+    // with no pending tuples, so at most two sweeps are done.
+
+    while (true)
+    {
+
+        //----------------------------------------------------------------------
+        // if C is jumbled, wait on the matrix first.  If full, make it nonfull
+        //----------------------------------------------------------------------
+
+        if (GB_IS_FULL (C))
+        {
+            // convert C from full to sparse
+            GB_OK (GB_convert_to_nonfull (C, Context)) ;
+        }
+        else if (C->jumbled)
+        {
+            // C is sparse or hypersparse, and jumbled
+            GB_OK (GB_Matrix_wait (C, "C", Context)) ;
+        }
+        ASSERT (!GB_IS_FULL (C)) ;
+        ASSERT (!GB_JUMBLED (C)) ;
+
+        //----------------------------------------------------------------------
+        // remove the entries of the list from C
+        //----------------------------------------------------------------------
+
+        int64_t nmissing = GB_removeElements_sweep (C, I_work, J_work,
+            (int64_t) nvals, nthreads, ntasks) ;
+        if (nmissing == 0 || !GB_PENDING (C))
+        {
+            break ;
+        }
+
+        //----------------------------------------------------------------------
+        // assemble the pending tuples; some entries may have been pending
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_Matrix_wait (C, "C", Context)) ;
+        ASSERT (!GB_PENDING (C)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    ASSERT_MATRIX_OK (C, "C for removeElements", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -204,8 +204,14 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
 
-    GB_MATRIX_WAIT (M) ;        // TODO: delay until accum/mask phase
-    GB_MATRIX_WAIT (A) ;        // TODO: could tolerate jumbled in some cases
+    // M is finished by GB_accum_mask, if needed.  A can be jumbled for all
+    // but the positional selectors (tril, triu, diag, and offdiag), which
+    // rely on the sorted row indices in each vector of A.
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
+    if (op_is_positional)
+    { 
+        GB_MATRIX_WAIT_IF_JUMBLED (A) ;
+    }
 
     GB_BURBLE_DENSE (C, "(C %s) ") ;
     GB_BURBLE_DENSE (M, "(M %s) ") ;
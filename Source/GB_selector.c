@@ -22,7 +22,7 @@
 
 #define GB_FREE_WORK                        \
 {                                           \
-    GB_FREE_WERK (&Zp, Zp_size) ;           \
+    GB_FREE_WERK (&Zp, Zp_size, Context) ;  \
     GB_WERK_POP (Work, int64_t) ;           \
     GB_WERK_POP (A_ek_slicing, int64_t) ;   \
     GB_FREE (&Cp, Cp_size) ;                \
@@ -44,7 +44,9 @@ GrB_Info GB_selector
     const GxB_SelectOp op,      // user operator
     const bool flipij,          // if true, flip i and j for user operator
     GrB_Matrix A,               // input matrix
-    int64_t ithunk,             // (int64_t) Thunk, if Thunk is NULL
+    int64_t ithunk,             // (int64_t) Thunk, if Thunk is NULL.  For
+                                // the in-place NONZOMBIE selector, this is
+                                // the extra space to reserve in A.
     const GxB_Scalar Thunk,     // optional input for select operator
     GB_Context Context
 )
@@ -289,9 +291,18 @@ GrB_Info GB_selector
     //--------------------------------------------------------------------------
 
     cnz = Cp [anvec] ;
+    int64_t cnzmax = cnz ;
+    if (in_place_A && opcode == GB_NONZOMBIE_opcode)
+    { 
+        // GB_Matrix_wait is pruning the zombies from A, and ithunk is the
+        // number of pending tuples that it will then add to A.  Leave space
+        // for them, so that A need not be reallocated again.
+        cnzmax += ithunk ;
+    }
+    cnzmax = GB_IMAX (cnzmax, 1) ;
     cnz = GB_IMAX (cnz, 1) ;
-    Ci = GB_MALLOC (cnz, int64_t, &Ci_size) ;
-    Cx = GB_MALLOC (cnz * asize, GB_void, &Cx_size) ;
+    Ci = GB_MALLOC (cnzmax, int64_t, &Ci_size) ;
+    Cx = GB_MALLOC (cnzmax * asize, GB_void, &Cx_size) ;
     if (Ci == NULL || Cx == NULL)
     { 
         // out of memory
@@ -361,6 +372,8 @@ GrB_Info GB_selector
             // free the old A->p and transplant in Cp as the new A->p
             GB_FREE (&Ap, Ap_size) ;
             A->p = Cp ; Cp = NULL ; A->p_size = Cp_size ;
+            // Cp has size anvec+1, which may be smaller than the old A->p
+            A->plen = anvec ;
         }
 
         ASSERT (Cp == NULL) ;
@@ -369,7 +382,7 @@ GrB_Info GB_selector
         GB_FREE (&Ax, Ax_size) ;
         A->i = Ci ; Ci = NULL ; A->i_size = Ci_size ;
         A->x = Cx ; Cx = NULL ; A->x_size = Cx_size ;
-        A->nzmax = cnz ;
+        A->nzmax = cnzmax ;
         A->nvec_nonempty = C_nvec_nonempty ;
         A->jumbled = A_jumbled ;        // A remains jumbled (in-place select)
 
@@ -81,7 +81,7 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     ASSERT (GB_ZOMBIES_OK (C)) ;
 
     #if GB_BURBLE
-    bool burble = GB_Global_burble_get ( ) ;
+    bool burble = GB_Context_burble_get ( ) ;
     double t_burble = 0 ;
     // do not burble when waiting on scalars or empty matrices
     burble = burble && ((C->vlen > 1) || (C->vdim > 1)) ;
@@ -261,7 +261,10 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
             #endif
 
             // delete any lingering zombies and assemble the pending tuples
-            GB_OK (GB_Matrix_wait (C, "C", Context)) ;
+            GB_thread_budget_begin ( ) ;
+            info = GB_Matrix_wait (C, "C", Context) ;
+            GB_thread_budget_end ( ) ;
+            GB_OK (info) ;
 
             #if GB_BURBLE
             if (burble)
@@ -320,7 +323,9 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
         }
         #endif
 
+        GB_thread_budget_begin ( ) ;
         info = GB_block (C, Context) ;
+        GB_thread_budget_end ( ) ;
 
         #if GB_BURBLE
         if (burble)
@@ -0,0 +1,243 @@
+//------------------------------------------------------------------------------
+// GB_setElements: C(I(k),J(k)) = X(k) for k = 0:nvals-1
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Sets a list of entries in C, with the same result as calling GB_setElement
+// for each tuple in order, typecasting from the type of X to the type of C, as
+// needed.  If a tuple appears more than once, the last one in the list is
+// used.  Not user-callable; does the work for GxB_*_setElements_*.
+
+// The tuples are sorted by GB_elements_sort, and then split into tasks that
+// look up their entries in parallel.  Entries that are found are overwritten
+// in place (bringing zombies back to life), just like GB_setElement.  Tuples
+// not found are appended in sorted order to the list of pending tuples, so
+// that pending tuples from a single call to GxB_*_setElements stay sorted.
+
+#include "GB_elements.h"
+#include "GB_Pending.h"
+
+#define GB_FREE_WORK                                     \
+{                                                        \
+    GB_FREE_WERK (&I_work, I_work_size, Context) ;       \
+    GB_FREE_WERK (&J_work, J_work_size, Context) ;       \
+    GB_FREE_WERK (&K_work, K_work_size, Context) ;       \
+    GB_FREE_WERK (&Mark, Mark_size, Context) ;           \
+}
+
+#define GB_FREE_ALL GB_FREE_WORK
+
+GrB_Info GB_setElements         // C(I(k),J(k)) = X(k) for k = 0:nvals-1
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices (NULL if C is a GrB_Vector)
+    const void *X,              // values to set
+    const GrB_Index nvals,      // number of tuples
+    const GB_Type_code xcode,   // type of X
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *I_work = NULL ; size_t I_work_size = 0 ;
+    int64_t *J_work = NULL ; size_t J_work_size = 0 ;
+    int64_t *K_work = NULL ; size_t K_work_size = 0 ;
+    int8_t  *restrict Mark   = NULL ; size_t Mark_size   = 0 ;
+
+    ASSERT (C != NULL) ;
+    GB_RETURN_IF_NULL (I) ;
+    GB_RETURN_IF_NULL (X) ;
+    ASSERT (xcode <= GB_UDT_code) ;
+
+    GrB_Type ctype = C->type ;
+    GB_Type_code ccode = ctype->code ;
+
+    // xcode and C must be compatible
+    if (!GB_code_compatible (xcode, ccode))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Input values of type [%s]\n"
+            "cannot be typecast to entries of type [%s]",
+            GB_code_string (xcode), ctype->name) ;
+    }
+
+    if (nvals > GxB_INDEX_MAX)
+    {
+        // problem too large
+        GB_ERROR (GrB_INVALID_VALUE,
+            "Problem too large: nvals " GBu " exceeds " GBu,
+            nvals, GxB_INDEX_MAX) ;
+    }
+
+    if (nvals == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    // pending tuples and zombies are expected, and C might be jumbled too
+    ASSERT (GB_JUMBLED_OK (C)) ;
+    ASSERT (GB_PENDING_OK (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    //--------------------------------------------------------------------------
+    // sort C if needed, and assemble any incompatible pending tuples
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT_IF_JUMBLED (C) ;
+
+    // The new pending tuples have type stype and the implicit SECOND_ctype
+    // operator, just like GB_setElement.  If prior pending tuples differ in
+    // either, they must be assembled first.  This is done before any entries
+    // are found, since GB_Matrix_wait moves the entries of C.
+    GrB_Type stype = GB_code_type (xcode, ctype) ;
+    if (C->Pending != NULL && (stype != C->Pending->type ||
+        !GB_op_is_second (C->Pending->op, ctype)))
+    {
+        GB_OK (GB_Matrix_wait (C, "C", Context)) ;
+    }
+
+    ASSERT (!GB_JUMBLED (C)) ;
+
+    //--------------------------------------------------------------------------
+    // check and sort the tuples
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_elements_sort (&I_work, &I_work_size, &J_work, &J_work_size,
+        &K_work, &K_work_size, C, I, J, (int64_t) nvals, Context)) ;
+
+    Mark = GB_MALLOC_WERK (nvals, int8_t, &Mark_size) ;
+    if (Mark == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, (int64_t) nvals) ;
+
+    //--------------------------------------------------------------------------
+    // set the entries already in C, in parallel
+    //--------------------------------------------------------------------------
+
+    // Only the last of any set of duplicates is used, so each entry of C is
+    // modified by at most one task.  Bringing a zombie back to life does not
+    // affect the binary search of other tasks in the same vector, since
+    // GB_BINARY_SEARCH_ZOMBIE compares GB_UNFLIP (Ci [p]).
+
+    const size_t csize = ctype->size ;
+    const size_t xsize = stype->size ;
+    GB_cast_function cast_X_to_C = GB_cast_factory (ccode, xcode) ;
+    GB_void *restrict Cx = (GB_void *) C->x ;
+    const GB_void *restrict Xx = (GB_void *) X ;
+    int64_t *restrict Ci = C->i ;
+    int8_t  *restrict Cb = C->b ;
+    const bool C_is_sparse_or_hyper = !(GB_IS_FULL (C) || GB_IS_BITMAP (C)) ;
+    const int64_t cvlen = C->vlen ;
+    const int64_t nzombies = C->nzombies ;
+
+    int64_t nrevived = 0, nnew = 0, npending = 0 ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:nrevived,nnew,npending)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t tstart, tend ;
+        GB_PARTITION (tstart, tend, (int64_t) nvals, tid, ntasks) ;
+        int64_t jlast = -1, kleft = 0, pstart = 0, pend = 0 ;
+        for (int64_t t = tstart ; t < tend ; t++)
+        {
+            Mark [t] = 0 ;
+            if (!GB_elements_last (I_work, J_work, t, nvals))
+            {
+                // a later tuple in the list sets the same entry
+                continue ;
+            }
+            int64_t i = I_work [t] ;
+            int64_t j = J_work [t] ;
+            int64_t k = (K_work == NULL) ? t : K_work [t] ;
+            int64_t pC ;
+            bool is_zombie = false ;
+            if (!C_is_sparse_or_hyper)
+            {
+                // C is bitmap or full
+                pC = i + j * cvlen ;
+            }
+            else if (!GB_elements_lookup (&pC, &is_zombie, C, i, j, nzombies,
+                &jlast, &kleft, &pstart, &pend))
+            {
+                // C(i,j) not found: add it as a pending tuple, below
+                Mark [t] = 1 ;
+                npending++ ;
+                continue ;
+            }
+            // typecast or copy X(k) into C(i,j)
+            cast_X_to_C (Cx +(pC*csize), Xx +(k*xsize), csize) ;
+            if (is_zombie)
+            {
+                // bring the zombie back to life
+                Ci [pC] = i ;
+                nrevived++ ;
+            }
+            else if (Cb != NULL)
+            {
+                // set the entry in the C bitmap
+                nnew += (Cb [pC] == 0) ;
+                Cb [pC] = 1 ;
+            }
+        }
+    }
+
+    C->nzombies -= nrevived ;
+    C->nvals += nnew ;
+
+    //--------------------------------------------------------------------------
+    // append the tuples not found to the list of pending tuples
+    //--------------------------------------------------------------------------
+
+    if (npending > 0)
+    {
+        ASSERT (C_is_sparse_or_hyper) ;
+        ASSERT (GB_PENDING_OK (C)) ;
+        for (int64_t t = 0 ; t < (int64_t) nvals ; t++)
+        {
+            if (!Mark [t]) continue ;
+            int64_t k = (K_work == NULL) ? t : K_work [t] ;
+            if (!GB_Pending_add (&(C->Pending), Xx +(k*xsize), stype, NULL,
+                I_work [t], J_work [t], C->vdim > 1, Context))
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                GB_phbix_free (C) ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+        ASSERT (GB_op_is_second (C->Pending->op, ctype)) ;
+        ASSERT (C->Pending->type == stype) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and finish the work if the mode is blocking
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK ;
+    ASSERT_MATRIX_OK (C, "C for setElements", GB0) ;
+    return ((npending > 0) ? GB_block (C, Context) : GrB_SUCCESS) ;
+}
+
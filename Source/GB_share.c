@@ -0,0 +1,134 @@
+//------------------------------------------------------------------------------
+// GB_share: C shares the content of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The content of A is moved into a GB_Shared object (A->shared), if it is not
+// already there, and both A and C hold shallow pointers to it.  C must have no
+// content on input; its header (type, dimensions, format, and sparsity
+// control) is not modified, except for its content and the fields that
+// describe it.  A must have no pending work.  This takes O(1) time, unless A
+// has changed some of its shared content since it was first shared.  Then A
+// is first given its own copy of what remains shared (see GB_unshare).
+
+// This method is used by GB_snapshot, and by GB_apply to defer C=op(A).  In
+// GB_apply, A is a read-only input that other user threads may be reading, or
+// sharing, at the same time, so GB_apply only defers C=op(A) if
+// GB_SHAREABLE (A) is true.  Then the pointers to the content of A never
+// change; only its ownership moves into the GB_Shared object.  That move is
+// done in a critical section, so that when two user threads share the same A
+// at the same time, only one of them creates its GB_Shared object.
+
+#include "GB.h"
+#include "GB_atomics.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_share               // C shares the content of A
+(
+    GrB_Matrix C,               // matrix with no content
+    GrB_Matrix A,               // matrix whose content is shared
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && C != A) ;
+    ASSERT (C->p == NULL && C->h == NULL && C->b == NULL && C->i == NULL) ;
+    ASSERT (C->x == NULL && C->shared == NULL && !GB_PENDING (C)) ;
+    ASSERT_MATRIX_OK (A, "A to share", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (C->vlen == A->vlen && C->vdim == A->vdim) ;
+
+    //--------------------------------------------------------------------------
+    // move the content of A into a shared object, if not already shared
+    //--------------------------------------------------------------------------
+
+    GB_Shared shared = A->shared ;
+    if (shared != NULL && !GB_SHAREABLE (A))
+    { 
+        // A has changed some of its content since it was first shared, so
+        // give A its own copy of what remains shared
+        GB_OK (GB_unshare (A, Context)) ;
+        shared = NULL ;
+    }
+
+    if (shared == NULL)
+    {
+        // allocate a new shared object, which is used only if A does not
+        // yet have one when the critical section is reached
+        size_t header_size ;
+        GB_Shared shared_new = GB_CALLOC (1, struct GB_Shared_struct,
+            &header_size) ;
+        if (shared_new == NULL)
+        { 
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        shared_new->header_size = header_size ;
+        shared_new->nshared = 1 ;
+
+        #pragma omp critical (GB_share)
+        {
+            shared = A->shared ;
+            if (shared == NULL)
+            { 
+                // move each component of A into the shared object
+                ASSERT (!GB_is_shallow (A)) ;
+                shared = shared_new ;
+                shared_new = NULL ;
+                shared->p = A->p ; shared->p_size = A->p_size ;
+                shared->h = A->h ; shared->h_size = A->h_size ;
+                shared->b = A->b ; shared->b_size = A->b_size ;
+                shared->i = A->i ; shared->i_size = A->i_size ;
+                shared->x = A->x ; shared->x_size = A->x_size ;
+                A->p_size = 0 ; A->p_shallow = (A->p != NULL) ;
+                A->h_size = 0 ; A->h_shallow = (A->h != NULL) ;
+                A->b_size = 0 ; A->b_shallow = (A->b != NULL) ;
+                A->i_size = 0 ; A->i_shallow = (A->i != NULL) ;
+                A->x_size = 0 ; A->x_shallow = (A->x != NULL) ;
+                A->shared = shared ;
+            }
+        }
+
+        if (shared_new != NULL)
+        { 
+            // another user thread shared A first
+            GB_FREE (&shared_new, header_size) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // C uses the same content as A
+    //--------------------------------------------------------------------------
+
+    // all of the content of A is now in the shared object, so each component
+    // of C is shallow if present
+    C->p = A->p ; C->p_shallow = (C->p != NULL) ; C->p_size = 0 ;
+    C->h = A->h ; C->h_shallow = (C->h != NULL) ; C->h_size = 0 ;
+    C->b = A->b ; C->b_shallow = (C->b != NULL) ; C->b_size = 0 ;
+    C->i = A->i ; C->i_shallow = (C->i != NULL) ; C->i_size = 0 ;
+    C->x = A->x ; C->x_shallow = (C->x != NULL) ; C->x_size = 0 ;
+    C->plen = A->plen ;
+    C->nvec = A->nvec ;
+    C->nvec_nonempty = A->nvec_nonempty ;
+    C->nzmax = A->nzmax ;
+    C->nvals = A->nvals ;
+    C->nzombies = 0 ;
+    C->jumbled = false ;
+    C->magic = GB_MAGIC ;
+
+    // C is one more matrix using the shared content
+    GB_ATOMIC_UPDATE
+    shared->nshared++ ;
+    C->shared = shared ;
+    return (GrB_SUCCESS) ;
+}
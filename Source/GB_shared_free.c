@@ -0,0 +1,53 @@
+//------------------------------------------------------------------------------
+// GB_shared_free: release content shared by a matrix and its snapshots
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix no longer uses the content it shares with its snapshots (or with
+// the matrix it is a snapshot of).  The count of matrices using the content is
+// decremented, and the content is freed if no matrix uses it any more.  The
+// count is updated atomically, since a matrix and its snapshots may be freed
+// by different user threads at the same time.
+
+#include "GB.h"
+#include "GB_atomics.h"
+
+void GB_shared_free             // release content shared with snapshots
+(
+    GB_Shared *shared_handle    // handle of shared content to release
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (shared_handle != NULL) ;
+    GB_Shared shared = (*shared_handle) ;
+    (*shared_handle) = NULL ;
+    if (shared == NULL)
+    { 
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // release the content, and free it if no other matrix uses it
+    //--------------------------------------------------------------------------
+
+    int64_t nshared ;
+    GB_ATOMIC_CAPTURE_DEC64 (nshared, shared->nshared) ;
+    ASSERT (nshared >= 1) ;
+    if (nshared == 1)
+    { 
+        GB_FREE (&(shared->p), shared->p_size) ;
+        GB_FREE (&(shared->h), shared->h_size) ;
+        GB_FREE (&(shared->b), shared->b_size) ;
+        GB_FREE (&(shared->i), shared->i_size) ;
+        GB_FREE (&(shared->x), shared->x_size) ;
+        GB_FREE (&shared, shared->header_size) ;
+    }
+}
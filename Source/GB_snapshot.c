@@ -0,0 +1,80 @@
+//------------------------------------------------------------------------------
+// GB_snapshot: create a read-only snapshot of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// S = A, where S shares the content of A instead of copying it.  All pending
+// work on A is finished first.  The content of A is then moved into a
+// GB_Shared object (A->shared), if it is not already there, and both A and S
+// hold shallow pointers to it.  Taking a snapshot takes O(1) time if A has no
+// pending work.
+
+// Neither A nor S modify the shared content.  The first time either matrix is
+// modified (by GB_WHERE in any user-callable method with the matrix as its
+// output, or by GrB_*_removeElement, GrB_*_wait, or an export), GB_unshare
+// gives it its own copy.  Thus S is an immutable version of A, which can be
+// read by one user thread while another thread continues to modify A.  Taking
+// the snapshot itself must not be done at the same time that A is modified.
+
+// If A is already a snapshot of another matrix, or has other snapshots, S
+// shares the same content.  The shared content is freed when the last matrix
+// using it is freed or modified.
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_snapshot            // create a read-only snapshot of a matrix
+(
+    GrB_Matrix *Shandle,        // handle of snapshot to create
+    GrB_Matrix A,               // matrix to take a snapshot of
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Shandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A to snapshot", GB0) ;
+    (*Shandle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // finish any pending work on A
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // create the snapshot S, with the same content as A
+    //--------------------------------------------------------------------------
+
+    // S has a new dynamic header, and the same sparsity structure as A
+    GB_OK (GB_new (Shandle, false, // new header
+        A->type, A->vlen, A->vdim, GB_Ap_null, A->is_csc,
+        GB_sparsity (A), A->hyper_switch, 0, Context)) ;
+    GrB_Matrix S = (*Shandle) ;
+    S->bitmap_switch = A->bitmap_switch ;
+    S->sparsity = A->sparsity ;
+
+    info = GB_share (S, A, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        GB_Matrix_free (Shandle) ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (S, "S = snapshot of A", GB0) ;
+    return (GrB_SUCCESS) ;
+}
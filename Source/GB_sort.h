@@ -98,7 +98,8 @@ GrB_Info GB_msort_2b    // sort array A of size 2-by-n, using 2 keys (A [0:1][])
     int64_t *restrict A_0,   // size n array
     int64_t *restrict A_1,   // size n array
     const int64_t n,
-    int nthreads                // # of threads to use
+    int nthreads,               // # of threads to use
+    GB_Context Context
 ) ;
 
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
@@ -108,7 +109,8 @@ GrB_Info GB_msort_3b    // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     int64_t *restrict A_1,   // size n array
     int64_t *restrict A_2,   // size n array
     const int64_t n,
-    int nthreads                // # of threads to use
+    int nthreads,               // # of threads to use
+    GB_Context Context
 ) ;
 
 //------------------------------------------------------------------------------
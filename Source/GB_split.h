@@ -13,6 +13,22 @@
 #include "GB_ek_slice.h"
 #define GB_TILE(Tiles,i,j) (*(Tiles + (i) * n + (j)))
 
+// Tile_n [0:ntiles-1] = the sizes of the tiles of a dimension of size n > 0,
+// with ntiles = ceil (n / tile_size), each of size tile_size except the last
+static inline void GB_split_sizes
+(
+    GrB_Index *Tile_n,              // array of size ntiles
+    const int64_t ntiles,
+    const int64_t n,
+    const int64_t tile_size
+)
+{
+    for (int64_t t = 0 ; t < ntiles ; t++)
+    { 
+        Tile_n [t] = GB_IMIN (tile_size, n - t * tile_size) ;
+    }
+}
+
 GrB_Info GB_split                   // split a matrix
 (
     GrB_Matrix *Tiles,              // 2D row-major array of size m-by-n
@@ -9,7 +9,7 @@
 
 #define GB_FREE_WORK                        \
     GB_WERK_POP (C_ek_slicing, int64_t) ;   \
-    GB_FREE_WERK (&Wp, Wp_size) ;
+    GB_FREE_WERK (&Wp, Wp_size, Context) ;
 
 #define GB_FREE_ALL                         \
     GB_FREE_WORK ;                          \
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// GB_stats: turn the instrumentation counters of a matrix on or off
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_stats_set (A, true) allocates A->stats if needed and sets all counters to
+// zero.  GB_stats_set (A, false) frees A->stats.  See GB_stats.h.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// GB_stats_free: free the instrumentation counters
+//------------------------------------------------------------------------------
+
+void GB_stats_free              // free A->stats
+(
+    GB_Stats *stats_handle
+)
+{
+    if (stats_handle != NULL && (*stats_handle) != NULL)
+    { 
+        size_t header_size = (*stats_handle)->header_size ;
+        GB_FREE (stats_handle, header_size) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_stats_set: turn the instrumentation of A on or off
+//------------------------------------------------------------------------------
+
+GrB_Info GB_stats_set           // turn the instrumentation of A on or off
+(
+    GrB_Matrix A,
+    bool on                     // if true, allocate and clear A->stats
+)
+{
+
+    ASSERT (A != NULL) ;
+    if (!on)
+    { 
+        // turn off the instrumentation
+        GB_stats_free (&(A->stats)) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    if (A->stats == NULL)
+    {
+        // allocate the counters
+        size_t header_size ;
+        A->stats = GB_MALLOC (1, struct GB_Stats_struct, &header_size) ;
+        if (A->stats == NULL)
+        { 
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        A->stats->header_size = header_size ;
+    }
+
+    // clear the counters
+    memset (A->stats->s, 0, GxB_NSTATS * sizeof (double)) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+// GB_stats.h: instrumentation counters for a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The counters in A->stats are updated only if A->stats is non-NULL, which is
+// the case only if enabled by GxB_set (A, GxB_STATS, true).  They are
+// updated in these places:
+//
+//  GxB_STATS_WAIT, _WAIT_TIME, _PENDING, _ZOMBIES: GB_Matrix_wait
+//  GxB_STATS_TO_HYPERSPARSE, _TO_SPARSE, _TO_BITMAP, _TO_FULL,
+//      _CONFORM_TIME: GB_conform.  These are also the counts returned by
+//      GxB_get (A, GxB_CONFORM_COUNT) and GxB_CONFORM_TIME.
+//  GxB_STATS_TRANSPOSE: GB_AxB_meta and GB_ewise, for each input matrix
+//      (or mask) they transpose, in the counters of the output C.  The
+//      inputs may be shared by other user threads, so their counters are
+//      never written.
+//  GxB_STATS_WORKSPACE: GB_conform and GB_Matrix_wait, with the peak
+//      workspace allocated by the current operation, so far.  Nearly all
+//      operations that modify a matrix finish by conforming it.
+
+#ifndef GB_STATS_H
+#define GB_STATS_H
+
+GrB_Info GB_stats_set           // turn the instrumentation of A on or off
+(
+    GrB_Matrix A,
+    bool on                     // if true, allocate and clear A->stats
+) ;
+
+void GB_stats_free              // free A->stats
+(
+    GB_Stats *stats_handle
+) ;
+
+// GB_stats_werk: record the peak workspace of the current operation
+static inline void GB_stats_werk (GrB_Matrix A, GB_Context Context)
+{
+    if (A->stats != NULL && Context != NULL)
+    { 
+        double *s = A->stats->s ;
+        s [GxB_STATS_WORKSPACE] = GB_IMAX (s [GxB_STATS_WORKSPACE],
+            (double) Context->werk_peak) ;
+    }
+}
+
+// GB_stats_conform: count a conversion of A to a new sparsity structure,
+// started at time t
+static inline void GB_stats_conform (GrB_Matrix A, int sparsity, double t)
+{
+    if (A->stats != NULL)
+    {
+        double *s = A->stats->s ;
+        s [GxB_STATS_CONFORM_TIME] += (GB_OPENMP_GET_WTIME - t) ;
+        switch (sparsity)
+        {
+            case GxB_HYPERSPARSE : s [GxB_STATS_TO_HYPERSPARSE]++ ; break ;
+            case GxB_SPARSE      : s [GxB_STATS_TO_SPARSE]++      ; break ;
+            case GxB_BITMAP      : s [GxB_STATS_TO_BITMAP]++      ; break ;
+            case GxB_FULL        : s [GxB_STATS_TO_FULL]++        ; break ;
+            default : ;
+        }
+    }
+}
+
+// GB_stats_nconform: # of conversions of A to a new sparsity structure
+static inline int64_t GB_stats_nconform (GrB_Matrix A)
+{
+    if (A->stats == NULL) return (0) ;
+    double *s = A->stats->s ;
+    return ((int64_t) (s [GxB_STATS_TO_HYPERSPARSE] + s [GxB_STATS_TO_SPARSE]
+        + s [GxB_STATS_TO_BITMAP] + s [GxB_STATS_TO_FULL])) ;
+}
+
+// GB_stats_conform_time: time spent in those conversions
+static inline double GB_stats_conform_time (GrB_Matrix A)
+{
+    return ((A->stats == NULL) ? 0 : A->stats->s [GxB_STATS_CONFORM_TIME]) ;
+}
+
+// GB_stats_transpose: count an input transposed to compute C
+static inline void GB_stats_transpose (GrB_Matrix C)
+{
+    if (C != NULL && C->stats != NULL)
+    { 
+        C->stats->s [GxB_STATS_TRANSPOSE]++ ;
+    }
+}
+
+#endif
+
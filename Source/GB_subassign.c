@@ -23,13 +23,13 @@
 #include "GB_subassign.h"
 #include "GB_bitmap_assign.h"
 
-#define GB_FREE_ALL                 \
-{                                   \
-    GB_Matrix_free (&C2) ;          \
-    GB_Matrix_free (&M2) ;          \
-    GB_Matrix_free (&A2) ;          \
-    GB_FREE_WERK (&I2, I2_size) ;   \
-    GB_FREE_WERK (&J2, J2_size) ;   \
+#define GB_FREE_ALL                          \
+{                                            \
+    GB_Matrix_free (&C2) ;                   \
+    GB_Matrix_free (&M2) ;                   \
+    GB_Matrix_free (&A2) ;                   \
+    GB_FREE_WERK (&I2, I2_size, Context) ;   \
+    GB_FREE_WERK (&J2, J2_size, Context) ;   \
 }
 
 GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
@@ -46,9 +46,9 @@
 #include "GB_subassign_methods.h"
 
 #undef  GB_FREE_ALL
-#define GB_FREE_ALL                             \
-{                                               \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
+#define GB_FREE_ALL                                      \
+{                                                        \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
 }
 
 //------------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 #ifndef GB_SUBASSIGN_METHODS_H
 #define GB_SUBASSIGN_METHODS_H
 #include "GB_add.h"
+#include "GB_binop.h"
 #include "GB_ij.h"
 #include "GB_Pending.h"
 #include "GB_unused.h"
@@ -26,17 +27,17 @@
 #endif
 
 #undef  GB_FREE_ALL
-#define GB_FREE_ALL                             \
-{                                               \
-    GB_FREE_WORK ;                              \
-    GB_WERK_POP (Npending, int64_t) ;           \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
-    GB_FREE (&Zh, Zh_size) ;                    \
-    GB_FREE_WERK (&Z_to_X, Z_to_X_size) ;       \
-    GB_FREE_WERK (&Z_to_S, Z_to_S_size) ;       \
-    GB_FREE_WERK (&Z_to_A, Z_to_A_size) ;       \
-    GB_FREE_WERK (&Z_to_M, Z_to_M_size) ;       \
-    GB_phbix_free (S);                        \
+#define GB_FREE_ALL                                      \
+{                                                        \
+    GB_FREE_WORK ;                                       \
+    GB_WERK_POP (Npending, int64_t) ;                    \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
+    GB_FREE (&Zh, Zh_size) ;                             \
+    GB_FREE_WERK (&Z_to_X, Z_to_X_size, Context) ;       \
+    GB_FREE_WERK (&Z_to_S, Z_to_S_size, Context) ;       \
+    GB_FREE_WERK (&Z_to_A, Z_to_A_size, Context) ;       \
+    GB_FREE_WERK (&Z_to_M, Z_to_M_size, Context) ;       \
+    GB_phbix_free (S);                                   \
 }
 
 //------------------------------------------------------------------------------
@@ -101,6 +102,7 @@
     ASSERT_BINARYOP_OK (accum, "accum for assign", GB0) ;                   \
     ASSERT (!GB_OP_IS_POSITIONAL (accum)) ;                                 \
     const GxB_binary_function faccum = accum->function ;                    \
+    GB_BINOP_VECTOR (faccum, accum) ;                                       \
     const GB_cast_function                                                  \
         cast_A_to_Y = GB_cast_factory (accum->ytype->code, acode),          \
         cast_C_to_X = GB_cast_factory (accum->xtype->code, ccode),          \
@@ -292,7 +294,7 @@
         GB_void xwork [GB_VLA(xsize)] ;                                     \
         cast_C_to_X (xwork, Cx +(pC*csize), csize) ;                        \
         GB_void zwork [GB_VLA(zsize)] ;                                     \
-        faccum (zwork, xwork, ywork) ;                                      \
+        GB_BINOP_CALL (faccum, zwork, xwork, ywork) ;                       \
         cast_Z_to_C (Cx +(pC*csize), zwork, csize) ;                        \
     }                                                                       \
 
@@ -34,10 +34,10 @@
 }
 
 #undef  GB_FREE_ALL
-#define GB_FREE_ALL                             \
-{                                               \
-    GB_FREE_WORK ;                              \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
+#define GB_FREE_ALL                                      \
+{                                                        \
+    GB_FREE_WORK ;                                       \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
 }
 
 //------------------------------------------------------------------------------
@@ -70,13 +70,13 @@
 //      detected in A.  Since pa = Cx [pc] holds the position of the entry in
 //      A, the entry is a zombie if Ai [pa] has been flipped.
 
-#define GB_FREE_WORK                            \
-{                                               \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
-    GB_FREE_WERK (&Ap_start, Ap_start_size) ;   \
-    GB_FREE_WERK (&Ap_end, Ap_end_size) ;       \
-    GB_FREE_WERK (&Mark, Mark_size) ;           \
-    GB_FREE_WERK (&Inext, Inext_size) ;         \
+#define GB_FREE_WORK                                     \
+{                                                        \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
+    GB_FREE_WERK (&Ap_start, Ap_start_size, Context) ;   \
+    GB_FREE_WERK (&Ap_end, Ap_end_size, Context) ;       \
+    GB_FREE_WERK (&Mark, Mark_size, Context) ;           \
+    GB_FREE_WERK (&Inext, Inext_size, Context) ;         \
 }
 
 #define GB_FREE_ALL             \
@@ -487,8 +487,8 @@ GrB_Info GB_subref_phase0
             // out of memory
             GB_FREE_WORK ;
             GB_FREE (&Ch, Ch_size) ;
-            GB_FREE_WERK (&Ap_start, Ap_start_size) ;
-            GB_FREE_WERK (&Ap_end, Ap_end_size) ;
+            GB_FREE_WERK (&Ap_start, Ap_start_size, Context) ;
+            GB_FREE_WERK (&Ap_end, Ap_end_size, Context) ;
             return (GrB_OUT_OF_MEMORY) ;
         }
     }
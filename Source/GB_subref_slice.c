@@ -29,18 +29,18 @@
 // Compare this function with GB_ewise_slice, which constructs coarse/fine
 // tasks for the eWise operations (C=A+B, C=A.*B, and C<M>=Z).
 
-#define GB_FREE_WORK                            \
-{                                               \
-    GB_WERK_POP (Coarse, int64_t) ;             \
-    GB_FREE_WERK (&Cwork, Cwork_size) ;         \
+#define GB_FREE_WORK                                     \
+{                                                        \
+    GB_WERK_POP (Coarse, int64_t) ;                      \
+    GB_FREE_WERK (&Cwork, Cwork_size, Context) ;         \
 }
 
-#define GB_FREE_ALL                             \
-{                                               \
-    GB_FREE_WORK ;                              \
-    GB_FREE_WERK (&TaskList, TaskList_size) ;   \
-    GB_FREE_WERK (&Mark, Mark_size) ;           \
-    GB_FREE_WERK (&Inext, Inext_size) ;         \
+#define GB_FREE_ALL                                      \
+{                                                        \
+    GB_FREE_WORK ;                                       \
+    GB_FREE_WERK (&TaskList, TaskList_size, Context) ;   \
+    GB_FREE_WERK (&Mark, Mark_size, Context) ;           \
+    GB_FREE_WERK (&Inext, Inext_size, Context) ;         \
 }
 
 #include "GB_subref.h"
@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+// GB_thread_budget: share a library-wide budget of threads among user threads
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GxB_set (GxB_THREAD_BUDGET, budget) is set to a positive value, all user
+// threads calling GraphBLAS at the same time share that many threads.  Each
+// user thread holds a lease of threads, kept in thread-local storage, and the
+// sum of all leases is kept in GB_Global.
+
+// A lease is taken out lazily, by GB_GET_NTHREADS_MAX, and only inside an
+// operation bracketed by GB_thread_budget_begin and GB_thread_budget_end.
+// Each user-callable method that does parallel work (GrB_mxm, GrB_eWiseAdd,
+// GrB_assign, GrB_Matrix_build, GrB_wait, and so on) brackets the call to its
+// internal method once its inputs are checked.  A method with several steps
+// instead ends the bracket in GB_FREE_ALL, so no error return can skip it.
+
+// The lease is taken by the first GB_GET_NTHREADS_MAX of the operation: the
+// threads not leased by other user threads, but never less than one, and
+// never more than the nthreads_max requested.  The rules of GB_nthreads then
+// select the # of threads for each parallel region, from the reduced
+// nthreads_max.  A method thus uses fewer threads when other user threads
+// are busy in GraphBLAS, and the next one leases more once they finish.
+
+// The lease is not resized until the operation ends.  Later steps of the
+// operation use at most the threads it holds, and so do the tasks of
+// GB_AxB_tiled and GB_transpose_tiled, which each ask for fewer threads than
+// the operation as a whole is using.  The task run by the calling thread
+// must not shrink the lease while the other tasks are still running.
+
+// Brackets can be nested, as when GrB_mxm computes C=A*B in tiles with
+// GxB_Matrix_split.  The depth of the brackets is kept for each user thread,
+// and the lease is returned when the outermost bracket ends.
+
+// The leases are updated with atomics, but not in a critical section, so two
+// user threads starting at the same time may briefly lease a few more threads
+// than the budget.  This is harmless; the budget is a target, not a limit.
+
+#include "GB.h"
+#include "GB_atomics.h"
+
+// threads leased by the calling user thread
+static GB_THREAD_LOCAL int GB_thread_lease = 0 ;
+
+// depth of the operations of the calling user thread that can take a lease
+static GB_THREAD_LOCAL int GB_thread_depth = 0 ;
+
+//------------------------------------------------------------------------------
+// GB_thread_budget_begin: start an operation that can take a lease
+//------------------------------------------------------------------------------
+
+void GB_thread_budget_begin (void)
+{
+    GB_thread_depth++ ;
+}
+
+//------------------------------------------------------------------------------
+// GB_thread_budget_end: end an operation, and return the lease if outermost
+//------------------------------------------------------------------------------
+
+void GB_thread_budget_end (void)
+{
+    if (GB_thread_depth > 1)
+    { 
+        // an enclosing operation still holds the lease
+        GB_thread_depth-- ;
+        return ;
+    }
+    GB_thread_depth = 0 ;
+    int lease = GB_thread_lease ;
+    if (lease > 0)
+    {
+        GB_thread_lease = 0 ;
+        GB_Global_threads_leased_add (-lease) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_thread_budget_acquire: take out a lease for the calling thread
+//------------------------------------------------------------------------------
+
+int GB_thread_budget_acquire    // return the # of threads to use
+(
+    int nthreads_max            // max # of threads requested
+)
+{
+
+    int budget = GB_Global_thread_budget_get ( ) ;
+    if (budget <= 0 || GB_thread_depth <= 0)
+    { 
+        // no budget, or not inside an operation that takes a lease
+        return (nthreads_max) ;
+    }
+
+    int lease = GB_thread_lease ;
+    if (lease > 0)
+    { 
+        // the lease is already held by this operation
+        return (GB_IMIN (lease, nthreads_max)) ;
+    }
+
+    // lease what is left of the budget, from 1 to nthreads_max threads
+    int64_t others = GB_Global_threads_leased_get ( ) ;
+    int64_t nthreads = budget - others ;
+    nthreads = GB_IMIN (nthreads, nthreads_max) ;
+    nthreads = GB_IMAX (nthreads, 1) ;
+    GB_Global_threads_leased_add (nthreads) ;
+    GB_thread_lease = (int) nthreads ;
+    return ((int) nthreads) ;
+}
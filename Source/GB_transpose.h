@@ -36,6 +36,16 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
     GB_Context Context
 ) ;
 
+GrB_Info GB_transpose_tiled     // C=A', one tile at a time
+(
+    GrB_Matrix C,               // output matrix, static header
+    const GrB_Type ctype,       // type of C
+    const bool C_is_csc,        // desired CSR/CSC format of C
+    const GrB_Matrix A,         // input matrix
+    const int64_t tile_size,    // max dimension of each tile
+    GB_Context Context
+) ;
+
 GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
 (
     GrB_Matrix C,               // output matrix (static header)
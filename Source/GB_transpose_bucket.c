@@ -41,7 +41,8 @@
     {                                                                   \
         for (int tid = 0 ; tid < nworkspaces ; tid++)                   \
         {                                                               \
-            GB_FREE_WERK (&(Workspaces [tid]), Workspaces_size [tid]) ; \
+            GB_FREE_WERK (&(Workspaces [tid]), Workspaces_size [tid],   \
+                Context) ;                                              \
         }                                                               \
     }                                                                   \
     GB_WERK_POP (A_slice, int64_t) ;                                    \
@@ -290,6 +290,7 @@ void GB_transpose_op    // transpose, typecast, and apply operator to a matrix
         GB_BURBLE_MATRIX (A, "(generic transpose: %s) ", op2->name) ;
         GB_Type_code acode = Atype->code ;
         GxB_binary_function fop = op2->function ;
+        GB_BINOP_VECTOR (fop, op2) ;    // for an op on vector-valued entries
 
         if (binop_bind1st)
         { 
@@ -303,7 +304,7 @@ void GB_transpose_op    // transpose, typecast, and apply operator to a matrix
                 GB_void ywork [GB_VLA(ysize)] ;                             \
                 cast_A_to_Y (ywork, Ax +((pA)*asize), asize) ;              \
                 /* Cx [pC] = fop (xwork) ; Cx is of type op->ztype */       \
-                fop (Cx +((pC)*zsize), scalarx, ywork) ;                    \
+                GB_BINOP_CALL (fop, Cx +((pC)*zsize), scalarx, ywork) ;     \
             }
             #include "GB_unop_transpose.c"
         }
@@ -319,7 +320,7 @@ void GB_transpose_op    // transpose, typecast, and apply operator to a matrix
                 GB_void xwork [GB_VLA(xsize)] ;                             \
                 cast_A_to_X (xwork, Ax +((pA)*asize), asize) ;              \
                 /* Cx [pC] = fop (xwork) ; Cx is of type op->ztype */       \
-                fop (Cx +(pC*zsize), xwork, scalarx) ;                      \
+                GB_BINOP_CALL (fop, Cx +(pC*zsize), xwork, scalarx) ;       \
             }
             #include "GB_unop_transpose.c"
         }
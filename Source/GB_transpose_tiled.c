@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+// GB_transpose_tiled: C=A', one tile at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GxB_TILE_SIZE is set, GrB_transpose computes C=A' by splitting A into
+// tiles of at most tile_size-by-tile_size with GB_split, transposing each tile
+// A{i,j} on its own into C{j,i} with GB_transpose, and concatenating the tiles
+// of C with GB_concat.  The bucket transpose of each tile then scatters its
+// entries into only tile_size vectors of C, in place of all of them.
+
+// The tiles are transposed in parallel, each with one thread, if there are at
+// least as many of them as threads.  Otherwise, they are transposed one at a
+// time, each with all threads.
+
+#include "GB_transpose.h"
+#include "GB_split.h"
+#include "GB_concat.h"
+
+#define GB_FREE_WORK                                    \
+{                                                       \
+    if (Atiles != NULL)                                 \
+    {                                                   \
+        for (int64_t t = 0 ; t < ma * na ; t++)         \
+        {                                               \
+            GB_Matrix_free (&(Atiles [t])) ;            \
+        }                                               \
+    }                                                   \
+    if (Ctiles != NULL)                                 \
+    {                                                   \
+        for (int64_t t = 0 ; t < ma * na ; t++)         \
+        {                                               \
+            GB_Matrix_free (&(Ctiles [t])) ;            \
+        }                                               \
+    }                                                   \
+    GB_FREE_WERK (&Atiles, Atiles_size, Context) ;      \
+    GB_FREE_WERK (&Ctiles, Ctiles_size, Context) ;      \
+    GB_FREE_WERK (&Tile_n, Tile_n_size, Context) ;      \
+}
+
+#define GB_FREE_ALL                                     \
+{                                                       \
+    GB_FREE_WORK ;                                      \
+    GB_phbix_free (C) ;                                 \
+}
+
+GrB_Info GB_transpose_tiled     // C=A', one tile at a time
+(
+    GrB_Matrix C,               // output matrix, static header
+    const GrB_Type ctype,       // type of C
+    const bool C_is_csc,        // desired CSR/CSC format of C
+    const GrB_Matrix A,         // input matrix
+    const int64_t tile_size,    // max dimension of each tile
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && C->static_header) ;
+    ASSERT_MATRIX_OK (A, "A for GB_transpose_tiled", GB0) ;
+    ASSERT (tile_size > 0) ;
+
+    // A is split into ma-by-na tiles, and C=A' is na-by-ma tiles
+    const int64_t anrows = GB_NROWS (A), ancols = GB_NCOLS (A) ;
+    ASSERT (anrows > 0 && ancols > 0) ;
+    const int64_t ma = GB_ICEIL (anrows, tile_size) ;
+    const int64_t na = GB_ICEIL (ancols, tile_size) ;
+    GrB_Matrix *Atiles = NULL, *Ctiles = NULL ;
+    GrB_Index *Tile_n = NULL ;
+    size_t Atiles_size = 0, Ctiles_size = 0, Tile_n_size = 0 ;
+
+    GBURBLE ("(tiled " GBd "-by-" GBd ") ", ma, na) ;
+
+    //--------------------------------------------------------------------------
+    // split A into tiles
+    //--------------------------------------------------------------------------
+
+    Atiles = GB_CALLOC_WERK (ma * na, GrB_Matrix, &Atiles_size) ;
+    Ctiles = GB_CALLOC_WERK (ma * na, GrB_Matrix, &Ctiles_size) ;
+    Tile_n = GB_MALLOC_WERK (ma + na, GrB_Index, &Tile_n_size) ;
+    if (Atiles == NULL || Ctiles == NULL || Tile_n == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GrB_Index *Tile_rows = Tile_n ;
+    GrB_Index *Tile_cols = Tile_n + ma ;
+    GB_split_sizes (Tile_rows, ma, anrows, tile_size) ;
+    GB_split_sizes (Tile_cols, na, ancols, tile_size) ;
+    GB_OK (GB_split (Atiles, ma, na, Tile_rows, Tile_cols, A, Context)) ;
+
+    //--------------------------------------------------------------------------
+    // C{j,i} = A{i,j}' for each tile of A
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    const int64_t ntiles = ma * na ;
+    int nthreads = (ntiles >= nthreads_max) ? nthreads_max : 1 ;
+    int nthreads_per_tile = (nthreads > 1) ? 1 : nthreads_max ;
+
+    info = GrB_SUCCESS ;
+    int64_t tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntiles ; tid++)
+    {
+        const int64_t i = tid / na ;
+        const int64_t j = tid % na ;
+        GB_CONTEXT_TASK (Task_Context, Context, nthreads_per_tile) ;
+        GrB_Matrix Ctile = NULL ;
+        // transpose: typecast, no op, not in-place
+        GrB_Info tinfo = GB_transpose (&Ctile, ctype, C_is_csc, Atiles [tid],
+            NULL, NULL, NULL, false, Task_Context) ;
+        Ctiles [j * ma + i] = Ctile ;
+        if (tinfo != GrB_SUCCESS)
+        {
+            // out of memory, or other failure; the first one is reported
+            #pragma omp critical (GB_transpose_tiled)
+            {
+                if (info == GrB_SUCCESS) info = tinfo ;
+            }
+        }
+    }
+
+    if (info != GrB_SUCCESS)
+    {
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // concatenate the tiles of C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&C, true, // auto sparsity, static header
+        ctype, C_is_csc ? ancols : anrows, C_is_csc ? anrows : ancols,
+        GB_Ap_calloc, C_is_csc, GxB_AUTO_SPARSITY,
+        GB_Global_hyper_switch_get ( ), 1, Context)) ;
+    GB_OK (GB_concat (C, Ctiles, na, ma, Context)) ;
+    GB_FREE_WORK ;
+    ASSERT_MATRIX_OK (C, "C=A' from GB_transpose_tiled", GB0) ;
+    return (GrB_SUCCESS) ;
+}
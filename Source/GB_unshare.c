@@ -0,0 +1,118 @@
+//------------------------------------------------------------------------------
+// GB_unshare: give a matrix its own copy of content shared with snapshots
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If A shares its content with one or more snapshots (or A is itself a
+// snapshot), A is given its own copy of the content, so that it can be
+// modified without changing any snapshot.  If no other matrix still uses the
+// content, A takes it back and nothing is copied.  This is the copy in
+// copy-on-write: it is done by GB_WHERE, for the output of any user-callable
+// method, and by any other method that modifies a matrix in place.
+
+// Only the components of A that still point to the shared content are
+// copied; any component that has since been replaced is already owned by A.
+// If A has a deferred operator (see GB_apply.c), it is applied first.
+
+#include "GB.h"
+#include "GB_atomics.h"
+
+#define GB_FREE_ALL ;
+
+// copy (or take back) the shared component A->X of size A->shared->X_size
+#define GB_UNSHARE_COMPONENT(X,type,len)                                    \
+{                                                                           \
+    if (A->X ## _shallow && A->X == shared->X)                              \
+    {                                                                       \
+        if (nshared == 1)                                                   \
+        {                                                                   \
+            /* A is the only matrix using the content: take it back */      \
+            A->X ## _size = shared->X ## _size ;                            \
+            shared->X = NULL ;                                              \
+            shared->X ## _size = 0 ;                                        \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            /* give A its own copy of the content */                        \
+            size_t Xnew_size = 0 ;                                          \
+            GB_void *Xnew = GB_MALLOC (shared->X ## _size, GB_void,         \
+                &Xnew_size) ;                                               \
+            if (Xnew == NULL)                                               \
+            {                                                               \
+                /* out of memory; A still uses the shared content */        \
+                return (GrB_OUT_OF_MEMORY) ;                                \
+            }                                                               \
+            GB_memcpy (Xnew, A->X, len, nthreads_max) ;                     \
+            A->X = (type *) Xnew ;                                          \
+            A->X ## _size = Xnew_size ;                                     \
+        }                                                                   \
+        A->X ## _shallow = false ;                                          \
+    }                                                                       \
+}
+
+GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
+GrB_Info GB_unshare             // give A its own copy of any shared content
+(
+    GrB_Matrix A,               // matrix that may share content with snapshots
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (A == NULL || A->shared == NULL)
+    { 
+        // A does not share any content
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A to unshare", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // apply any deferred operator, which gives A its own A->x
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_OK (GB_deferred_finish (A, Context)) ;
+    GB_Shared shared = A->shared ;
+
+    //--------------------------------------------------------------------------
+    // determine the max # of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+
+    //--------------------------------------------------------------------------
+    // copy or take back each component that A still shares
+    //--------------------------------------------------------------------------
+
+    // If nshared is 1, no other matrix can obtain a reference to the shared
+    // content, since only A has access to it.
+
+    int64_t nshared ;
+    GB_ATOMIC_READ
+    nshared = shared->nshared ;
+
+    int64_t anz = GB_NNZ_HELD (A) ;
+    size_t asize = A->type->size ;
+    GB_UNSHARE_COMPONENT (p, int64_t, (A->nvec+1) * sizeof (int64_t)) ;
+    GB_UNSHARE_COMPONENT (h, int64_t, A->nvec * sizeof (int64_t)) ;
+    GB_UNSHARE_COMPONENT (b, int8_t,  anz * sizeof (int8_t)) ;
+    GB_UNSHARE_COMPONENT (i, int64_t, anz * sizeof (int64_t)) ;
+    GB_UNSHARE_COMPONENT (x, GB_void, anz * asize) ;
+
+    //--------------------------------------------------------------------------
+    // release the shared content
+    //--------------------------------------------------------------------------
+
+    ASSERT (!GB_is_shallow (A)) ;
+    GB_shared_free (&(A->shared)) ;
+    ASSERT_MATRIX_OK (A, "A unshared", GB0) ;
+    return (GrB_SUCCESS) ;
+}
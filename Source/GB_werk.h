@@ -87,7 +87,8 @@ static inline void *GB_werk_push    // return pointer to newly allocated space
     else
     { 
         // allocate the werkspace from malloc
-        return (GB_malloc_memory (nitems, size_of_item, size_allocated)) ;
+        return (GB_malloc_counted (GB_MEMORY_WORKSPACE, nitems, size_of_item,
+            size_allocated)) ;
     }
 }
 
@@ -154,7 +155,7 @@ static inline void *GB_werk_pop     // free the top block of werkspace memory
     else
     { 
         // werkspace was allocated from malloc
-        GB_dealloc_memory (&p, *size_allocated) ;
+        GB_free_counted (GB_MEMORY_WORKSPACE, &p, *size_allocated) ;
     }
     return (NULL) ;                 // return NULL to indicate p was freed
 }
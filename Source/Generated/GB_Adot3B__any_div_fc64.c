@@ -22,7 +22,7 @@ GrB_Info GB (_Adot3B__any_div_fc64)
     const GrB_Matrix M, const bool Mask_struct,
     const GrB_Matrix A, bool A_is_pattern,
     const GrB_Matrix B, bool B_is_pattern,
-    const GB_task_struct *restrict TaskList,
+    GB_task_struct *restrict TaskList,
     const int ntasks,
     const int nthreads
 )
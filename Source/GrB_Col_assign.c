@@ -49,6 +49,7 @@ GrB_Info GrB_Col_assign             // C<M>(Rows,col) = accum (C(Rows,col),u)
     GrB_Index Cols [1] ;
     Cols [0] = col ;
 
+    GB_thread_budget_begin ( ) ;
     info = GB_assign (
         C,                  C_replace,      // C matrix and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
@@ -60,6 +61,7 @@ GrB_Info GrB_Col_assign             // C<M>(Rows,col) = accum (C(Rows,col),u)
         false, NULL, GB_ignore_code,        // no scalar expansion
         GB_COL_ASSIGN,
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -63,6 +63,7 @@ GrB_Info GrB_Col_extract        // w<M> = accum (w, A(I,j)) or (A(j,I))'
     // do the work in GB_extract
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_extract (
         (GrB_Matrix) w,    C_replace,   // w as a matrix, and descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct,  // mask and its descriptor
@@ -71,6 +72,7 @@ GrB_Info GrB_Col_extract        // w<M> = accum (w, A(I,j)) or (A(j,I))'
         I, ni,                          // row indices I and length ni
         J, 1,                           // one column index, nj = 1
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
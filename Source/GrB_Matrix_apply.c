@@ -46,6 +46,7 @@ GrB_Info GrB_Matrix_apply           // C<M> = accum (C, op(A)) or op(A')
     // apply the operator and optionally transpose
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_apply (
         C, C_replace,               // C and its descriptor
         M, Mask_comp, Mask_struct,  // mask and its descriptor
@@ -54,6 +55,7 @@ GrB_Info GrB_Matrix_apply           // C<M> = accum (C, op(A)) or op(A')
         NULL, NULL, false,          // no binary operator
         A, A_transpose,             // A and its descriptor
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -95,6 +97,7 @@ static inline GrB_Info GB_1st       // C<M>=accum(C,op(x,A))
     // apply the operator and optionally transpose
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_apply (
         C, C_replace,               // C and its descriptor
         M, Mask_comp, Mask_struct,  // mask and its descriptor
@@ -103,6 +106,7 @@ static inline GrB_Info GB_1st       // C<M>=accum(C,op(x,A))
         op, x, true,                // operator op(x,.) to apply to the entries
         A, A_transpose,             // A and its descriptor
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -146,6 +150,7 @@ static inline GrB_Info GB_2nd       // C<M>=accum(C,op(A,y))
     // apply the operator and optionally transpose
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_apply (
         C, C_replace,               // C and its descriptor
         M, Mask_comp, Mask_struct,  // mask and its descriptor
@@ -154,6 +159,7 @@ static inline GrB_Info GB_2nd       // C<M>=accum(C,op(A,y))
         op, y, false,               // operator op(.,y) to apply to the entries
         A, A_transpose,             // A and its descriptor
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -44,6 +44,7 @@ GrB_Info GrB_Matrix_assign          // C<M>(Rows,Cols) += A or A'
     // C<M>(Rows,Cols) = accum (C(Rows,Cols), A) and variations
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_assign (
         C,          C_replace,      // C matrix and its descriptor
         M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
@@ -55,6 +56,7 @@ GrB_Info GrB_Matrix_assign          // C<M>(Rows,Cols) += A or A'
         false, NULL, GB_ignore_code,// no scalar expansion
         GB_ASSIGN,
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
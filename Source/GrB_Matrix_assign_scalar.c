@@ -40,8 +40,11 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_assign_, T) /* C<M>(Rows,Cols) += x */      \
     GB_BURBLE_START ("GrB_assign") ;                                           \
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                          \
     GB_RETURN_IF_FAULTY (M) ;                                                  \
-    GrB_Info info = GB_assign_scalar (C, M, accum, ampersand x,                \
+    GrB_Info info ;                                                            \
+    GB_thread_budget_begin ( ) ;                                               \
+    info = GB_assign_scalar (C, M, accum, ampersand x,                         \
         GB_## T ## _code, Rows, nRows, Cols, nCols, desc, Context) ;           \
+    GB_thread_budget_end ( ) ;                                                 \
     GB_BURBLE_END ;                                                            \
     return (info) ;                                                            \
 }
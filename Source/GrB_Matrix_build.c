@@ -23,8 +23,11 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_build_, T) /* build a matrix from tuples */\
     GB_WHERE (C, "GrB_Matrix_build_" GB_STR(T) " (C, I, J, X, nvals, dup)") ; \
     GB_BURBLE_START ("GrB_Matrix_build") ;                                    \
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                         \
-    GrB_Info info = GB_matvec_build (C, I, J, X, nvals, dup,                  \
+    GrB_Info info ;                                                           \
+    GB_thread_budget_begin ( ) ;                                              \
+    info = GB_matvec_build (C, I, J, X, nvals, dup,                           \
         GB_ ## T ## _code, true, Context) ;                                   \
+    GB_thread_budget_end ( ) ;                                                \
     GB_BURBLE_END ;                                                           \
     return (info) ;                                                           \
 }
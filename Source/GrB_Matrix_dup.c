@@ -31,7 +31,10 @@ GrB_Info GrB_Matrix_dup     // make an exact copy of a matrix
     // duplicate the matrix
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_dup (C, A, Context) ;
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_dup (C, A, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
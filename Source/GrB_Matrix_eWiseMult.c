@@ -21,6 +21,7 @@
     GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,       \
         A_tran, B_tran, xx, xx7) ;                                          \
     /* C<M> = accum (C,T) where T = A.*B, A'.*B, A.*B', or A'.*B' */        \
+    GB_thread_budget_begin ( ) ;                                            \
     info = GB_ewise (                                                       \
         C,              C_replace,  /* C and its descriptor        */       \
         M, Mask_comp, Mask_struct,  /* mask and its descriptor     */       \
@@ -29,7 +30,8 @@
         A,              A_tran,     /* A matrix and its descriptor */       \
         B,              B_tran,     /* B matrix and its descriptor */       \
         false,                      /* eWiseMult                   */       \
-        Context) ;
+        Context) ;                                                          \
+    GB_thread_budget_end ( ) ;
 
 //------------------------------------------------------------------------------
 // GrB_Matrix_eWiseMult_BinaryOp: matrix element-wise multiplication
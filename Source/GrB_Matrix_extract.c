@@ -41,6 +41,7 @@ GrB_Info GrB_Matrix_extract     // C<M> = accum (C, A(I,J))
     // do the work in GB_extract
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_extract (
         C,      C_replace,          // output matrix C and its descriptor
         M, Mask_comp, Mask_struct,  // mask and its descriptor
@@ -49,6 +50,7 @@ GrB_Info GrB_Matrix_extract     // C<M> = accum (C, A(I,J))
         I, ni,                      // row indices
         J, nj,                      // column indices
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -14,6 +14,7 @@
 // Returns GrB_NO_VALUE if A(row,col) is not present, and x is unmodified.
 
 #include "GB.h"
+#include "GB_Pending.h"
 
 #define GB_FREE_ALL ;
 #define GB_WHERE_STRING "GrB_Matrix_extractElement (&x, A, row, col)"
@@ -33,8 +33,11 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_extractTuples_, T) /* [I,J,X] = find (A) */\
     GB_BURBLE_START ("GrB_Matrix_extractTuples") ;                            \
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;                                         \
     GB_RETURN_IF_NULL (p_nvals) ;                                             \
-    GrB_Info info = GB_extractTuples (I, J, X, p_nvals, GB_ ## T ## _code, A, \
+    GrB_Info info ;                                                           \
+    GB_thread_budget_begin ( ) ;                                              \
+    info = GB_extractTuples (I, J, X, p_nvals, GB_ ## T ## _code, A,          \
         Context) ;                                                            \
+    GB_thread_budget_end ( ) ;                                                \
     GB_BURBLE_END ;                                                           \
     return (info) ;                                                           \
 }
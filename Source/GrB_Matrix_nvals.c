@@ -28,7 +28,10 @@ GrB_Info GrB_Matrix_nvals   // get the number of entries in a matrix
     // get the number of entries
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_nvals (nvals, A, Context) ;
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_nvals (nvals, A, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -34,8 +34,11 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_reduce_, T) /* c = accum (c, reduce (A)) */ \
     GB_WHERE1 ("GrB_Matrix_reduce_" GB_STR(T) " (&c, accum, monoid, A, desc)");\
     GB_BURBLE_START ("GrB_reduce") ;                                           \
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;                                          \
-    GrB_Info info = GB_reduce_to_scalar (c, GB_EVAL3 (prefix, _, T), accum,    \
+    GrB_Info info ;                                                            \
+    GB_thread_budget_begin ( ) ;                                               \
+    info = GB_reduce_to_scalar (c, GB_EVAL3 (prefix, _, T), accum,             \
         monoid, A, Context) ;                                                  \
+    GB_thread_budget_end ( ) ;                                                 \
     GB_BURBLE_END ;                                                            \
     return (info) ;                                                            \
 }
@@ -74,8 +77,11 @@ GrB_Info GrB_Matrix_reduce_UDT      // c = accum (c, reduce_to_scalar (A))
     GB_BURBLE_START ("GrB_reduce") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     GB_RETURN_IF_NULL_OR_FAULTY (monoid) ;
-    GrB_Info info = GB_reduce_to_scalar (c, monoid->op->ztype, accum,
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_reduce_to_scalar (c, monoid->op->ztype, accum,
         monoid, A, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -96,8 +102,11 @@ GrB_Info GrB_Matrix_reduce_Monoid   // w<M> = accum (w,reduce(A))
 { 
     GB_WHERE (w, "GrB_Matrix_reduce_Monoid (w, M, accum, monoid, A, desc)") ;
     GB_BURBLE_START ("GrB_reduce") ;
-    GrB_Info info = GB_reduce_to_vector ((GrB_Matrix) w, (GrB_Matrix) M,
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_reduce_to_vector ((GrB_Matrix) w, (GrB_Matrix) M,
         accum, monoid, A, desc, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -142,8 +151,11 @@ GrB_Info GrB_Matrix_reduce_BinaryOp
     // w<M> = reduce (A) via the monoid
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_reduce_to_vector ((GrB_Matrix) w, (GrB_Matrix) M,
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_reduce_to_vector ((GrB_Matrix) w, (GrB_Matrix) M,
         accum, monoid, A, desc, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
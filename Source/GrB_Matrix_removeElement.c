@@ -144,6 +144,17 @@ GrB_Info GrB_Matrix_removeElement
 
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
 
+    //--------------------------------------------------------------------------
+    // if C shares its content with a snapshot, give C its own copy
+    //--------------------------------------------------------------------------
+
+    if (C->shared != NULL)
+    { 
+        GrB_Info info ;
+        GB_WHERE1 (GB_WHERE_STRING) ;
+        GB_OK (GB_unshare ((GrB_Matrix) C, Context)) ;
+    }
+
     //--------------------------------------------------------------------------
     // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
@@ -156,12 +167,18 @@ GrB_Info GrB_Matrix_removeElement
         if (GB_IS_FULL (C))
         { 
             // convert C from full to sparse
-            GB_OK (GB_convert_to_nonfull (C, Context)) ;
+            GB_thread_budget_begin ( ) ;
+            info = GB_convert_to_nonfull (C, Context) ;
+            GB_thread_budget_end ( ) ;
+            GB_OK (info) ;
         }
         else
         { 
             // C is sparse or hypersparse, and jumbled
-            GB_OK (GB_Matrix_wait (C, "C", Context)) ;
+            GB_thread_budget_begin ( ) ;
+            info = GB_Matrix_wait (C, "C", Context) ;
+            GB_thread_budget_end ( ) ;
+            GB_OK (info) ;
         }
         ASSERT (!GB_IS_FULL (C)) ;
         ASSERT (!GB_ZOMBIES (C)) ;
@@ -236,7 +253,10 @@ GrB_Info GrB_Matrix_removeElement
         GrB_Info info ;
         GB_WHERE (C, GB_WHERE_STRING) ;
         GB_BURBLE_START ("GrB_Matrix_removeElement") ;
-        GB_OK (GB_Matrix_wait (C, "C", Context)) ;
+        GB_thread_budget_begin ( ) ;
+        info = GB_Matrix_wait (C, "C", Context) ;
+        GB_thread_budget_end ( ) ;
+        GB_OK (info) ;
         ASSERT (!GB_ZOMBIES (C)) ;
         ASSERT (!GB_JUMBLED (C)) ;
         ASSERT (!GB_PENDING (C)) ;
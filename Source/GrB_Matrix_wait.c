@@ -24,7 +24,7 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
     //--------------------------------------------------------------------------
 
     #pragma omp flush
-    GB_WHERE ((*A), "GrB_Matrix_wait (&A)") ;
+    GB_WHERE_LOG ((*A), "GrB_Matrix_wait (&A)") ;
     GB_RETURN_IF_NULL (A) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*A) ;
 
@@ -36,10 +36,16 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
     { 
         GrB_Info info ;
         GB_BURBLE_START ("GrB_Matrix_wait") ;
-        GB_OK (GB_Matrix_wait (*A, "matrix", Context)) ;
+        GB_thread_budget_begin ( ) ;
+        info = GB_Matrix_wait (*A, "matrix", Context) ;
+        GB_thread_budget_end ( ) ;
+        GB_OK (info) ;
         GB_BURBLE_END ;
     }
 
+    // cache the summary used to select the methods for GrB_mxm
+    GB_profile_cache ((*A), Context) ;
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
@@ -49,6 +49,7 @@ GrB_Info GrB_Row_assign             // C<M'>(row,Cols) += u'
     GrB_Index Rows [1] ;
     Rows [0] = row ;
 
+    GB_thread_budget_begin ( ) ;
     info = GB_assign (
         C,                  C_replace,      // C matrix and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
@@ -60,6 +61,7 @@ GrB_Info GrB_Row_assign             // C<M'>(row,Cols) += u'
         false, NULL, GB_ignore_code,        // no scalar expansion
         GB_ROW_ASSIGN,
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -47,6 +47,7 @@ GrB_Info GrB_Vector_apply           // w<M> = accum (w, op(u))
     // apply the operator; do not transpose
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_apply (
         (GrB_Matrix) w, C_replace,  // w and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
@@ -55,6 +56,7 @@ GrB_Info GrB_Vector_apply           // w<M> = accum (w, op(u))
         NULL, NULL, false,          // no binary operator
         (GrB_Matrix) u, false,      // u, not transposed
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -99,6 +101,7 @@ static inline GrB_Info GB_1st       // w<mask> = accum (w, op(x,u))
     // apply the operator; do not transpose
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_apply (
         (GrB_Matrix) w, C_replace,  // w and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
@@ -107,6 +110,7 @@ static inline GrB_Info GB_1st       // w<mask> = accum (w, op(x,u))
         op, x, true,                // operator op(x,.) to apply to the entries
         (GrB_Matrix) u,  false,     // u, not transposed
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -151,6 +155,7 @@ static inline GrB_Info GB_2nd       // w<mask> = accum (w, op(u,y))
     // apply the operator; do not transpose
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_apply (
         (GrB_Matrix) w, C_replace,  // w and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
@@ -159,6 +164,7 @@ static inline GrB_Info GB_2nd       // w<mask> = accum (w, op(u,y))
         op, y, false,               // operator op(.,y) to apply to the entries
         (GrB_Matrix) u, false,      // u, not transposed
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
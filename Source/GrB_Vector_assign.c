@@ -45,6 +45,7 @@ GrB_Info GrB_Vector_assign          // w<M>(Rows) = accum (w(Rows),u)
     // w(Rows)<M> = accum (w(Rows), u) and variations
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_assign (
         (GrB_Matrix) w,     C_replace,  // w vector and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct,  // mask and its descriptor
@@ -56,6 +57,7 @@ GrB_Info GrB_Vector_assign          // w<M>(Rows) = accum (w(Rows),u)
         false, NULL, GB_ignore_code,    // no scalar expansion
         GB_ASSIGN,
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
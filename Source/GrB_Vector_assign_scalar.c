@@ -32,9 +32,12 @@ GrB_Info GB_EVAL3 (prefix, _Vector_assign_, T) /* w<M>(Rows)=accum(w(Rows),x)*/\
     GB_RETURN_IF_FAULTY (M) ;                                                  \
     ASSERT (GB_VECTOR_OK (w)) ;                                                \
     ASSERT (GB_IMPLIES (M != NULL, GB_VECTOR_OK (M))) ;                        \
-    GrB_Info info = GB_assign_scalar ((GrB_Matrix) w, (GrB_Matrix) M, accum,   \
+    GrB_Info info ;                                                            \
+    GB_thread_budget_begin ( ) ;                                               \
+    info = GB_assign_scalar ((GrB_Matrix) w, (GrB_Matrix) M, accum,            \
         ampersand x, GB_## T ## _code, Rows, nRows, GrB_ALL, 1, desc,          \
         Context) ;                                                             \
+    GB_thread_budget_end ( ) ;                                                 \
     GB_BURBLE_END ;                                                            \
     return (info) ;                                                            \
 }
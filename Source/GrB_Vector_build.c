@@ -24,8 +24,11 @@ GrB_Info GB_EVAL3 (prefix, _Vector_build_, T) /* build a vector from tuples*/ \
     GB_BURBLE_START ("GrB_Vector_build") ;                                    \
     GB_RETURN_IF_NULL_OR_FAULTY (w) ;                                         \
     ASSERT (GB_VECTOR_OK (w)) ;                                               \
-    GrB_Info info = GB_matvec_build ((GrB_Matrix) w, I, NULL, X, nvals, dup,  \
+    GrB_Info info ;                                                           \
+    GB_thread_budget_begin ( ) ;                                              \
+    info = GB_matvec_build ((GrB_Matrix) w, I, NULL, X, nvals, dup,           \
         GB_ ## T ## _code, false, Context) ;                                  \
+    GB_thread_budget_end ( ) ;                                                \
     ASSERT (GB_IMPLIES (info == GrB_SUCCESS, GB_VECTOR_OK (w))) ;             \
     GB_BURBLE_END ;                                                           \
     return (info) ;                                                           \
@@ -32,7 +32,10 @@ GrB_Info GrB_Vector_dup     // make an exact copy of a vector
     // duplicate the vector
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_dup ((GrB_Matrix *) w, (GrB_Matrix) u, Context) ;
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_dup ((GrB_Matrix *) w, (GrB_Matrix) u, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -25,6 +25,7 @@
     GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,       \
         xx1, xx2, xx3, xx7) ;                                               \
     /* w<M> = accum (w,t) where t = u.*v, u'.*v, u.*v', or u'.*v' */        \
+    GB_thread_budget_begin ( ) ;                                            \
     info = GB_ewise (                                                       \
         (GrB_Matrix) w, C_replace,  /* w and its descriptor        */       \
         (GrB_Matrix) M, Mask_comp, Mask_struct,  /* mask and descriptor */  \
@@ -33,7 +34,8 @@
         (GrB_Matrix) u, false,      /* u, never transposed         */       \
         (GrB_Matrix) v, false,      /* v, never transposed         */       \
         false,                      /* eWiseMult                   */       \
-        Context) ;
+        Context) ;                                                          \
+    GB_thread_budget_end ( ) ;
 
 //------------------------------------------------------------------------------
 // GrB_Vector_eWiseMult_BinaryOp: vector element-wise multiplication
@@ -53,6 +53,7 @@ GrB_Info GrB_Vector_extract         // w<M> = accum (w, u(I))
     // do the work in GB_extract
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_extract (
         (GrB_Matrix) w,     C_replace,  // w as a matrix, and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct,  // mask and its descriptor
@@ -61,6 +62,7 @@ GrB_Info GrB_Vector_extract         // w<M> = accum (w, u(I))
         I, ni,                          // row indices I and length ni
         GrB_ALL, 1,                     // all columns
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
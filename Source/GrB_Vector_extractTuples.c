@@ -33,8 +33,11 @@ GrB_Info GB_EVAL3 (prefix, _Vector_extractTuples_, T) /* [I,~,X] = find (A) */\
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;                                         \
     GB_RETURN_IF_NULL (p_nvals) ;                                             \
     ASSERT (GB_VECTOR_OK (v)) ;                                               \
-    GrB_Info info = GB_extractTuples (I, NULL, X, p_nvals, GB_ ## T ## _code, \
+    GrB_Info info ;                                                           \
+    GB_thread_budget_begin ( ) ;                                              \
+    info = GB_extractTuples (I, NULL, X, p_nvals, GB_ ## T ## _code,          \
         (GrB_Matrix) v, Context) ;                                            \
+    GB_thread_budget_end ( ) ;                                                \
     GB_BURBLE_END ;                                                           \
     return (info) ;                                                           \
 }
@@ -29,7 +29,10 @@ GrB_Info GrB_Vector_nvals   // get the number of entries in a vector
     // get the number of entries
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_nvals (nvals, (GrB_Matrix) v, Context) ;
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_nvals (nvals, (GrB_Matrix) v, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
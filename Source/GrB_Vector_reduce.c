@@ -33,8 +33,11 @@ GrB_Info GB_EVAL3 (prefix, _Vector_reduce_, T) /* c = accum (c, reduce (u))*/ \
     GB_BURBLE_START ("GrB_reduce") ;                                          \
     GB_RETURN_IF_NULL_OR_FAULTY (u) ;                                         \
     ASSERT (GB_VECTOR_OK (u)) ;                                               \
-    GrB_Info info = GB_reduce_to_scalar (c, GB_EVAL3 (prefix, _, T), accum,   \
+    GrB_Info info ;                                                           \
+    GB_thread_budget_begin ( ) ;                                              \
+    info = GB_reduce_to_scalar (c, GB_EVAL3 (prefix, _, T), accum,            \
         monoid, (GrB_Matrix) u, Context) ;                                    \
+    GB_thread_budget_end ( ) ;                                                \
     GB_BURBLE_END ;                                                           \
     return (info) ;                                                           \
 }
@@ -68,8 +71,11 @@ GrB_Info GrB_Vector_reduce_UDT      // c = accum (c, reduce_to_scalar (u))
     GB_RETURN_IF_NULL_OR_FAULTY (u) ;
     GB_RETURN_IF_NULL_OR_FAULTY (monoid) ;
     ASSERT (GB_VECTOR_OK (u)) ;
-    GrB_Info info = GB_reduce_to_scalar (c, monoid->op->ztype,
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_reduce_to_scalar (c, monoid->op->ztype,
         accum, monoid, (GrB_Matrix) u, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -116,6 +116,17 @@ GrB_Info GrB_Vector_removeElement
 
     GB_RETURN_IF_NULL_OR_FAULTY (V) ;
 
+    //--------------------------------------------------------------------------
+    // if V shares its content with a snapshot, give V its own copy
+    //--------------------------------------------------------------------------
+
+    if (V->shared != NULL)
+    { 
+        GrB_Info info ;
+        GB_WHERE1 (GB_WHERE_STRING) ;
+        GB_OK (GB_unshare ((GrB_Matrix) V, Context)) ;
+    }
+
     //--------------------------------------------------------------------------
     // if V is jumbled, wait on the vector first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
@@ -128,12 +139,18 @@ GrB_Info GrB_Vector_removeElement
         if (GB_IS_FULL (V))
         { 
             // convert V from full to sparse
-            GB_OK (GB_convert_to_nonfull ((GrB_Matrix) V, Context)) ;
+            GB_thread_budget_begin ( ) ;
+            info = GB_convert_to_nonfull ((GrB_Matrix) V, Context) ;
+            GB_thread_budget_end ( ) ;
+            GB_OK (info) ;
         }
         else
         { 
             // V is sparse and jumbled
-            GB_OK (GB_Matrix_wait ((GrB_Matrix) V, "v", Context)) ;
+            GB_thread_budget_begin ( ) ;
+            info = GB_Matrix_wait ((GrB_Matrix) V, "v", Context) ;
+            GB_thread_budget_end ( ) ;
+            GB_OK (info) ;
         }
         ASSERT (!GB_IS_FULL (V)) ;
         ASSERT (!GB_ZOMBIES (V)) ;
@@ -183,7 +200,10 @@ GrB_Info GrB_Vector_removeElement
         GrB_Info info ;
         GB_WHERE (V, GB_WHERE_STRING) ;
         GB_BURBLE_START ("GrB_Vector_removeElement") ;
-        GB_OK (GB_Matrix_wait ((GrB_Matrix) V, "v", Context)) ;
+        GB_thread_budget_begin ( ) ;
+        info = GB_Matrix_wait ((GrB_Matrix) V, "v", Context) ;
+        GB_thread_budget_end ( ) ;
+        GB_OK (info) ;
         ASSERT (!GB_ZOMBIES (V)) ;
         ASSERT (!GB_JUMBLED (V)) ;
         ASSERT (!GB_PENDING (V)) ;
@@ -28,7 +28,10 @@ GrB_Info GrB_Vector_resize      // change the size of a vector
     // resize the vector
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_resize ((GrB_Matrix) w, nrows_new, 1, Context) ;
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_resize ((GrB_Matrix) w, nrows_new, 1, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -24,7 +24,7 @@ GrB_Info GrB_Vector_wait    // finish all work on a vector
     //--------------------------------------------------------------------------
 
     #pragma omp flush
-    GB_WHERE ((*v), "GrB_Vector_wait (&v)") ;
+    GB_WHERE_LOG ((*v), "GrB_Vector_wait (&v)") ;
     GB_RETURN_IF_NULL (v) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*v) ;
 
@@ -36,10 +36,16 @@ GrB_Info GrB_Vector_wait    // finish all work on a vector
     {
         GrB_Info info ;
         GB_BURBLE_START ("GrB_Vector_wait") ;
-        GB_OK (GB_Matrix_wait ((GrB_Matrix) (*v), "vector", Context)) ;
+        GB_thread_budget_begin ( ) ;
+        info = GB_Matrix_wait ((GrB_Matrix) (*v), "vector", Context) ;
+        GB_thread_budget_end ( ) ;
+        GB_OK (info) ;
         GB_BURBLE_END ;
     }
 
+    // cache the summary used to select the methods for GrB_mxm
+    GB_profile_cache ((GrB_Matrix) (*v), Context) ;
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
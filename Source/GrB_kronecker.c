@@ -42,6 +42,7 @@ GrB_Info GrB_Matrix_kronecker_BinaryOp  // C<M> = accum (C, kron(A,B))
     //--------------------------------------------------------------------------
 
     // C<M> = accum (C,T) where T = kron(A,B), or with A' and/or B'
+    GB_thread_budget_begin ( ) ;
     info = GB_kron (
         C,          C_replace,      // C matrix and its descriptor
         M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
@@ -50,6 +51,7 @@ GrB_Info GrB_Matrix_kronecker_BinaryOp  // C<M> = accum (C, kron(A,B))
         A,          A_tran,         // A matrix and its descriptor
         B,          B_tran,         // B matrix and its descriptor
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -89,6 +91,7 @@ GrB_Info GrB_Matrix_kronecker_Monoid  // C<M> = accum (C, kron(A,B))
     //--------------------------------------------------------------------------
 
     // C<M> = accum (C,T) where T = kron(A,B), or with A' and/or B'
+    GB_thread_budget_begin ( ) ;
     info = GB_kron (
         C,          C_replace,      // C matrix and its descriptor
         M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
@@ -97,6 +100,7 @@ GrB_Info GrB_Matrix_kronecker_Monoid  // C<M> = accum (C, kron(A,B))
         A,          A_tran,         // A matrix and its descriptor
         B,          B_tran,         // B matrix and its descriptor
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -136,6 +140,7 @@ GrB_Info GrB_Matrix_kronecker_Semiring  // C<M> = accum (C, kron(A,B))
     //--------------------------------------------------------------------------
 
     // C<M> = accum (C,T) where T = kron(A,B), or with A' and/or B'
+    GB_thread_budget_begin ( ) ;
     info = GB_kron (
         C,          C_replace,      // C matrix and its descriptor
         M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
@@ -144,6 +149,7 @@ GrB_Info GrB_Matrix_kronecker_Semiring  // C<M> = accum (C, kron(A,B))
         A,          A_tran,         // A matrix and its descriptor
         B,          B_tran,         // B matrix and its descriptor
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
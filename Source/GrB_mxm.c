@@ -47,6 +47,7 @@ GrB_Info GrB_mxm                    // C<M> = accum (C, A*B)
     //--------------------------------------------------------------------------
 
     // C<M> = accum (C,T) where T = A*B, A'*B, A*B', or A'*B'
+    GB_thread_budget_begin ( ) ;
     info = GB_mxm (
         C,          C_replace,      // C matrix and its descriptor
         M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
@@ -57,6 +58,7 @@ GrB_Info GrB_mxm                    // C<M> = accum (C, A*B)
         false,                      // use fmult(x,y), flipxy = false
         AxB_method, do_sort,        // algorithm selector
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -50,6 +50,7 @@ GrB_Info GrB_mxv                    // w<M> = accum (w, A*u)
     //--------------------------------------------------------------------------
 
     // w, M, and u are passed as matrices to GB_mxm.
+    GB_thread_budget_begin ( ) ;
     info = GB_mxm (
         (GrB_Matrix) w,     C_replace,      // w and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct,     // mask and its descriptor
@@ -60,6 +61,7 @@ GrB_Info GrB_mxv                    // w<M> = accum (w, A*u)
         false,                              // fmult(x,y), flipxy = false
         AxB_method, do_sort,                // algorithm selector
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -12,7 +12,7 @@
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_thread_budget_end ( ) ;
 
 GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
 (
@@ -50,7 +50,11 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
         A_transpose, xx1, xx2, xx7) ;
 
     // check domains and dimensions for C<M> = accum (C,T)
-    GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, A->type, Context));
+    info = GB_compatible (C->type, C, M, Mask_struct, accum, A->type, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (info) ;
+    }
 
     // check the dimensions
     int64_t tnrows = (!A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
@@ -68,6 +72,9 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
 
+    // meter the threads until the method returns (see GB_FREE_ALL)
+    GB_thread_budget_begin ( ) ;
+
     //--------------------------------------------------------------------------
     // T = A or A', where T can have the type of C or the type of A
     //--------------------------------------------------------------------------
@@ -86,7 +93,15 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
         // but method computes C<M>=A' by default when A_transpose is false.
 
         // Precasting:
-        if (accum == NULL)
+        int64_t tile_size = GB_Global_tile_size_get ( ) ;
+        if (tile_size > 0 && GB_NROWS (A) > 0 && GB_NCOLS (A) > 0
+            && (GB_NROWS (A) > tile_size || GB_NCOLS (A) > tile_size))
+        { 
+            // T = A', one tile at a time, typecasting as described below
+            GB_OK (GB_transpose_tiled (T, (accum == NULL) ? C->type : A->type,
+                C_is_csc, A, tile_size, Context)) ;
+        }
+        else if (accum == NULL)
         { 
             // If there is no accum operator, T is transplanted into Z and
             // typecasted into the C->type during the transpose.
@@ -133,6 +148,7 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
 
     info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp, 
         Mask_struct, Context) ;
+    GB_thread_budget_end ( ) ;
     if (info == GrB_SUCCESS)
     {
         ASSERT_MATRIX_OK (C, "final C for GrB_transpose", GB0) ;
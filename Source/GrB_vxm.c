@@ -56,6 +56,7 @@ GrB_Info GrB_vxm                    // w'<M> = accum (w', u'*A)
     // Since A and u are swapped, in all the matrix multiply kernels,
     // the multiplier must be flipped, so flipxy is passed in as true.
 
+    GB_thread_budget_begin ( ) ;
     info = GB_mxm (
         (GrB_Matrix) w,     C_replace,      // w and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
@@ -66,6 +67,7 @@ GrB_Info GrB_vxm                    // w'<M> = accum (w', u'*A)
         true,                               // fmult(y,x), flipxy = true
         AxB_method, do_sort,                // algorithm selector
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+// GxB_BinaryOp_new_vector: create an operator on vector-valued entries
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Creates the operator z(t) = scalar_op (x(t), y(t)) for t = 0:k-1, on a type
+// created by GxB_Type_new_vector.  The operator has no function pointer, since
+// k is only known at run time.  It records the opcode of scalar_op instead,
+// and every kernel computes it with GB_vector_binop, as a loop over the k
+// values that the compiler vectorizes (see GB_binop.h).  The PLUS_TIMES
+// semiring built from these operators also has a native saxpy kernel (see
+// GB_AxB_saxpy_generic).
+
+#include "GB.h"
+#include "GB_binop.h"
+
+//------------------------------------------------------------------------------
+// GxB_BinaryOp_new_vector
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_BinaryOp_new_vector    // create an op on vector-valued entries
+(
+    GrB_BinaryOp *binaryop,         // handle for the new binary operator
+    GrB_BinaryOp scalar_op,         // operator to apply to each value
+    GrB_Type type                   // type from GxB_Type_new_vector
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_BinaryOp_new_vector (&binaryop, scalar_op, type)") ;
+    GB_RETURN_IF_NULL (binaryop) ;
+    (*binaryop) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (scalar_op) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (type) ;
+    ASSERT_BINARYOP_OK (scalar_op, "scalar_op for vector op", GB0) ;
+
+    if (type->veclen == 0)
+    { 
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Type [%s] was not created by "
+            "GxB_Type_new_vector", type->name) ;
+    }
+
+    GrB_Type etype = type->etype ;
+    if (scalar_op->xtype != etype || scalar_op->ytype != etype
+        || scalar_op->ztype != etype)
+    { 
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Operator %s must have inputs and "
+            "output of type [%s]", scalar_op->name, etype->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the operator on each value
+    //--------------------------------------------------------------------------
+
+    switch (scalar_op->opcode)
+    {
+        case GB_FIRST_opcode  : 
+        case GB_SECOND_opcode : 
+        case GB_MIN_opcode    : 
+        case GB_MAX_opcode    : 
+        case GB_PLUS_opcode   : 
+        case GB_TIMES_opcode  : 
+            break ;
+        default : 
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "Operator %s is not supported "
+                "for vector-valued entries", scalar_op->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the operator
+    //--------------------------------------------------------------------------
+
+    size_t header_size ;
+    (*binaryop) = GB_MALLOC (1, struct GB_BinaryOp_opaque, &header_size) ;
+    if (*binaryop == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    (*binaryop)->header_size = header_size ;
+
+    char name [GB_LEN] ;
+    snprintf (name, GB_LEN, "%s [%d]", scalar_op->name, type->veclen) ;
+    GB_binop_new (*binaryop, NULL, type, type, type, name, GB_USER_opcode) ;
+    (*binaryop)->vector_opcode = scalar_op->opcode ;
+    ASSERT_BINARYOP_OK (*binaryop, "new vector op", GB0) ;
+    return (GrB_SUCCESS) ;
+}
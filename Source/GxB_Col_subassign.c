@@ -49,6 +49,7 @@ GrB_Info GxB_Col_subassign          // C(Rows,col)<M> = accum (C(Rows,col),u)
     GrB_Index Cols [1] ;
     Cols [0] = col ;
 
+    GB_thread_budget_begin ( ) ;
     info = GB_subassign (
         C,                  C_replace,      // C matrix and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
@@ -59,6 +60,7 @@ GrB_Info GxB_Col_subassign          // C(Rows,col)<M> = accum (C(Rows,col),u)
         Cols, 1,                            // a single column index
         false, NULL, GB_ignore_code,        // no scalar expansion
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// GxB_Context_disengage: disengage the context of the calling thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If context is NULL, any context engaged by the calling thread is disengaged.
+// Otherwise, the context must be the one engaged by the calling thread, or
+// GrB_INVALID_VALUE is returned.  The thread then uses the global options.
+
+#include "GB_atomics.h"
+
+GrB_Info GxB_Context_disengage  // disengage the context of the calling thread
+(
+    GxB_Context context         // context to disengage, or NULL for any
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_disengage (context)") ;
+    GB_RETURN_IF_FAULTY (context) ;
+
+    GxB_Context current = GB_Context_engaged ( ) ;
+    if (context != NULL && context != current)
+    { 
+        // the context is not engaged by this thread
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // disengage the context
+    //--------------------------------------------------------------------------
+
+    if (current != NULL)
+    { 
+        GB_Context_engaged_set (NULL) ;
+        GB_ATOMIC_WRITE
+        current->engaged = 0 ;
+    }
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// GxB_Context_engage: engage a context for the calling thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// All GraphBLAS methods called by this thread use the settings of the context,
+// until the thread calls GxB_Context_disengage.  A context can be engaged by
+// only one thread at a time; if another thread has it engaged, this method
+// returns GrB_INVALID_VALUE.  Engaging a context replaces any other context
+// the calling thread has engaged.
+
+#include "GB_atomics.h"
+
+GrB_Info GxB_Context_engage     // engage a context for the calling thread
+(
+    GxB_Context context         // context to engage
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_engage (context)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (context) ;
+
+    GxB_Context current = GB_Context_engaged ( ) ;
+    if (current == context)
+    { 
+        // already engaged by this thread
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // claim the context
+    //--------------------------------------------------------------------------
+
+    int32_t engaged, claimed = 1 ;
+    do
+    {
+        GB_ATOMIC_READ
+        engaged = context->engaged ;
+        if (engaged != 0)
+        { 
+            // engaged by another thread
+            return (GrB_INVALID_VALUE) ;
+        }
+    }
+    while (!GB_ATOMIC_COMPARE_EXCHANGE_32 (&(context->engaged), engaged,
+        claimed)) ;
+
+    //--------------------------------------------------------------------------
+    // release the prior context of this thread, and engage the new one
+    //--------------------------------------------------------------------------
+
+    if (current != NULL)
+    { 
+        GB_ATOMIC_WRITE
+        current->engaged = 0 ;
+    }
+    GB_Context_engaged_set (context) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// GxB_Context_free: free an execution context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If the context is engaged by the calling thread, it is disengaged first.
+// If it is engaged by any other thread, it is in use and is not freed, and
+// GrB_INVALID_OBJECT is returned.  Otherwise, the context is claimed as if
+// engaged, so that no other thread can engage it while it is being freed.
+
+#include "GB.h"
+#include "GB_atomics.h"
+
+GrB_Info GxB_Context_free       // free a context
+(
+    GxB_Context *context        // handle of context to free
+)
+{
+
+    if (context != NULL)
+    {
+        GxB_Context c = *context ;
+        if (c != NULL)
+        {
+            size_t header_size = c->header_size ;
+            if (header_size > 0)
+            { 
+                if (GB_Context_engaged ( ) == c)
+                { 
+                    // engaged by this thread: disengage it
+                    GB_Context_engaged_set (NULL) ;
+                }
+                else
+                {
+                    // claim the context, unless another thread has it
+                    int32_t engaged, claimed = 1 ;
+                    do
+                    {
+                        GB_ATOMIC_READ
+                        engaged = c->engaged ;
+                        if (engaged != 0)
+                        { 
+                            // engaged by another thread: it is in use
+                            return (GrB_INVALID_OBJECT) ;
+                        }
+                    }
+                    while (!GB_ATOMIC_COMPARE_EXCHANGE_32 (&(c->engaged),
+                        engaged, claimed)) ;
+                }
+                GB_free_counted (GB_MEMORY_WORKSPACE, (void **) &(c->arena),
+                    c->arena_size) ;
+                c->arena_size = 0 ;
+                GB_FREE (&(c->logger), c->logger_size) ;
+                c->logger_size = 0 ;
+                c->magic = GB_FREED ;  // to help detect dangling pointers
+                c->header_size = 0 ;
+                GB_FREE (context, header_size) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
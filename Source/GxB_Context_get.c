@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+// GxB_Context_get: get a parameter from a context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The setting in effect is returned: if the context setting is at its default,
+// the global option is returned instead.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_get        // get a parameter from a context
+(
+    GxB_Context context,        // context to query
+    GxB_Context_Field field,    // parameter to query
+    ...                         // return value of the parameter
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_get (context, field, &value)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (context) ;
+
+    //--------------------------------------------------------------------------
+    // get the parameter
+    //--------------------------------------------------------------------------
+
+    va_list ap ;
+
+    switch (field)
+    {
+
+        case GxB_CONTEXT_NTHREADS :     // same as GxB_NTHREADS
+
+            {
+                va_start (ap, field) ;
+                int *nthreads_max = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (nthreads_max) ;
+                (*nthreads_max) = (context->nthreads_max > GxB_DEFAULT) ?
+                    context->nthreads_max : GB_Global_nthreads_max_get ( ) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_CHUNK :        // same as GxB_CHUNK
+
+            {
+                va_start (ap, field) ;
+                double *chunk = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (chunk) ;
+                (*chunk) = (context->chunk > GxB_DEFAULT) ?
+                    context->chunk : GB_Global_chunk_get ( ) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_BURBLE : 
+
+            {
+                va_start (ap, field) ;
+                bool *burble = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (burble) ;
+                (*burble) = (context->burble >= 0) ?
+                    (context->burble != 0) : GB_Global_burble_get ( ) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_PRINTF : 
+
+            {
+                va_start (ap, field) ;
+                void **printf_func = va_arg (ap, void **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (printf_func) ;
+                (*printf_func) = (context->printf_func != NULL) ?
+                    (void *) context->printf_func :
+                    (void *) GB_Global_printf_get ( ) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_FLUSH : 
+
+            {
+                va_start (ap, field) ;
+                void **flush_func = va_arg (ap, void **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (flush_func) ;
+                (*flush_func) = (context->flush_func != NULL) ?
+                    (void *) context->flush_func :
+                    (void *) GB_Global_flush_get ( ) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_MEMORY_BUDGET : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *memory_budget = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (memory_budget) ;
+                (*memory_budget) = (context->memory_budget > 0) ?
+                    context->memory_budget : GB_Global_memory_budget_get ( ) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_ARENA : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *arena_size = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (arena_size) ;
+                (*arena_size) = (int64_t) context->arena_size ;
+            }
+            break ;
+
+        case GxB_CONTEXT_ARENA_AUTO : 
+
+            {
+                va_start (ap, field) ;
+                bool *arena_auto = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (arena_auto) ;
+                (*arena_auto) = context->arena_auto ;
+            }
+            break ;
+
+        default : 
+
+            return (GrB_INVALID_VALUE) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
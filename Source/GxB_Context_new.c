@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+// GxB_Context_new: create a new execution context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// All settings are at their defaults, so the new context follows the global
+// options until it is modified by GxB_Context_set.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_new        // create a new context
+(
+    GxB_Context *context        // handle of context to create
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_new (&context)") ;
+    GB_RETURN_IF_NULL (context) ;
+    (*context) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // create the context
+    //--------------------------------------------------------------------------
+
+    // allocate the context
+    size_t header_size ;
+    (*context) = GB_MALLOC (1, struct GB_Context_opaque, &header_size) ;
+    if (*context == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // initialize the context
+    GxB_Context c = *context ;
+    c->magic = GB_MAGIC ;
+    c->header_size = header_size ;
+    c->logger = NULL ;              // error string
+    c->logger_size = 0 ;
+    c->nthreads_max = GxB_DEFAULT ; // max # of threads to use
+    c->chunk = GxB_DEFAULT ;        // chunk for auto-tuning of # threads
+    c->burble = -1 ;                // burble from the global option
+    c->printf_func = NULL ;         // printf from the global option
+    c->flush_func = NULL ;          // flush from the global option
+    c->memory_budget = 0 ;          // no limit on workspace
+    c->arena = NULL ;               // no arena
+    c->arena_size = 0 ;
+    c->arena_top = 0 ;
+    c->arena_nblocks = 0 ;
+    c->arena_peak = 0 ;
+    c->arena_hwm = 0 ;
+    c->arena_auto = false ;         // arena size set by the user
+    c->engaged = 0 ;                // not engaged by any thread
+    c->engaged_level = 0 ;          // set when engaged
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,150 @@
+//------------------------------------------------------------------------------
+// GxB_Context_set: set a parameter in a context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A setting of GxB_DEFAULT (or NULL for the printf and flush functions) makes
+// the context follow the global option.  A negative burble does the same.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_set        // set a parameter in a context
+(
+    GxB_Context context,        // context to modify
+    GxB_Context_Field field,    // parameter to change
+    ...                         // value to change it to
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_set (context, field, value)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (context) ;
+
+    //--------------------------------------------------------------------------
+    // set the parameter
+    //--------------------------------------------------------------------------
+
+    va_list ap ;
+
+    switch (field)
+    {
+
+        case GxB_CONTEXT_NTHREADS :     // same as GxB_NTHREADS
+
+            {
+                va_start (ap, field) ;
+                int nthreads_max = va_arg (ap, int) ;
+                va_end (ap) ;
+                context->nthreads_max = GB_IMAX (nthreads_max, GxB_DEFAULT) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_CHUNK :        // same as GxB_CHUNK
+
+            {
+                va_start (ap, field) ;
+                double chunk = va_arg (ap, double) ;
+                va_end (ap) ;
+                context->chunk = GB_IMAX (chunk, GxB_DEFAULT) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_BURBLE : 
+
+            {
+                va_start (ap, field) ;
+                int burble = va_arg (ap, int) ;
+                va_end (ap) ;
+                context->burble = (burble < 0) ? (-1) : (burble != 0) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_PRINTF : 
+
+            {
+                va_start (ap, field) ;
+                void *printf_func = va_arg (ap, void *) ;
+                va_end (ap) ;
+                context->printf_func = (GB_printf_function_t) printf_func ;
+            }
+            break ;
+
+        case GxB_CONTEXT_FLUSH : 
+
+            {
+                va_start (ap, field) ;
+                void *flush_func = va_arg (ap, void *) ;
+                va_end (ap) ;
+                context->flush_func = (GB_flush_function_t) flush_func ;
+            }
+            break ;
+
+        case GxB_CONTEXT_MEMORY_BUDGET : 
+
+            {
+                va_start (ap, field) ;
+                int64_t memory_budget = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                context->memory_budget = GB_IMAX (memory_budget, 0) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_ARENA : 
+
+            {
+                va_start (ap, field) ;
+                int64_t arena_size = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                if (context->engaged != 0 || context->arena_nblocks > 0)
+                { 
+                    // the arena is in use
+                    return (GrB_INVALID_VALUE) ;
+                }
+                // free the old arena
+                GB_free_counted (GB_MEMORY_WORKSPACE,
+                    (void **) &(context->arena), context->arena_size) ;
+                context->arena_size = 0 ;
+                context->arena_top = 0 ;
+                context->arena_nblocks = 0 ;
+                if (arena_size > 0)
+                {
+                    // allocate the new arena
+                    size_t size ;
+                    context->arena = GB_malloc_counted (GB_MEMORY_WORKSPACE,
+                        arena_size, sizeof (GB_void), &size) ;
+                    if (context->arena == NULL)
+                    { 
+                        // out of memory
+                        return (GrB_OUT_OF_MEMORY) ;
+                    }
+                    context->arena_size = size ;
+                }
+            }
+            break ;
+
+        case GxB_CONTEXT_ARENA_AUTO : 
+
+            {
+                va_start (ap, field) ;
+                int arena_auto = va_arg (ap, int) ;
+                va_end (ap) ;
+                context->arena_auto = (arena_auto != 0) ;
+                context->arena_peak = 0 ;
+                context->arena_hwm = 0 ;
+            }
+            break ;
+
+        default : 
+
+            return (GrB_INVALID_VALUE) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
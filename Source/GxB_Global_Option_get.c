@@ -317,6 +317,133 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // thread budget
+        //----------------------------------------------------------------------
+
+        case GxB_THREAD_BUDGET : 
+
+            {
+                va_start (ap, field) ;
+                int *thread_budget = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (thread_budget) ;
+                (*thread_budget) = GB_Global_thread_budget_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // load balancing
+        //----------------------------------------------------------------------
+
+        case GxB_LOAD_BALANCE : 
+
+            {
+                va_start (ap, field) ;
+                GxB_Load_Balance_Value *load_balance =
+                    va_arg (ap, GxB_Load_Balance_Value *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (load_balance) ;
+                (*load_balance) = GB_Global_load_balance_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // NUMA placement
+        //----------------------------------------------------------------------
+
+        case GxB_NUMA_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                GxB_NUMA_Policy_Value *numa_policy =
+                    va_arg (ap, GxB_NUMA_Policy_Value *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (numa_policy) ;
+                (*numa_policy) = GB_Global_numa_policy_get ( ) ;
+            }
+            break ;
+
+        case GxB_NUMA_NODES : 
+
+            {
+                va_start (ap, field) ;
+                int *nnodes = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (nnodes) ;
+                (*nnodes) = GB_numa_nodes ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // huge pages
+        //----------------------------------------------------------------------
+
+        case GxB_HUGE_PAGE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *huge_page = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (huge_page) ;
+                (*huge_page) = GB_Global_huge_page_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // memory budget
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_BUDGET : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *memory_budget = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (memory_budget) ;
+                (*memory_budget) = GB_Global_memory_budget_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // tiled mxm and transpose
+        //----------------------------------------------------------------------
+
+        case GxB_TILE_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *tile_size = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (tile_size) ;
+                (*tile_size) = GB_Global_tile_size_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // memory usage
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_STORAGE : 
+        case GxB_MEMORY_STORAGE_PEAK : 
+        case GxB_MEMORY_WORKSPACE : 
+        case GxB_MEMORY_WORKSPACE_PEAK : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *bytes = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (bytes) ;
+                int kind = (field == GxB_MEMORY_STORAGE ||
+                            field == GxB_MEMORY_STORAGE_PEAK) ?
+                            GB_MEMORY_STORAGE : GB_MEMORY_WORKSPACE ;
+                bool peak = (field == GxB_MEMORY_STORAGE_PEAK ||
+                             field == GxB_MEMORY_WORKSPACE_PEAK) ;
+                (*bytes) = peak ? GB_Global_memory_peak_get (kind) :
+                                  GB_Global_memory_inuse_get (kind) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // CUDA (DRAFT: in progress, do not use)
         //----------------------------------------------------------------------
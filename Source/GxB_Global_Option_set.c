@@ -166,6 +166,107 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // thread budget
+        //----------------------------------------------------------------------
+
+        case GxB_THREAD_BUDGET : 
+
+            {
+                va_start (ap, field) ;
+                int thread_budget = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_thread_budget_set (thread_budget) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // load balancing
+        //----------------------------------------------------------------------
+
+        case GxB_LOAD_BALANCE : 
+
+            {
+                va_start (ap, field) ;
+                int load_balance = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (! (load_balance == GxB_LOAD_BALANCE_STATIC
+                    || load_balance == GxB_LOAD_BALANCE_DYNAMIC))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_load_balance_set
+                    ((GxB_Load_Balance_Value) load_balance) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // NUMA placement
+        //----------------------------------------------------------------------
+
+        case GxB_NUMA_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                int numa_policy = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (! (numa_policy == GxB_NUMA_DEFAULT
+                    || numa_policy == GxB_NUMA_FIRST_TOUCH
+                    || numa_policy == GxB_NUMA_INTERLEAVE))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                // find the NUMA nodes before any block is placed
+                GB_numa_nodes ( ) ;
+                GB_Global_numa_policy_set
+                    ((GxB_NUMA_Policy_Value) numa_policy) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // huge pages
+        //----------------------------------------------------------------------
+
+        case GxB_HUGE_PAGE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t huge_page = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                // a block smaller than one huge page cannot use them
+                GB_Global_huge_page_set ((huge_page <= 0) ? 0 :
+                    GB_IMAX (huge_page, GB_HUGE_PAGE_SIZE)) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // memory budget
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_BUDGET : 
+
+            {
+                va_start (ap, field) ;
+                int64_t memory_budget = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                GB_Global_memory_budget_set (GB_IMAX (memory_budget, 0)) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // tiled mxm and transpose
+        //----------------------------------------------------------------------
+
+        case GxB_TILE_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t tile_size = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                GB_Global_tile_size_set (GB_IMAX (tile_size, 0)) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // CUDA (DRAFT: in progress, do not use)
         //----------------------------------------------------------------------
@@ -78,6 +78,52 @@ GrB_Info GxB_Matrix_Option_get      // gets the current option of a matrix
             }
             break ;
 
+        case GxB_CONFORM_COUNT : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *count = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (count) ;
+                if (A->stats == NULL)
+                { 
+                    // conversions are only counted if GxB_STATS is on
+                    return (GrB_NO_VALUE) ;
+                }
+                (*count) = GB_stats_nconform (A) ;
+            }
+            break ;
+
+        case GxB_CONFORM_TIME : 
+
+            {
+                va_start (ap, field) ;
+                double *t = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (t) ;
+                if (A->stats == NULL)
+                { 
+                    // conversions are only counted if GxB_STATS is on
+                    return (GrB_NO_VALUE) ;
+                }
+                (*t) = GB_stats_conform_time (A) ;
+            }
+            break ;
+
+        case GxB_STATS : 
+
+            {
+                va_start (ap, field) ;
+                double *stats = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (stats) ;
+                for (int k = 0 ; k < GxB_NSTATS ; k++)
+                { 
+                    stats [k] = (A->stats == NULL) ? 0 : A->stats->s [k] ;
+                }
+            }
+            break ;
+
         case GxB_FORMAT : 
 
             {
@@ -87,14 +87,27 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
                     // A = A', done in-place, and change to the new format.
                     // transpose: no typecast, no op, in-place of A
                     GB_BURBLE_N (GB_NNZ (A), "(transpose) ") ;
-                    GB_OK (GB_transpose (NULL, NULL, new_csc, A, // in_place_A
-                        NULL, NULL, NULL, false, Context)) ;
+                    GB_thread_budget_begin ( ) ;
+                    info = GB_transpose (NULL, NULL, new_csc, A, // in_place_A
+                        NULL, NULL, NULL, false, Context) ;
+                    GB_thread_budget_end ( ) ;
+                    GB_OK (info) ;
                     ASSERT (A->is_csc == new_csc) ;
                     ASSERT (GB_JUMBLED_OK (A)) ;
                 }
             }
             break ;
 
+        case GxB_STATS : 
+
+            {
+                va_start (ap, field) ;
+                int on = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_OK (GB_stats_set (A, on != 0)) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -104,7 +117,10 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
     // conform the matrix to its new desired sparsity structure
     //--------------------------------------------------------------------------
 
-    GB_OK (GB_conform (A, Context)) ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_conform (A, Context) ;
+    GB_thread_budget_end ( ) ;
+    GB_OK (info) ;
     GB_BURBLE_END ;
     ASSERT_MATRIX_OK (A, "A set", GB0) ;
     return (GrB_SUCCESS) ;
@@ -40,7 +40,9 @@ GrB_Info GxB_Matrix_concat          // concatenate a 2D array of matrices
     // C = concatenate (Tiles)
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_concat (C, Tiles, m, n, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -34,7 +34,9 @@ GrB_Info GxB_Matrix_diag    // construct a diagonal matrix from a vector
     // C = diag (v,k)
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_Matrix_diag (C, (GrB_Matrix) v, k, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
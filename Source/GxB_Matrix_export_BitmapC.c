@@ -9,7 +9,7 @@
 
 #include "GB_export.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_thread_budget_end ( ) ;
 
 GrB_Info GxB_Matrix_export_BitmapC  // export and free a bitmap matrix, by col
 (
@@ -39,6 +39,8 @@ GrB_Info GxB_Matrix_export_BitmapC  // export and free a bitmap matrix, by col
     GB_RETURN_IF_NULL (A) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*A) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_thread_budget_begin ( ) ;
+    GB_OK (GB_unshare (*A, Context)) ;
 
     //--------------------------------------------------------------------------
     // ensure the matrix is bitmap CSC
@@ -77,6 +79,7 @@ GrB_Info GxB_Matrix_export_BitmapC  // export and free a bitmap matrix, by col
         nvals, NULL, NULL,                  // nvals for bitmap
         &sparsity, &is_csc,                 // bitmap by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     if (info == GrB_SUCCESS)
     {
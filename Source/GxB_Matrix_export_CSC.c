@@ -9,7 +9,7 @@
 
 #include "GB_export.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_thread_budget_end ( ) ;
 
 GrB_Info GxB_Matrix_export_CSC  // export and free a CSC matrix
 (
@@ -42,6 +42,8 @@ GrB_Info GxB_Matrix_export_CSC  // export and free a CSC matrix
     GB_RETURN_IF_NULL (A) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*A) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_thread_budget_begin ( ) ;
+    GB_OK (GB_unshare (*A, Context)) ;
     ASSERT_MATRIX_OK (*A, "A to export as CSC", GB0) ;
 
     //--------------------------------------------------------------------------
@@ -99,6 +101,7 @@ GrB_Info GxB_Matrix_export_CSC  // export and free a CSC matrix
         NULL, jumbled, NULL,                // jumbled or not
         &sparsity, &is_csc,                 // sparse by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     if (info == GrB_SUCCESS)
     {
@@ -9,7 +9,7 @@
 
 #include "GB_export.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_thread_budget_end ( ) ;
 
 GrB_Info GxB_Matrix_export_FullC  // export and free a full matrix, by column
 (
@@ -36,6 +36,8 @@ GrB_Info GxB_Matrix_export_FullC  // export and free a full matrix, by column
     GB_RETURN_IF_NULL (A) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*A) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_thread_budget_begin ( ) ;
+    GB_OK (GB_unshare (*A, Context)) ;
 
     //--------------------------------------------------------------------------
     // finish any pending work
@@ -45,6 +47,7 @@ GrB_Info GxB_Matrix_export_FullC  // export and free a full matrix, by column
     if (!GB_is_dense (*A))
     { 
         // A must be dense or full
+        GB_FREE_ALL ;
         return (GrB_INVALID_VALUE) ;
     }
 
@@ -86,6 +89,7 @@ GrB_Info GxB_Matrix_export_FullC  // export and free a full matrix, by column
         NULL, NULL, NULL,
         &sparsity, &is_csc,                 // full by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     if (info == GrB_SUCCESS)
     {
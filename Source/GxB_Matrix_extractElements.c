@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractElements: extract a list of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// X(k) = A(I(k),J(k)) for k = 0:nvals-1, typecasting from the type of A to the
+// type of X, as needed.  If A(I(k),J(k)) is not present, X(k) is not modified,
+// and Present [k] is set false (if Present is not NULL).  Returns GrB_SUCCESS
+// if all entries are present, or GrB_NO_VALUE otherwise.
+
+#include "GB_elements.h"
+
+#define GB_EXTRACT_ELEMENTS(type,T)                                           \
+GrB_Info GB_EVAL2 (GxB_Matrix_extractElements_, T) /* X(k) = A(I(k),J(k)) */  \
+(                                                                             \
+    type *X,                        /* array of extracted values          */  \
+    bool *Present,                  /* optional: true if entry present    */  \
+    const GrB_Matrix A,             /* matrix to extract entries from     */  \
+    const GrB_Index *I,             /* array of row indices of tuples     */  \
+    const GrB_Index *J,             /* array of column indices of tuples  */  \
+    GrB_Index nvals                 /* number of tuples                   */  \
+)                                                                             \
+{                                                                             \
+    GB_WHERE1 ("GxB_Matrix_extractElements_" GB_STR(T)                        \
+        " (X, Present, A, I, J, nvals)") ;                                    \
+    GB_BURBLE_START ("GxB_Matrix_extractElements") ;                          \
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;                                         \
+    GB_RETURN_IF_NULL (J) ;                                                   \
+    GrB_Info info ;                                                           \
+    GB_thread_budget_begin ( ) ;                                              \
+    info = GB_extractElements (X, Present, GB_ ## T ## _code, A,              \
+        I, J, nvals, Context) ;                                               \
+    GB_thread_budget_end ( ) ;                                                \
+    GB_BURBLE_END ;                                                           \
+    return (info) ;                                                           \
+}
+
+GB_EXTRACT_ELEMENTS (bool      , BOOL   )
+GB_EXTRACT_ELEMENTS (int8_t    , INT8   )
+GB_EXTRACT_ELEMENTS (uint8_t   , UINT8  )
+GB_EXTRACT_ELEMENTS (int16_t   , INT16  )
+GB_EXTRACT_ELEMENTS (uint16_t  , UINT16 )
+GB_EXTRACT_ELEMENTS (int32_t   , INT32  )
+GB_EXTRACT_ELEMENTS (uint32_t  , UINT32 )
+GB_EXTRACT_ELEMENTS (int64_t   , INT64  )
+GB_EXTRACT_ELEMENTS (uint64_t  , UINT64 )
+GB_EXTRACT_ELEMENTS (float     , FP32   )
+GB_EXTRACT_ELEMENTS (double    , FP64   )
+GB_EXTRACT_ELEMENTS (GxB_FC32_t, FC32   )
+GB_EXTRACT_ELEMENTS (GxB_FC64_t, FC64   )
+GB_EXTRACT_ELEMENTS (void      , UDT    )
+
@@ -40,6 +40,7 @@ GrB_Info GxB_Matrix_import_BitmapC  // import a bitmap matrix, held by column
     // import the matrix
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_import (A, type, nrows, ncols, false,
         NULL, 0,        // Ap
         NULL, 0,        // Ah
@@ -49,6 +50,7 @@ GrB_Info GxB_Matrix_import_BitmapC  // import a bitmap matrix, held by column
         nvals, false, 0,                    // nvals for bitmap
         GxB_BITMAP, true,                   // bitmap by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
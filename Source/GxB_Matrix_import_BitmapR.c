@@ -40,6 +40,7 @@ GrB_Info GxB_Matrix_import_BitmapR  // import a bitmap matrix, held by row
     // import the matrix
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_import (A, type, ncols, nrows, false,
         NULL, 0,        // Ap
         NULL, 0,        // Ah
@@ -49,6 +50,7 @@ GrB_Info GxB_Matrix_import_BitmapR  // import a bitmap matrix, held by row
         nvals, false, 0,                    // nvals for bitmap
         GxB_BITMAP, false,
         is_uniform, Context) ;              // bitmap by row
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -43,6 +43,7 @@ GrB_Info GxB_Matrix_import_CSC      // import a CSC matrix
     // import the matrix
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_import (A, type, nrows, ncols, false,
         Ap,   Ap_size,  // Ap
         NULL, 0,        // Ah
@@ -52,6 +53,7 @@ GrB_Info GxB_Matrix_import_CSC      // import a CSC matrix
         0, jumbled, 0,                      // jumbled or not
         GxB_SPARSE, true,                   // sparse by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
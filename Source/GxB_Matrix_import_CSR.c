@@ -43,6 +43,7 @@ GrB_Info GxB_Matrix_import_CSR      // import a CSR matrix
     // import the matrix
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_import (A, type, ncols, nrows, false,
         Ap,   Ap_size,  // Ap
         NULL, 0,        // Ah
@@ -52,6 +53,7 @@ GrB_Info GxB_Matrix_import_CSR      // import a CSR matrix
         0, jumbled, 0,                      // jumbled or not
         GxB_SPARSE, false,
         is_uniform, Context) ;              // sparse by row
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -37,6 +37,7 @@ GrB_Info GxB_Matrix_import_FullC  // import a full matrix, held by column
     // import the matrix
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_import (A, type, nrows, ncols, false,
         NULL, 0,        // Ap
         NULL, 0,        // Ah
@@ -46,6 +47,7 @@ GrB_Info GxB_Matrix_import_FullC  // import a full matrix, held by column
         0, false, 0,
         GxB_FULL, true,                     // full by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -37,6 +37,7 @@ GrB_Info GxB_Matrix_import_FullR  // import a full matrix, held by row
     // import the matrix
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_import (A, type, ncols, nrows, false,
         NULL, 0,        // Ap
         NULL, 0,        // Ah
@@ -46,6 +47,7 @@ GrB_Info GxB_Matrix_import_FullR  // import a full matrix, held by row
         0, false, 0,
         GxB_FULL, false,                    // full by row
         is_uniform, Context) ;              // full by row
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_memoryUsage: return the memory held by a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_memoryUsage // get the memory held by a matrix
+(
+    size_t usage [GxB_NMEMORY_USAGE], // bytes held, indexed by GxB_MEMORY_*
+    const GrB_Matrix A      // matrix to query
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_memoryUsage (usage, A)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // get the memory usage
+    //--------------------------------------------------------------------------
+
+    return (GB_memoryUsage (usage, A, Context)) ;
+}
+
@@ -0,0 +1,34 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_removeElements: remove a list of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Removes C(I(k),J(k)) for k = 0:nvals-1, if present.  The result is the same
+// as calling GrB_Matrix_removeElement for each tuple.
+
+#include "GB_elements.h"
+
+GrB_Info GxB_Matrix_removeElements  // remove C(I(k),J(k)) for k = 0:nvals-1
+(
+    GrB_Matrix C,                   // matrix to remove entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
+)
+{ 
+    GB_WHERE (C, "GxB_Matrix_removeElements (C, I, J, nvals)") ;
+    GB_BURBLE_START ("GxB_Matrix_removeElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL (J) ;
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_removeElements (C, I, J, nvals, Context) ;
+    GB_thread_budget_end ( ) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -41,6 +41,7 @@ GrB_Info GxB_Matrix_select  // C<M> = accum (C, select(A,k)) or select(A',k)
     // select the entries and optionally transpose; assemble pending tuples
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_select (
         C,      C_replace,          // C and its descriptor
         M, Mask_comp, Mask_struct,  // mask and its descriptor
@@ -50,6 +51,7 @@ GrB_Info GxB_Matrix_select  // C<M> = accum (C, select(A,k)) or select(A',k)
         Thunk,                      // optional input for select operator
         A_transpose,                // descriptor for A
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -0,0 +1,40 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_snapshot: create a read-only snapshot of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// S = A, where S shares the content of A (copy-on-write).  See GB_snapshot.
+
+#include "GB.h"
+
+GrB_Info GxB_Matrix_snapshot    // create a read-only snapshot of a matrix
+(
+    GrB_Matrix *S,              // handle of snapshot to create
+    const GrB_Matrix A          // matrix to take a snapshot of
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_snapshot (&S, A)") ;
+    GB_BURBLE_START ("GxB_Matrix_snapshot") ;
+    GB_RETURN_IF_NULL (S) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    //--------------------------------------------------------------------------
+    // create the snapshot
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_snapshot (S, A, Context) ;
+    GB_thread_budget_end ( ) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
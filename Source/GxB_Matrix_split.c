@@ -47,7 +47,9 @@ GrB_Info GxB_Matrix_split           // split a matrix into 2D array of matrices
     // Tiles = split (A)
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_split (Tiles, m, n, Tile_nrows, Tile_ncols, A, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
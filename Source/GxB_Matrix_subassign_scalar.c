@@ -38,8 +38,11 @@ GrB_Info GB_EVAL2 (GXB (Matrix_subassign_), T) /* C(Rows,Cols)<M> += x      */ \
     GB_BURBLE_START ("GxB_Matrix_subassign " GB_STR(T)) ;                      \
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                          \
     GB_RETURN_IF_FAULTY (M) ;                                                  \
-    GrB_Info info = GB_subassign_scalar (C, M, accum, ampersand x,             \
+    GrB_Info info ;                                                            \
+    GB_thread_budget_begin ( ) ;                                               \
+    info = GB_subassign_scalar (C, M, accum, ampersand x,                      \
         GB_## T ## _code, Rows, nRows, Cols, nCols, desc, Context) ;           \
+    GB_thread_budget_end ( ) ;                                                 \
     GB_BURBLE_END ;                                                            \
     return (info) ;                                                            \
 }
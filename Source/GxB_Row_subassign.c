@@ -48,6 +48,7 @@ GrB_Info GxB_Row_subassign          // C(row,Cols)<M'> += u'
     GrB_Index Rows [1] ;
     Rows [0] = row ;
 
+    GB_thread_budget_begin ( ) ;
     info = GB_subassign (
         C,                  C_replace,      // C matrix and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
@@ -58,6 +59,7 @@ GrB_Info GxB_Row_subassign          // C(row,Cols)<M'> += u'
         Cols, nCols,                        // column indices
         false, NULL, GB_ignore_code,        // no scalar expansion
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -24,7 +24,7 @@ GrB_Info GxB_Scalar_wait    // finish all work on a scalar
     //--------------------------------------------------------------------------
 
     #pragma omp flush
-    GB_WHERE ((*s), "GxB_Scalar_wait (&s)") ;
+    GB_WHERE_LOG ((*s), "GxB_Scalar_wait (&s)") ;
     GB_RETURN_IF_NULL (s) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*s) ;
 
@@ -36,7 +36,10 @@ GrB_Info GxB_Scalar_wait    // finish all work on a scalar
     {
         GrB_Info info ;
         GB_BURBLE_START ("GxB_Scalar_wait") ;
-        GB_OK (GB_Matrix_wait ((GrB_Matrix) (*s), "scalar", Context)) ;
+        GB_thread_budget_begin ( ) ;
+        info = GB_Matrix_wait ((GrB_Matrix) (*s), "scalar", Context) ;
+        GB_thread_budget_end ( ) ;
+        GB_OK (info) ;
         GB_BURBLE_END ;
     }
 
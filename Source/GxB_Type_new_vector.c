@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+// GxB_Type_new_vector: create a type of k values of a built-in type
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each entry of a matrix of this type is a vector of k values of type etype,
+// with the C type float [k] or double [k].  It is a user-defined type in all
+// other respects.  Operators on this type are created with
+// GxB_BinaryOp_new_vector.
+
+#include "GB.h"
+
+GrB_Info GxB_Type_new_vector    // create a type of k values of a built-in type
+(
+    GrB_Type *type,             // handle of the new type
+    GrB_Type etype,             // type of each value: GrB_FP32 or GrB_FP64
+    int k                       // number of values: 1 to 256
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Type_new_vector (&type, etype, k)") ;
+    GB_RETURN_IF_NULL (type) ;
+    (*type) = NULL ;
+    GB_RETURN_IF_NULL_OR_FAULTY (etype) ;
+
+    if (etype->code != GB_FP32_code && etype->code != GB_FP64_code)
+    { 
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Type of each value must be "
+            "GrB_FP32 or GrB_FP64, not [%s]", etype->name) ;
+    }
+
+    if (k < 1 || k > GxB_VECTOR_MAXLEN)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Number of values k = %d must be "
+            "in the range 1 to %d", k, GxB_VECTOR_MAXLEN) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the type
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_Type_new (type, k * etype->size, NULL) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
+
+    GrB_Type t = (*type) ;
+    t->etype = etype ;
+    t->veclen = k ;
+    snprintf (t->name, GB_LEN, "%s [%d]", etype->name, k) ;
+    return (GrB_SUCCESS) ;
+}
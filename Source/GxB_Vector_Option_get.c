@@ -67,6 +67,52 @@ GrB_Info GxB_Vector_Option_get      // gets the current option of a vector
             }
             break ;
 
+        case GxB_CONFORM_COUNT : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *count = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (count) ;
+                if (v->stats == NULL)
+                { 
+                    // conversions are only counted if GxB_STATS is on
+                    return (GrB_NO_VALUE) ;
+                }
+                (*count) = GB_stats_nconform (v) ;
+            }
+            break ;
+
+        case GxB_CONFORM_TIME : 
+
+            {
+                va_start (ap, field) ;
+                double *t = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (t) ;
+                if (v->stats == NULL)
+                { 
+                    // conversions are only counted if GxB_STATS is on
+                    return (GrB_NO_VALUE) ;
+                }
+                (*t) = GB_stats_conform_time (v) ;
+            }
+            break ;
+
+        case GxB_STATS : 
+
+            {
+                va_start (ap, field) ;
+                double *stats = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (stats) ;
+                for (int k = 0 ; k < GxB_NSTATS ; k++)
+                { 
+                    stats [k] = (v->stats == NULL) ? 0 : v->stats->s [k] ;
+                }
+            }
+            break ;
+
         case GxB_FORMAT : 
 
             {
@@ -58,6 +58,16 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
             }
             break ;
 
+        case GxB_STATS : 
+
+            {
+                va_start (ap, field) ;
+                int on = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_OK (GB_stats_set ((GrB_Matrix) v, on != 0)) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -67,7 +77,10 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
     // conform the vector to its new desired sparsity structure
     //--------------------------------------------------------------------------
 
-    GB_OK (GB_conform ((GrB_Matrix) v, Context)) ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_conform ((GrB_Matrix) v, Context) ;
+    GB_thread_budget_end ( ) ;
+    GB_OK (info) ;
     GB_BURBLE_END ;
     ASSERT_VECTOR_OK (v, "v set", GB0) ;
     return (info) ;
@@ -34,7 +34,9 @@ GrB_Info GxB_Vector_diag    // extract a diagonal from a matrix, as a vector
     // v = diag (A,k)
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_Vector_diag ((GrB_Matrix) v, A, k, Context) ;
+    GB_thread_budget_end ( ) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -9,7 +9,7 @@
 
 #include "GB_export.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_thread_budget_end ( ) ;
 
 GrB_Info GxB_Vector_export_Bitmap   // export and free a bitmap vector
 (
@@ -38,6 +38,8 @@ GrB_Info GxB_Vector_export_Bitmap   // export and free a bitmap vector
     GB_RETURN_IF_NULL (v) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*v) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_thread_budget_begin ( ) ;
+    GB_OK (GB_unshare ((GrB_Matrix) (*v), Context)) ;
 
     //--------------------------------------------------------------------------
     // finish any pending work
@@ -75,6 +77,7 @@ GrB_Info GxB_Vector_export_Bitmap   // export and free a bitmap vector
         nvals, NULL, NULL,                  // nvals for bitmap
         &sparsity, &is_csc,                 // bitmap by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     if (info == GrB_SUCCESS)
     {
@@ -9,7 +9,7 @@
 
 #include "GB_export.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_thread_budget_end ( ) ;
 
 GrB_Info GxB_Vector_export_CSC  // export and free a CSC vector
 (
@@ -40,6 +40,8 @@ GrB_Info GxB_Vector_export_CSC  // export and free a CSC vector
     GB_RETURN_IF_NULL (v) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*v) ;
     GB_RETURN_IF_NULL (nvals) ;
+    GB_thread_budget_begin ( ) ;
+    GB_OK (GB_unshare ((GrB_Matrix) (*v), Context)) ;
     ASSERT_VECTOR_OK (*v, "v to export", GB0) ;
 
     //--------------------------------------------------------------------------
@@ -86,6 +88,7 @@ GrB_Info GxB_Vector_export_CSC  // export and free a CSC vector
         nvals, jumbled, NULL,               // jumbled or not
         &sparsity, &is_csc,                 // sparse by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     if (info == GrB_SUCCESS)
     { 
@@ -9,7 +9,7 @@
 
 #include "GB_export.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_thread_budget_end ( ) ;
 
 GrB_Info GxB_Vector_export_Full   // export and free a full vector
 (
@@ -35,6 +35,8 @@ GrB_Info GxB_Vector_export_Full   // export and free a full vector
     GB_RETURN_IF_NULL (v) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*v) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_thread_budget_begin ( ) ;
+    GB_OK (GB_unshare ((GrB_Matrix) (*v), Context)) ;
 
     //--------------------------------------------------------------------------
     // finish any pending work
@@ -44,6 +46,7 @@ GrB_Info GxB_Vector_export_Full   // export and free a full vector
     if (!GB_is_dense ((GrB_Matrix) (*v)))
     { 
         // v must be dense or full
+        GB_FREE_ALL ;
         return (GrB_INVALID_VALUE) ;
     }
 
@@ -77,6 +80,7 @@ GrB_Info GxB_Vector_export_Full   // export and free a full vector
         NULL, NULL, NULL,
         &sparsity, &is_csc,                 // full by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     if (info == GrB_SUCCESS)
     {
@@ -39,6 +39,7 @@ GrB_Info GxB_Vector_import_Bitmap // import a bitmap vector
     // import the vector
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_import ((GrB_Matrix *) v, type, n, 1, false,
         NULL, 0,        // Ap
         NULL, 0,        // Ah
@@ -48,6 +49,7 @@ GrB_Info GxB_Vector_import_Bitmap // import a bitmap vector
         nvals, false, 0,                    // nvals for bitmap
         GxB_BITMAP, true,                   // bitmap by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
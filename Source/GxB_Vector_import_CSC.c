@@ -40,6 +40,7 @@ GrB_Info GxB_Vector_import_CSC  // import a vector in CSC format
     // import the vector
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_import ((GrB_Matrix *) v, type, n, 1, true,
         NULL, 0,        // Ap
         NULL, 0,        // Ah
@@ -49,6 +50,7 @@ GrB_Info GxB_Vector_import_CSC  // import a vector in CSC format
         nvals, jumbled, 0,                  // jumbled or not
         GxB_SPARSE, true,                   // sparse by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
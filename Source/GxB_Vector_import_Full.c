@@ -36,6 +36,7 @@ GrB_Info GxB_Vector_import_Full // import a full vector
     // import the vector
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_import ((GrB_Matrix *) v, type, n, 1, false,
         NULL, 0,        // Ap
         NULL, 0,        // Ah
@@ -45,6 +46,7 @@ GrB_Info GxB_Vector_import_Full // import a full vector
         0, false, 0,
         GxB_FULL, true,                     // full by col
         is_uniform, Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
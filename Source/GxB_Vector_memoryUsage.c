@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_memoryUsage: return the memory held by a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+
+GrB_Info GxB_Vector_memoryUsage // get the memory held by a vector
+(
+    size_t usage [GxB_NMEMORY_USAGE], // bytes held; see GxB_Matrix_memoryUsage
+    const GrB_Vector v      // vector to query
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Vector_memoryUsage (usage, v)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+
+    //--------------------------------------------------------------------------
+    // get the memory usage
+    //--------------------------------------------------------------------------
+
+    return (GB_memoryUsage (usage, (GrB_Matrix) v, Context)) ;
+}
+
@@ -0,0 +1,34 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_removeElements: remove a list of entries from a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Removes w(I(k)) for k = 0:nvals-1, if present.  The result is the same as
+// calling GrB_Vector_removeElement for each tuple.
+
+#include "GB_elements.h"
+
+GrB_Info GxB_Vector_removeElements  // remove w(I(k)) for k = 0:nvals-1
+(
+    GrB_Vector w,                   // vector to remove entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    GrB_Index nvals                 // number of tuples
+)
+{ 
+    GB_WHERE (w, "GxB_Vector_removeElements (w, I, nvals)") ;
+    GB_BURBLE_START ("GxB_Vector_removeElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    ASSERT (GB_VECTOR_OK (w)) ;
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_removeElements ((GrB_Matrix) w, I, NULL, nvals,
+        Context) ;
+    GB_thread_budget_end ( ) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
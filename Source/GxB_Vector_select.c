@@ -39,6 +39,7 @@ GrB_Info GxB_Vector_select          // w<M> = accum (w, select(u,k))
     // select the entries; do not transpose; assemble pending entries
     //--------------------------------------------------------------------------
 
+    GB_thread_budget_begin ( ) ;
     info = GB_select (
         (GrB_Matrix) w,     C_replace,      // w and its descriptor
         (GrB_Matrix) M, Mask_comp, Mask_struct, // mask and its descriptor
@@ -48,6 +49,7 @@ GrB_Info GxB_Vector_select          // w<M> = accum (w, select(u,k))
         Thunk,                              // optional input for select op
         false,                              // u, not transposed
         Context) ;
+    GB_thread_budget_end ( ) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -0,0 +1,53 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_setElements: set a list of entries in a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w(I(k)) = X(k) for k = 0:nvals-1, typecasting from the type of X to the
+// type of w, as needed.  The result is the same as calling
+// GrB_Vector_setElement for each tuple in order.
+
+#include "GB_elements.h"
+
+#define GB_SET_ELEMENTS(type,T)                                               \
+GrB_Info GB_EVAL2 (GxB_Vector_setElements_, T) /* w(I(k)) = X(k) */           \
+(                                                                             \
+    GrB_Vector w,                   /* vector to modify                   */  \
+    const GrB_Index *I,             /* array of row indices of tuples     */  \
+    const type *X,                  /* array of values of tuples          */  \
+    GrB_Index nvals                 /* number of tuples                   */  \
+)                                                                             \
+{                                                                             \
+    GB_WHERE (w, "GxB_Vector_setElements_" GB_STR(T)                          \
+        " (w, I, X, nvals)") ;                                                \
+    GB_BURBLE_START ("GxB_Vector_setElements") ;                              \
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;                                         \
+    ASSERT (GB_VECTOR_OK (w)) ;                                               \
+    GrB_Info info ;                                                           \
+    GB_thread_budget_begin ( ) ;                                              \
+    info = GB_setElements ((GrB_Matrix) w, I, NULL, X, nvals,                 \
+        GB_ ## T ## _code, Context) ;                                         \
+    GB_thread_budget_end ( ) ;                                                \
+    GB_BURBLE_END ;                                                           \
+    return (info) ;                                                           \
+}
+
+GB_SET_ELEMENTS (bool      , BOOL   )
+GB_SET_ELEMENTS (int8_t    , INT8   )
+GB_SET_ELEMENTS (uint8_t   , UINT8  )
+GB_SET_ELEMENTS (int16_t   , INT16  )
+GB_SET_ELEMENTS (uint16_t  , UINT16 )
+GB_SET_ELEMENTS (int32_t   , INT32  )
+GB_SET_ELEMENTS (uint32_t  , UINT32 )
+GB_SET_ELEMENTS (int64_t   , INT64  )
+GB_SET_ELEMENTS (uint64_t  , UINT64 )
+GB_SET_ELEMENTS (float     , FP32   )
+GB_SET_ELEMENTS (double    , FP64   )
+GB_SET_ELEMENTS (GxB_FC32_t, FC32   )
+GB_SET_ELEMENTS (GxB_FC64_t, FC64   )
+GB_SET_ELEMENTS (void      , UDT    )
+
@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_snapshot: create a read-only snapshot of a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = v, where s shares the content of v (copy-on-write).  See GB_snapshot.
+
+#include "GB.h"
+
+GrB_Info GxB_Vector_snapshot    // create a read-only snapshot of a vector
+(
+    GrB_Vector *s,              // handle of snapshot to create
+    const GrB_Vector v          // vector to take a snapshot of
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Vector_snapshot (&s, v)") ;
+    GB_BURBLE_START ("GxB_Vector_snapshot") ;
+    GB_RETURN_IF_NULL (s) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    ASSERT (GB_VECTOR_OK (v)) ;
+
+    //--------------------------------------------------------------------------
+    // create the snapshot
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_thread_budget_begin ( ) ;
+    info = GB_snapshot ((GrB_Matrix *) s, (GrB_Matrix) v, Context) ;
+    GB_thread_budget_end ( ) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -34,9 +34,12 @@ GrB_Info GB_EVAL2 (GXB (Vector_subassign_), T) /* w(I)<M> = accum (w(I),x)  */ \
     GB_RETURN_IF_FAULTY (M) ;                                                  \
     ASSERT (GB_VECTOR_OK (w)) ;                                                \
     ASSERT (GB_IMPLIES (M != NULL, GB_VECTOR_OK (M))) ;                        \
-    GrB_Info info = (GB_subassign_scalar ((GrB_Matrix) w, (GrB_Matrix) M,      \
+    GrB_Info info ;                                                            \
+    GB_thread_budget_begin ( ) ;                                               \
+    info = (GB_subassign_scalar ((GrB_Matrix) w, (GrB_Matrix) M,               \
         accum, ampersand x, GB_## T ## _code, Rows, nRows, GrB_ALL, 1, desc,   \
         Context)) ;                                                            \
+    GB_thread_budget_end ( ) ;                                                 \
     GB_BURBLE_END ;                                                            \
     return (info) ;                                                            \
 }
@@ -0,0 +1,20 @@
+//------------------------------------------------------------------------------
+// GxB_memoryPeak_reset: reset the peak memory counters
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Sets GxB_MEMORY_STORAGE_PEAK and GxB_MEMORY_WORKSPACE_PEAK to the current
+// values of GxB_MEMORY_STORAGE and GxB_MEMORY_WORKSPACE.
+
+#include "GB.h"
+
+GrB_Info GxB_memoryPeak_reset (void)
+{ 
+    GB_Global_memory_peak_reset ( ) ;
+    return (GrB_SUCCESS) ;
+}
+
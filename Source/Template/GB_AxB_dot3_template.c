@@ -12,6 +12,7 @@
 
 {
 
+    GB_TASK_TIMING
     int tid ;
     #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
         reduction(+:nzombies)
@@ -22,6 +23,7 @@
         // get the task descriptor
         //----------------------------------------------------------------------
 
+        GB_TASK_TIME_START
         int64_t kfirst = TaskList [tid].kfirst ;
         int64_t klast  = TaskList [tid].klast ;
         int64_t pC_first = TaskList [tid].pC ;
@@ -164,6 +166,7 @@
             }
         }
         nzombies += task_nzombies ;
+        GB_TASK_TIME_END (TaskList [tid].time)
     }
 }
 
@@ -18,6 +18,8 @@
 
     GxB_binary_function fmult = mult->function ;    // NULL if positional
     GxB_binary_function fadd  = add->op->function ;
+    GB_BINOP_VECTOR (fmult, mult) ;     // for ops on vector-valued entries
+    GB_BINOP_VECTOR (fadd, add->op) ;
     GB_Opcode opcode = mult->opcode ;
     bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
 
@@ -270,7 +272,7 @@
         #define GB_MULTADD(cij, aki, bkj, i, k, j)                      \
             GB_void zwork [GB_VLA(csize)] ;                             \
             GB_MULT (zwork, aki, bkj, i, k, j) ;                        \
-            fadd (cij, cij, zwork)
+            GB_BINOP_CALL (fadd, cij, cij, zwork)
 
         #undef  GB_CTYPE
         #define GB_CTYPE GB_void
@@ -320,7 +322,8 @@
             { 
                 // t = B(k,j) * (A')(i,k)
                 #undef  GB_MULT
-                #define GB_MULT(t, aki, bkj, i, k, j) fmult (t, bkj, aki)
+                #define GB_MULT(t, aki, bkj, i, k, j)                   \
+                    GB_BINOP_CALL (fmult, t, bkj, aki)
                 #if defined ( GB_DOT2_GENERIC )
                 #include "GB_AxB_dot2_meta.c"
                 #elif defined ( GB_DOT3_GENERIC )
@@ -333,7 +336,8 @@
             { 
                 // t = (A')(i,k) * B(k,j)
                 #undef  GB_MULT
-                #define GB_MULT(t, aki, bkj, i, k, j) fmult (t, aki, bkj)
+                #define GB_MULT(t, aki, bkj, i, k, j)                   \
+                    GB_BINOP_CALL (fmult, t, aki, bkj)
                 #if defined ( GB_DOT2_GENERIC )
                 #include "GB_AxB_dot2_meta.c"
                 #elif defined ( GB_DOT3_GENERIC )
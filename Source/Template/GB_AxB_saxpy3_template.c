@@ -82,6 +82,7 @@
     // Coarse tasks: nothing to do in phase2.
     // Fine tasks: compute nnz (C(:,j)), and values in Hx via atomics.
 
+    GB_TASK_TIMING
     int taskid ;
     #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
     for (taskid = 0 ; taskid < nfine ; taskid++)
@@ -91,6 +92,7 @@
         // get the task descriptor
         //----------------------------------------------------------------------
 
+        GB_TASK_TIME_START
         int64_t kk = SaxpyTasks [taskid].vector ;
         int team_size = SaxpyTasks [taskid].team_size ;
         int64_t hash_size = SaxpyTasks [taskid].hsize ;
@@ -282,6 +284,7 @@
             }
             #endif
         }
+        GB_TASK_TIME_END (SaxpyTasks [taskid].time)
     }
 
 // ttt = omp_get_wtime ( ) - ttt ;
@@ -358,6 +361,7 @@
         // get the task descriptor
         //----------------------------------------------------------------------
 
+        GB_TASK_TIME_START
         #if !GB_IS_ANY_PAIR_SEMIRING
         GB_CTYPE *restrict Hx = (GB_CTYPE *) SaxpyTasks [taskid].Hx ;
         #endif
@@ -585,6 +589,7 @@
             }
         }
         C_jumbled = C_jumbled || task_C_jumbled ;
+        GB_TASK_TIME_END (SaxpyTasks [taskid].time)
     }
 
     //--------------------------------------------------------------------------
@@ -16,7 +16,11 @@
 // This template constructs GrB_Matrix_extractElement_[TYPE] for each of the
 // 13 built-in types, and the _UDT method for all user-defined types.
 
-// FUTURE: tolerate zombies
+// Zombies are tolerated, and A(row,col) is found in the list of pending tuples
+// without assembling them, if the list can be searched quickly (see
+// GB_Pending_searchable).  This allows a matrix to be modified with
+// GrB_Matrix_setElement and GrB_Matrix_removeElement, interleaved with calls
+// to GrB_Matrix_extractElement, without assembling the matrix each time.
 
 GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
 (
@@ -34,17 +38,23 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     GB_RETURN_IF_NULL (x) ;
 
-    // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (GB_ANY_PENDING_WORK (A))
+    // unjumble the matrix, and assemble any pending tuples if they cannot be
+    // searched quickly.  Zombies are left in the matrix.
+    if (A->jumbled || GB_DEFERRED (A) || !GB_Pending_searchable (A))
     { 
         GrB_Info info ;
         GB_WHERE1 (GB_WHERE_STRING) ;
         GB_BURBLE_START ("GrB_Matrix_extractElement") ;
-        GB_OK (GB_Matrix_wait (A, "A", Context)) ;
+        GB_thread_budget_begin ( ) ;
+        info = GB_Matrix_wait (A, "A", Context) ;
+        GB_thread_budget_end ( ) ;
+        GB_OK (info) ;
         GB_BURBLE_END ;
     }
 
-    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (GB_PENDING_OK (A)) ;
 
     // look for index i in vector j
     int64_t i, j, nrows, ncols ;
@@ -76,7 +86,7 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
         return (GrB_DOMAIN_MISMATCH) ;
     }
 
-    if (A->nzmax == 0)
+    if (A->nzmax == 0 && !GB_PENDING (A))
     { 
         // quick return
         return (GrB_NO_VALUE) ;
@@ -87,43 +97,42 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     //--------------------------------------------------------------------------
 
     int64_t pleft ;
-    bool found ;
+    bool found = false, is_zombie = false ;
     const int64_t *restrict Ap = A->p ;
 
-    if (Ap != NULL)
+    if (A->nzmax == 0)
+    { 
+        // A has no entries, only pending tuples
+        found = false ;
+    }
+    else if (Ap != NULL)
     { 
         // A is sparse or hypersparse
         const int64_t *restrict Ai = A->i ;
 
         // extract from vector j of a GrB_Matrix
-        int64_t k ;
+        int64_t k = j ;
+        bool found_vector = true ;
         if (A->h != NULL)
         {
             // A is hypersparse: look for j in hyperlist A->h [0 ... A->nvec-1]
             const int64_t *restrict Ah = A->h ;
             int64_t pleft = 0 ;
             int64_t pright = A->nvec-1 ;
-            GB_BINARY_SEARCH (j, Ah, pleft, pright, found) ;
-            if (!found)
-            { 
-                // vector j is empty
-                return (GrB_NO_VALUE) ;
-            }
-            ASSERT (j == Ah [pleft]) ;
+            GB_BINARY_SEARCH (j, Ah, pleft, pright, found_vector) ;
             k = pleft ;
         }
-        else
-        { 
-            // A is sparse: j = k is the kth vector
-            k = j ;
-        }
 
-        pleft = Ap [k] ;
-        int64_t pright = Ap [k+1] - 1 ;
+        if (found_vector)
+        { 
+            pleft = Ap [k] ;
+            int64_t pright = Ap [k+1] - 1 ;
 
-        // binary search in kth vector for index i
-        // Time taken for this step is at most O(log(nnz(A(:,j))).
-        GB_BINARY_SEARCH (i, Ai, pleft, pright, found) ;
+            // binary search in kth vector for index i
+            // Time taken for this step is at most O(log(nnz(A(:,j))).
+            GB_BINARY_SEARCH_ZOMBIE (i, Ai, pleft, pright, found,
+                A->nzombies, is_zombie) ;
+        }
     }
     else
     {
@@ -146,7 +155,12 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     // extract the element
     //--------------------------------------------------------------------------
 
-    if (found)
+    if (found && is_zombie)
+    { 
+        // A(i,j) has been deleted.  It cannot also be a pending tuple.
+        return (GrB_NO_VALUE) ;
+    }
+    else if (found)
     {
         #if !defined ( GB_UDT_EXTRACT )
         if (GB_XCODE == acode)
@@ -166,6 +180,30 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
         }
         return (GrB_SUCCESS) ;
     }
+    else if (GB_PENDING (A))
+    {
+        // look for A(i,j) in the list of pending tuples
+        GB_Pending Pending = A->Pending ;
+        int64_t p = GB_Pending_lookup (Pending, i, j) ;
+        if (p < 0)
+        { 
+            // Entry not found.
+            return (GrB_NO_VALUE) ;
+        }
+        // typecast the pending value to the type of A, as GB_Matrix_wait
+        // would do, and then to the type of x
+        size_t asize = A->type->size ;
+        GB_void *px = ((GB_void *) Pending->x) + (p * Pending->size) ;
+        GB_void aij [GB_VLA(asize)] ;
+        if (Pending->type != A->type)
+        { 
+            GB_cast_array (aij, acode, px, Pending->type->code, NULL,
+                Pending->size, 1, 1) ;
+            px = aij ;
+        }
+        GB_cast_array ((GB_void *) x, GB_XCODE, px, acode, NULL, asize, 1, 1) ;
+        return (GrB_SUCCESS) ;
+    }
     else
     { 
         // Entry not found.
@@ -39,7 +39,10 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry from S
         GrB_Info info ;
         GB_WHERE1 (GB_WHERE_STRING) ;
         GB_BURBLE_START ("GxB_Scalar_extractElement") ;
-        GB_OK (GB_Matrix_wait ((GrB_Matrix) S, "s", Context)) ;
+        GB_thread_budget_begin ( ) ;
+        info = GB_Matrix_wait ((GrB_Matrix) S, "s", Context) ;
+        GB_thread_budget_end ( ) ;
+        GB_OK (info) ;
         GB_BURBLE_END ;
     }
 
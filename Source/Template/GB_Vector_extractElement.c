@@ -16,7 +16,9 @@
 // This template constructs GrB_Vector_extractElement_[TYPE], for each of the
 // 13 built-in types, and the _UDT method for all user-defined types.
 
-// FUTURE: tolerate zombies
+// Zombies are tolerated, and V(i) is found in the list of pending tuples
+// without assembling them, if the list can be searched quickly (see
+// GB_Pending_searchable).
 
 GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
 (
@@ -33,17 +35,24 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     GB_RETURN_IF_NULL_OR_FAULTY (V) ;
     GB_RETURN_IF_NULL (x) ;
 
-    // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (GB_ANY_PENDING_WORK (V))
+    // unjumble the vector, and assemble any pending tuples if they cannot be
+    // searched quickly.  Zombies are left in the vector.
+    if (V->jumbled || GB_DEFERRED (V) ||
+        !GB_Pending_searchable ((GrB_Matrix) V))
     { 
         GrB_Info info ;
         GB_WHERE1 (GB_WHERE_STRING) ;
         GB_BURBLE_START ("GrB_Vector_extractElement") ;
-        GB_OK (GB_Matrix_wait ((GrB_Matrix) V, "v", Context)) ;
+        GB_thread_budget_begin ( ) ;
+        info = GB_Matrix_wait ((GrB_Matrix) V, "v", Context) ;
+        GB_thread_budget_end ( ) ;
+        GB_OK (info) ;
         GB_BURBLE_END ;
     }
 
-    ASSERT (!GB_ANY_PENDING_WORK (V)) ;
+    ASSERT (GB_ZOMBIES_OK (V)) ;
+    ASSERT (!GB_JUMBLED (V)) ;
+    ASSERT (GB_PENDING_OK (V)) ;
 
     // check index
     if (i >= V->vlen)
@@ -58,7 +67,7 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
         return (GrB_DOMAIN_MISMATCH) ;
     }
 
-    if (V->nzmax == 0)
+    if (V->nzmax == 0 && !GB_PENDING (V))
     { 
         // quick return
         return (GrB_NO_VALUE) ;
@@ -69,10 +78,15 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     //--------------------------------------------------------------------------
 
     int64_t pleft ;
-    bool found ;
+    bool found = false, is_zombie = false ;
     const int64_t *restrict Vp = V->p ;
 
-    if (Vp != NULL)
+    if (V->nzmax == 0)
+    { 
+        // V has no entries, only pending tuples
+        found = false ;
+    }
+    else if (Vp != NULL)
     { 
         // V is sparse
         const int64_t *restrict Vi = V->i ;
@@ -82,7 +96,8 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
 
         // binary search for index i
         // Time taken for this step is at most O(log(nnz(V))).
-        GB_BINARY_SEARCH (i, Vi, pleft, pright, found) ;
+        GB_BINARY_SEARCH_ZOMBIE (i, Vi, pleft, pright, found, V->nzombies,
+            is_zombie) ;
     }
     else
     {
@@ -105,7 +120,12 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     // extract the element
     //--------------------------------------------------------------------------
 
-    if (found)
+    if (found && is_zombie)
+    { 
+        // V(i) has been deleted.  It cannot also be a pending tuple.
+        return (GrB_NO_VALUE) ;
+    }
+    else if (found)
     {
         #if !defined ( GB_UDT_EXTRACT )
         if (GB_XCODE == vcode)
@@ -125,6 +145,30 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
         }
         return (GrB_SUCCESS) ;
     }
+    else if (GB_PENDING (V))
+    {
+        // look for V(i) in the list of pending tuples
+        GB_Pending Pending = V->Pending ;
+        int64_t p = GB_Pending_lookup (Pending, i, 0) ;
+        if (p < 0)
+        { 
+            // Entry not found.
+            return (GrB_NO_VALUE) ;
+        }
+        // typecast the pending value to the type of V, as GB_Matrix_wait
+        // would do, and then to the type of x
+        size_t vsize = V->type->size ;
+        GB_void *px = ((GB_void *) Pending->x) + (p * Pending->size) ;
+        GB_void vi [GB_VLA(vsize)] ;
+        if (Pending->type != V->type)
+        { 
+            GB_cast_array (vi, vcode, px, Pending->type->code, NULL,
+                Pending->size, 1, 1) ;
+            px = vi ;
+        }
+        GB_cast_array ((GB_void *) x, GB_XCODE, px, vcode, NULL, vsize, 1, 1) ;
+        return (GrB_SUCCESS) ;
+    }
     else
     { 
         // Entry not found.
@@ -12,16 +12,16 @@
 // in-place if the accum operator is the same as the monoid.
 
 #undef  GB_FREE_ALL
-#define GB_FREE_ALL                         \
-{                                           \
-    GB_FREE_WERK (&Wf, Wf_size) ;           \
-    GB_FREE_WERK (&Wax, Wax_size) ;         \
-    GB_FREE_WERK (&Wbx, Wbx_size) ;         \
-    GB_FREE_WERK (&Wcx, Wcx_size) ;         \
-    GB_WERK_POP (GH_slice, int64_t) ;       \
-    GB_WERK_POP (A_slice, int64_t) ;        \
-    GB_WERK_POP (B_slice, int64_t) ;        \
-    GB_WERK_POP (M_ek_slicing, int64_t) ;   \
+#define GB_FREE_ALL                            \
+{                                              \
+    GB_FREE_WERK (&Wf, Wf_size, Context) ;     \
+    GB_FREE_WERK (&Wax, Wax_size, Context) ;   \
+    GB_FREE_WERK (&Wbx, Wbx_size, Context) ;   \
+    GB_FREE_WERK (&Wcx, Wcx_size, Context) ;   \
+    GB_WERK_POP (GH_slice, int64_t) ;          \
+    GB_WERK_POP (A_slice, int64_t) ;           \
+    GB_WERK_POP (B_slice, int64_t) ;           \
+    GB_WERK_POP (M_ek_slicing, int64_t) ;      \
 }
 
 {
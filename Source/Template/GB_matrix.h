@@ -419,6 +419,50 @@ float bitmap_switch ;   // controls conversion sparse to/from bitmap
 int sparsity ;          // controls sparsity structure: hypersparse,
                         // sparse, bitmap, or full, or any combination.
 
+// (3) GB_conform damps the conversions of a matrix whose number of entries or
+//      non-empty vectors hovers near one of the thresholds in (2).  Each time
+//      GB_conform converts the matrix from one structure allowed by
+//      A->sparsity to another, A->conform_damping is incremented, up to
+//      GB_CONFORM_DAMPING_MAX.  This widens both hysteresis bands of (2) by a
+//      factor of 2^A->conform_damping: the thresholds for converting
+//      hypersparse to sparse and sparse to bitmap are multiplied by it, and
+//      the thresholds for converting sparse to hypersparse and bitmap to
+//      sparse are divided by it.  After GB_CONFORM_DECAY calls to GB_conform
+//      that leave the structure unchanged, the damping is decremented.
+//      Conversions forced by A->sparsity are not damped.
+
+int conform_damping ;   // damping of the hysteresis bands, 0 to
+                        // GB_CONFORM_DAMPING_MAX
+int conform_stable ;    // # of calls to GB_conform since the last change
+                        // to A->conform_damping
+
+// The number of conversions GB_conform has made to this matrix, and the time
+// they took, are kept in A->stats (see GB_stats.h), and returned by
+// GxB_Matrix_Option_get with GxB_CONFORM_COUNT and GxB_CONFORM_TIME.
+
+//------------------------------------------------------------------------------
+// instrumentation
+//------------------------------------------------------------------------------
+
+// If enabled by GxB_set (A, GxB_STATS, true), A->stats holds counters of the
+// work done on A (see GB_stats.h).  Otherwise A->stats is NULL.  The stats
+// belong to the header of A, not its content: they are kept when the content
+// of A is freed or replaced, and are freed only when A itself is freed.
+
+GB_Stats stats ;        // instrumentation counters, or NULL
+
+//------------------------------------------------------------------------------
+// cached structural summary
+//------------------------------------------------------------------------------
+
+// A->profile caches the vector-degree distribution of A, for the heuristics
+// that select the method used for C=A*B (see GB_profile.h).  It is computed
+// when A is finished by GrB_*_wait, never while A is an input to a method,
+// and is invalidated when the content of A is freed or modified.
+// It is only used for selecting methods, never for correctness.
+
+struct GB_Profile_struct profile ;  // cached vector-degree summary
+
 //------------------------------------------------------------------------------
 // shallow matrices
 //------------------------------------------------------------------------------
@@ -440,6 +484,22 @@ bool i_shallow ;        // true if i is a shallow copy
 bool x_shallow ;        // true if x is a shallow copy
 bool static_header ;    // true if this struct is statically allocated
 
+// A user-visible matrix may also have shallow components if it shares its
+// content with a snapshot (see GB_snapshot.c).  In this case, A->shared holds
+// the content, and A->shared->nshared is the number of matrices that use it.
+// Before A is modified, GB_unshare gives A its own copy of the content.
+
+GB_Shared shared ;      // content shared with snapshots, or NULL
+
+// In GrB_NONBLOCKING mode, C=op(A) with a unary operator may be deferred (see
+// GB_apply.c).  C then shares the content of A, and C->x still holds the
+// values of A, of type deferred_type.  The operator is applied when C is first
+// read or modified (GB_deferred_finish), or fused with the method that reads
+// C.  A matrix with a deferred operator always shares its content.
+
+GrB_UnaryOp deferred_op ;   // unary op not yet applied to A->x, or NULL
+GrB_Type deferred_type ;    // type of the values in A->x, if deferred_op used
+
 //------------------------------------------------------------------------------
 // other bool content
 //------------------------------------------------------------------------------
@@ -11,6 +11,7 @@
 
 #include "GB_mex.h"
 #include "GB_mex_errors.h"
+#include "GB_mxm.h"
 
 #define USAGE "GB_mex_about3"
 
@@ -34,6 +35,38 @@ int myflush (void)
     fflush (stdout) ;
 }
 
+// logprintf appends the burble to burble_log, so that a test can check which
+// method was used
+char burble_log [4096] ;
+
+int logprintf (const char *restrict format, ...) ;
+
+int logprintf (const char *restrict format, ...)
+{
+    size_t len = strlen (burble_log) ;
+    va_list ap ;
+    va_start (ap, format) ;
+    int result = vsnprintf (burble_log + len, sizeof (burble_log) - len,
+        format, ap) ;
+    va_end (ap) ;
+    return (result) ;
+}
+
+// get the # of Gustavson tasks from the burble, "(nthreads %d coarse: %d)"
+int burble_ntasks (void) ;
+
+int burble_ntasks (void)
+{
+    int nthreads = 0, ntasks = 0 ;
+    char *p = strstr (burble_log, "(nthreads ") ;
+    if (p == NULL || sscanf (p, "(nthreads %d coarse: %d)", &nthreads,
+        &ntasks) != 2)
+    {
+        return (-1) ;
+    }
+    return (ntasks) ;
+}
+
 typedef int (* printf_func_t) (const char *restrict format, ...) ;
 typedef int (* flush_func_t)  (void) ;
 
@@ -139,6 +172,901 @@ void mexFunction
     printf ("expected error: [%s]\n", s) ;
     GrB_Vector_free_(&w) ;
 
+    //--------------------------------------------------------------------------
+    // GxB_set/get for the thread budget
+    //--------------------------------------------------------------------------
+
+    int thread_budget = -1 ;
+    OK (GxB_Global_Option_get (GxB_THREAD_BUDGET, &thread_budget)) ;
+    CHECK (thread_budget == 0) ;
+    OK (GxB_Global_Option_set (GxB_THREAD_BUDGET, 2)) ;
+    OK (GxB_Global_Option_get (GxB_THREAD_BUDGET, &thread_budget)) ;
+    CHECK (thread_budget == 2) ;
+
+    // T = A*A with the budget in place, where A = 2*I
+    GrB_Matrix A = NULL, T = NULL ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&T, GrB_FP64, 100, 100)) ;
+    for (int k = 0 ; k < 100 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, 2, k, k)) ;
+    }
+    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A, NULL)) ;
+    GrB_Index nvals_T ;
+    OK (GrB_Matrix_nvals (&nvals_T, T)) ;
+    CHECK (nvals_T == 100) ;
+    for (int k = 0 ; k < 100 ; k++)
+    {
+        double t = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&t, T, k, k)) ;
+        CHECK (t == 4) ;
+    }
+    // all leases have been returned
+    CHECK (GB_Global_threads_leased_get ( ) == 0) ;
+
+    // the lease is taken once per operation, and a later step or a nested
+    // task that asks for fewer threads does not shrink it
+    GB_thread_budget_begin ( ) ;
+    CHECK (GB_thread_budget_acquire (4) == 2) ;
+    CHECK (GB_Global_threads_leased_get ( ) == 2) ;
+    GB_thread_budget_begin ( ) ;
+    CHECK (GB_thread_budget_acquire (1) == 1) ;
+    GB_thread_budget_end ( ) ;
+    CHECK (GB_Global_threads_leased_get ( ) == 2) ;
+    CHECK (GB_thread_budget_acquire (8) == 2) ;
+    GB_thread_budget_end ( ) ;
+    CHECK (GB_Global_threads_leased_get ( ) == 0) ;
+
+    // an error inside the bracket returns the lease too: A is not full
+    GrB_Type type_A = NULL ;
+    GrB_Index nrows_A = 0, ncols_A = 0, Afull_size = 0 ;
+    void *Afull = NULL ;
+    bool uniform_A = false ;
+    info = GxB_Matrix_export_FullC (&A, &type_A, &nrows_A, &ncols_A, &Afull,
+        &Afull_size, &uniform_A, NULL) ;
+    CHECK (info == GrB_INVALID_VALUE && A != NULL && Afull == NULL) ;
+    CHECK (GB_Global_threads_leased_get ( ) == 0) ;
+    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A, NULL)) ;
+    CHECK (GB_Global_threads_leased_get ( ) == 0) ;
+    GrB_Matrix_free_(&A) ;
+    GrB_Matrix_free_(&T) ;
+
+    // a negative budget is the same as no budget
+    OK (GxB_Global_Option_set (GxB_THREAD_BUDGET, -1)) ;
+    OK (GxB_Global_Option_get (GxB_THREAD_BUDGET, &thread_budget)) ;
+    CHECK (thread_budget == 0) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_set/get for load balancing
+    //--------------------------------------------------------------------------
+
+    GxB_Load_Balance_Value load_balance = -1 ;
+    OK (GxB_Global_Option_get (GxB_LOAD_BALANCE, &load_balance)) ;
+    CHECK (load_balance == GxB_LOAD_BALANCE_STATIC) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Global_Option_set (GxB_LOAD_BALANCE, 42)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Global_Option_get (GxB_LOAD_BALANCE, NULL)) ;
+
+    // T = A*A and T<A> = A*A with dynamic load balancing and 4 threads,
+    // where A is tridiagonal
+    OK (GxB_Global_Option_set (GxB_LOAD_BALANCE, GxB_LOAD_BALANCE_DYNAMIC)) ;
+    OK (GxB_Global_Option_get (GxB_LOAD_BALANCE, &load_balance)) ;
+    CHECK (load_balance == GxB_LOAD_BALANCE_DYNAMIC) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, 1000, 1000)) ;
+    OK (GrB_Matrix_new (&T, GrB_FP64, 1000, 1000)) ;
+    for (int k = 0 ; k < 1000 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, 1, k, k)) ;
+        if (k > 0) OK (GrB_Matrix_setElement_FP64 (A, 1, k, k-1)) ;
+        if (k < 999) OK (GrB_Matrix_setElement_FP64 (A, 1, k, k+1)) ;
+    }
+    GrB_Descriptor desc_dyn = NULL ;
+    OK (GrB_Descriptor_new (&desc_dyn)) ;
+    OK (GxB_Desc_set (desc_dyn, GxB_DESCRIPTOR_NTHREADS, 4)) ;
+    OK (GxB_Desc_set (desc_dyn, GxB_DESCRIPTOR_CHUNK, (double) 1)) ;
+    for (int masked = 0 ; masked <= 1 ; masked++)
+    {
+        OK (GrB_Matrix_clear (T)) ;
+        OK (GrB_mxm (T, masked ? A : NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+            A, A, desc_dyn)) ;
+        OK (GrB_Matrix_nvals (&nvals_T, T)) ;
+        CHECK (nvals_T == (masked ? 2998 : 4994)) ;
+        for (int k = 1 ; k < 999 ; k++)
+        {
+            double t = 0 ;
+            OK (GrB_Matrix_extractElement_FP64 (&t, T, k, k)) ;
+            CHECK (t == 3) ;
+        }
+    }
+    GrB_Descriptor_free_(&desc_dyn) ;
+    GrB_Matrix_free_(&A) ;
+    GrB_Matrix_free_(&T) ;
+    OK (GxB_Global_Option_set (GxB_LOAD_BALANCE, GxB_LOAD_BALANCE_STATIC)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_set/get for NUMA placement
+    //--------------------------------------------------------------------------
+
+    GxB_NUMA_Policy_Value numa_policy = -1 ;
+    OK (GxB_Global_Option_get (GxB_NUMA_POLICY, &numa_policy)) ;
+    CHECK (numa_policy == GxB_NUMA_DEFAULT) ;
+    int nnodes = 0 ;
+    OK (GxB_Global_Option_get (GxB_NUMA_NODES, &nnodes)) ;
+    CHECK (nnodes >= 1) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Global_Option_set (GxB_NUMA_POLICY, 42)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Global_Option_get (GxB_NUMA_POLICY, NULL)) ;
+    ERR (GxB_Global_Option_get (GxB_NUMA_NODES, NULL)) ;
+
+    // T = A+A with each policy, where A is a large dense vector, so that
+    // its values are placed
+    for (int policy = GxB_NUMA_FIRST_TOUCH ; policy <= GxB_NUMA_INTERLEAVE ;
+        policy++)
+    {
+        OK (GxB_Global_Option_set (GxB_NUMA_POLICY, policy)) ;
+        OK (GxB_Global_Option_get (GxB_NUMA_POLICY, &numa_policy)) ;
+        CHECK (numa_policy == policy) ;
+        GrB_Vector v = NULL, w = NULL ;
+        OK (GrB_Vector_new (&v, GrB_FP64, 1000000)) ;
+        OK (GrB_Vector_new (&w, GrB_FP64, 1000000)) ;
+        OK (GrB_Vector_assign_FP64 (v, NULL, NULL, 1, GrB_ALL, 1000000,
+            NULL)) ;
+        OK (GrB_Vector_eWiseAdd_BinaryOp (w, NULL, NULL, GrB_PLUS_FP64, v, v,
+            NULL)) ;
+        double s = 0 ;
+        OK (GrB_Vector_reduce_FP64 (&s, NULL, GrB_PLUS_MONOID_FP64, w,
+            NULL)) ;
+        CHECK (s == 2000000) ;
+        GrB_Vector_free_(&v) ;
+        GrB_Vector_free_(&w) ;
+    }
+    OK (GxB_Global_Option_set (GxB_NUMA_POLICY, GxB_NUMA_DEFAULT)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_set/get for huge pages
+    //--------------------------------------------------------------------------
+
+    int64_t huge_page = -1 ;
+    OK (GxB_Global_Option_get (GxB_HUGE_PAGE, &huge_page)) ;
+    CHECK (huge_page == 0) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Global_Option_get (GxB_HUGE_PAGE, NULL)) ;
+
+    // a size less than 2 MB is treated as 2 MB
+    OK (GxB_Global_Option_set (GxB_HUGE_PAGE, (int64_t) 1)) ;
+    OK (GxB_Global_Option_get (GxB_HUGE_PAGE, &huge_page)) ;
+    CHECK (huge_page == 2 * 1024 * 1024) ;
+
+    // T = A+A where A is a dense vector of 8 MB, backed with huge pages
+    GrB_Vector v = NULL ;
+    OK (GrB_Vector_new (&v, GrB_FP64, 1000000)) ;
+    OK (GrB_Vector_new (&w, GrB_FP64, 1000000)) ;
+    OK (GrB_Vector_assign_FP64 (v, NULL, NULL, 1, GrB_ALL, 1000000, NULL)) ;
+    OK (GrB_Vector_eWiseAdd_BinaryOp (w, NULL, NULL, GrB_PLUS_FP64, v, v,
+        NULL)) ;
+    double sum = 0 ;
+    OK (GrB_Vector_reduce_FP64 (&sum, NULL, GrB_PLUS_MONOID_FP64, w, NULL)) ;
+    CHECK (sum == 2000000) ;
+    GrB_Vector_free_(&v) ;
+    GrB_Vector_free_(&w) ;
+    OK (GxB_Global_Option_set (GxB_HUGE_PAGE, (int64_t) 0)) ;
+    OK (GxB_Global_Option_get (GxB_HUGE_PAGE, &huge_page)) ;
+    CHECK (huge_page == 0) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_set/get for the memory budget
+    //--------------------------------------------------------------------------
+
+    int64_t memory_budget = -1 ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_BUDGET, &memory_budget)) ;
+    CHECK (memory_budget == 0) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Global_Option_get (GxB_MEMORY_BUDGET, NULL)) ;
+
+    // T = A*A where A is tridiagonal.  The Gustavson workspace of each of
+    // the 8 coarse tasks for 4 threads is 1000 * 16 bytes.
+    OK (GrB_Matrix_new (&A, GrB_FP64, 1000, 1000)) ;
+    OK (GrB_Matrix_new (&T, GrB_FP64, 1000, 1000)) ;
+    for (int k = 0 ; k < 1000 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, 1, k, k)) ;
+        if (k > 0) OK (GrB_Matrix_setElement_FP64 (A, 1, k, k-1)) ;
+        if (k < 999) OK (GrB_Matrix_setElement_FP64 (A, 1, k, k+1)) ;
+    }
+    OK (GrB_Matrix_wait (&A)) ;
+    GrB_Descriptor desc_budget = NULL ;
+    OK (GrB_Descriptor_new (&desc_budget)) ;
+    OK (GxB_Desc_set (desc_budget, GxB_DESCRIPTOR_NTHREADS, 4)) ;
+    OK (GxB_Desc_set (desc_budget, GxB_DESCRIPTOR_CHUNK, (double) 1)) ;
+    OK (GxB_Desc_set (desc_budget, GxB_AxB_METHOD, GxB_AxB_GUSTAVSON)) ;
+    OK (GxB_Global_Option_set (GxB_PRINTF, logprintf)) ;
+    OK (GxB_Global_Option_set (GxB_BURBLE, true)) ;
+    double sum0 = 0 ;
+
+    // with no budget, Gustavson uses 8 coarse tasks
+    burble_log [0] = '\0' ;
+    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+        desc_budget)) ;
+    CHECK (strstr (burble_log, "(budget:") == NULL) ;
+    int ntasks0 = burble_ntasks ( ) ;
+    CHECK (ntasks0 == 8) ;
+    OK (GrB_Matrix_nvals (&nvals_T, T)) ;
+    CHECK (nvals_T == 4994) ;
+    OK (GrB_Matrix_reduce_FP64 (&sum0, NULL, GrB_PLUS_MONOID_FP64, T, NULL)) ;
+
+    // a budget of 256 KB only fits the Gustavson workspace of 7 tasks
+    OK (GxB_Global_Option_set (GxB_MEMORY_BUDGET, (int64_t) 256000)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_BUDGET, &memory_budget)) ;
+    CHECK (memory_budget == 256000) ;
+    burble_log [0] = '\0' ;
+    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+        desc_budget)) ;
+    int ntasks = -1 ;
+    char *p = strstr (burble_log, "(budget: ") ;
+    CHECK (p != NULL && sscanf (p, "(budget: %d tasks)", &ntasks) == 1) ;
+    CHECK (ntasks >= 1 && ntasks < ntasks0) ;
+    CHECK (burble_ntasks ( ) == ntasks) ;
+    OK (GrB_Matrix_nvals (&nvals_T, T)) ;
+    CHECK (nvals_T == 4994) ;
+    OK (GrB_Matrix_reduce_FP64 (&sum, NULL, GrB_PLUS_MONOID_FP64, T, NULL)) ;
+    CHECK (sum == sum0) ;
+
+    // a budget of 64 KB is too small for Gustavson, so the default method
+    // switches to hash
+    OK (GxB_Desc_set (desc_budget, GxB_AxB_METHOD, GxB_DEFAULT)) ;
+    OK (GxB_Global_Option_set (GxB_MEMORY_BUDGET, (int64_t) 64000)) ;
+    burble_log [0] = '\0' ;
+    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+        desc_budget)) ;
+    CHECK (strstr (burble_log, "(budget: hash)") != NULL) ;
+    OK (GrB_Matrix_nvals (&nvals_T, T)) ;
+    CHECK (nvals_T == 4994) ;
+    OK (GrB_Matrix_reduce_FP64 (&sum, NULL, GrB_PLUS_MONOID_FP64, T, NULL)) ;
+    CHECK (sum == sum0) ;
+
+    // a budget of 1000 bytes is too small for either method
+    OK (GxB_Global_Option_set (GxB_MEMORY_BUDGET, (int64_t) 1000)) ;
+    expected = GrB_OUT_OF_MEMORY ;
+    ERR (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+        desc_budget)) ;
+    OK (GxB_Desc_set (desc_budget, GxB_AxB_METHOD, GxB_AxB_GUSTAVSON)) ;
+    ERR (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+        desc_budget)) ;
+
+    OK (GxB_Global_Option_set (GxB_BURBLE, false)) ;
+    OK (GxB_Global_Option_set (GxB_PRINTF, myprintf)) ;
+    OK (GxB_Global_Option_set (GxB_MEMORY_BUDGET, (int64_t) 0)) ;
+    GrB_Descriptor_free_(&desc_budget) ;
+    GrB_Matrix_free_(&A) ;
+    GrB_Matrix_free_(&T) ;
+
+    //--------------------------------------------------------------------------
+    // in-place merge of pending tuples and zombies in GB_Matrix_wait
+    //--------------------------------------------------------------------------
+
+    // A has 4 entries in each column (every third column if A is
+    // hypersparse).  In a few of those columns, and in column 100, entries
+    // are deleted (zombies), revived, and added (pending tuples with
+    // duplicates, assembled with an implicit SECOND, and then with PLUS).
+    // Since the pending tuples are few, they are merged into A in place.
+    // After each wait, A must be the same as the matrix T built from scratch
+    // with the same entries.
+
+    GrB_Index Jmerge [4] = { 0, 3, 99, 198 } ;
+    for (int hyper = 0 ; hyper <= 1 ; hyper++)
+    {
+        int sparsity = hyper ? GxB_HYPERSPARSE : GxB_SPARSE ;
+        int jstep = hyper ? 3 : 1 ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, 200, 200)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+        for (int64_t j = 0 ; j < 200 ; j += jstep)
+        {
+            for (int64_t i = j % 7 ; i < 200 ; i += 50)
+            {
+                OK (GrB_Matrix_setElement_FP64 (A, (double) (i+j), i, j)) ;
+            }
+        }
+        OK (GrB_Matrix_wait (&A)) ;
+
+        for (int round = 1 ; round <= 2 ; round++)
+        {
+            // delete A(r+50,j) in round 1, and A(r+100,j) in round 2
+            for (int k = 0 ; k < 4 ; k++)
+            {
+                GrB_Index j = Jmerge [k], r = j % 7 ;
+                OK (GrB_Matrix_removeElement (A, r + 50 * round, j)) ;
+            }
+            if (round == 1)
+            {
+                // A(r+1,j) = 5 and then 7, and revive A(r+50,99) as 3
+                for (int k = 0 ; k < 4 ; k++)
+                {
+                    GrB_Index j = Jmerge [k], r = j % 7 ;
+                    OK (GrB_Matrix_setElement_FP64 (A, 5, r + 1, j)) ;
+                    OK (GrB_Matrix_setElement_FP64 (A, 7, r + 1, j)) ;
+                }
+                OK (GrB_Matrix_setElement_FP64 (A, 3, 99 % 7 + 50, 99)) ;
+                OK (GrB_Matrix_setElement_FP64 (A, 1, 5, 100)) ;
+                OK (GrB_Matrix_setElement_FP64 (A, 2, 5, 100)) ;
+                CHECK (A->Pending->n == 10 && A->Pending->op == NULL) ;
+            }
+            else
+            {
+                // A(r+2,j) += 2, twice
+                for (int k = 0 ; k < 8 ; k++)
+                {
+                    GrB_Index j = Jmerge [k % 4], r = j % 7 + 2 ;
+                    OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64, 2,
+                        &r, 1, &j, 1, NULL)) ;
+                }
+                GrB_Index i6 = 6, j100 = 100 ;
+                OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64, 2,
+                    &i6, 1, &j100, 1, NULL)) ;
+                OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64, 2,
+                    &i6, 1, &j100, 1, NULL)) ;
+                CHECK (A->Pending->n == 10 && A->Pending->op == GrB_PLUS_FP64) ;
+            }
+            CHECK (A->nzombies == ((round == 1) ? 3 : 4)) ;
+            OK (GrB_Matrix_wait (&A)) ;
+
+            // T = the same entries as A, built from scratch
+            OK (GrB_Matrix_new (&T, GrB_FP64, 200, 200)) ;
+            OK (GxB_Matrix_Option_set (T, GxB_SPARSITY_CONTROL, sparsity)) ;
+            for (int64_t j = 0 ; j < 200 ; j += jstep)
+            {
+                bool touched = (j == 0 || j == 3 || j == 99 || j == 198) ;
+                int64_t r = j % 7 ;
+                for (int64_t i = r ; i < 200 ; i += 50)
+                {
+                    double t = (double) (i+j) ;
+                    if (touched && i == r + 50) t = (j == 99) ? 3 : -1 ;
+                    if (touched && i == r + 100 && round == 2) t = -1 ;
+                    if (t >= 0) OK (GrB_Matrix_setElement_FP64 (T, t, i, j)) ;
+                }
+                if (touched)
+                {
+                    OK (GrB_Matrix_setElement_FP64 (T, 7, r + 1, j)) ;
+                    if (round == 2)
+                    {
+                        OK (GrB_Matrix_setElement_FP64 (T, 4, r + 2, j)) ;
+                    }
+                }
+            }
+            OK (GrB_Matrix_setElement_FP64 (T, 2, 5, 100)) ;
+            if (round == 2) OK (GrB_Matrix_setElement_FP64 (T, 4, 6, 100)) ;
+            OK (GrB_Matrix_wait (&T)) ;
+            CHECK (GB_mx_isequal (A, T, 0)) ;
+            GrB_Matrix_free_(&T) ;
+        }
+        GrB_Matrix_free_(&A) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // extractElement through zombies and pending tuples
+    //--------------------------------------------------------------------------
+
+    // A(i,j) is read from the pending tuples, typecast, without assembling
+    // them, if they have no operator.  With a pending PLUS operator, A is
+    // assembled first.
+
+    for (int is_vector = 0 ; is_vector <= 1 ; is_vector++)
+    {
+        GrB_Index ncols = is_vector ? 1 : 10 ;
+        GrB_Index jcol = is_vector ? 0 : 4 ;
+        int32_t i32 = 0 ;
+        int8_t i8 = 0 ;
+        double xd = 0 ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, 100, ncols)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        for (int64_t i = 0 ; i < 100 ; i += 2)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, 0.5 + i, i, jcol)) ;
+        }
+        OK (GrB_Matrix_wait (&A)) ;
+
+        // a zombie, and pending tuples of type int32, with a duplicate
+        OK (GrB_Matrix_removeElement (A, 10, jcol)) ;
+        OK (GrB_Matrix_setElement_INT32 (A, 3, 11, jcol)) ;
+        OK (GrB_Matrix_setElement_INT32 (A, -9, 13, jcol)) ;
+        OK (GrB_Matrix_setElement_INT32 (A, 9, 13, jcol)) ;
+        CHECK (A->nzombies == 1) ;
+        CHECK (A->Pending->n == 3 && A->Pending->type == GrB_INT32) ;
+        CHECK (A->Pending->op == NULL) ;
+
+        #define EXTRACT(x,type,i)                                             \
+            (is_vector ?                                                      \
+            GrB_Vector_extractElement_ ## type (x, (GrB_Vector) A, i) :       \
+            GrB_Matrix_extractElement_ ## type (x, A, i, jcol))
+
+        expected = GrB_NO_VALUE ;
+        ERR (EXTRACT (&xd, FP64, 10)) ;
+        ERR (EXTRACT (&xd, FP64, 15)) ;
+        OK (EXTRACT (&xd, FP64, 11)) ;
+        CHECK (xd == 3) ;
+        OK (EXTRACT (&i8, INT8, 13)) ;
+        CHECK (i8 == 9) ;
+        OK (EXTRACT (&i32, INT32, 12)) ;
+        CHECK (i32 == 12) ;
+        OK (EXTRACT (&xd, FP64, 12)) ;
+        CHECK (xd == 12.5) ;
+        // the pending tuples have not been assembled
+        CHECK (A->nzombies == 1 && A->Pending->n == 3) ;
+
+        // A(15,jcol) += 2.5 and += 1.25, with a pending PLUS operator
+        OK (GrB_Matrix_wait (&A)) ;
+        GrB_Index i15 = 15 ;
+        for (int trial = 0 ; trial < 2 ; trial++)
+        {
+            OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64,
+                trial ? 1.25 : 2.5, &i15, 1, &jcol, 1, NULL)) ;
+        }
+        CHECK (A->Pending->n == 2 && A->Pending->op == GrB_PLUS_FP64) ;
+        OK (EXTRACT (&i32, INT32, 15)) ;
+        CHECK (i32 == 3) ;
+        CHECK (!GB_PENDING (A)) ;
+        OK (EXTRACT (&xd, FP64, 15)) ;
+        CHECK (xd == 3.75) ;
+        #undef EXTRACT
+        GrB_Matrix_free_(&A) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // damping of sparsity conversions
+    //--------------------------------------------------------------------------
+
+    // A alternates between 465 and 3240 entries, either side of the sparse to
+    // bitmap threshold of 0.2*100*100 = 2000.  Without damping, A would be
+    // converted to bitmap each time it has 3240 entries; with it, the band
+    // is widened after the first conversion, and A stays sparse.
+
+    {
+        GrB_Matrix Big = NULL ;
+        GxB_Scalar thunk = NULL ;
+        OK (GrB_Matrix_new (&Big, GrB_FP64, 100, 100)) ;
+        OK (GxB_Matrix_Option_set (Big, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        OK (GrB_Matrix_assign_FP64 (Big, NULL, NULL, 1, GrB_ALL, 100,
+            GrB_ALL, 100, NULL)) ;
+        OK (GrB_Matrix_wait (&Big)) ;
+        OK (GxB_Scalar_new (&thunk, GrB_INT64)) ;
+        OK (GxB_Scalar_setElement_INT64 (thunk, -70)) ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+            GxB_SPARSE + GxB_BITMAP)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_BITMAP_SWITCH, 0.2)) ;
+
+        // the counters are not available if GxB_STATS is off
+        int64_t nconform = -1 ;
+        double conform_time = -1 ;
+        OK (GxB_Matrix_select (A, NULL, NULL, GxB_TRIL, Big, thunk, NULL)) ;
+        info = GxB_Matrix_Option_get (A, GxB_CONFORM_COUNT, &nconform) ;
+        CHECK (info == GrB_NO_VALUE && nconform == -1) ;
+        info = GxB_Matrix_Option_get (A, GxB_CONFORM_TIME, &conform_time) ;
+        CHECK (info == GrB_NO_VALUE && conform_time == -1) ;
+
+        OK (GxB_Matrix_Option_set (A, GxB_STATS, true)) ;
+        int nbig = 0 ;
+        for (int trial = 0 ; trial < 20 ; trial++)
+        {
+            bool big = (trial % 2 == 0) ;
+            nbig += big ;
+            OK (GxB_Scalar_setElement_INT64 (thunk, big ? -20 : -70)) ;
+            OK (GxB_Matrix_select (A, NULL, NULL, GxB_TRIL, Big, thunk,
+                NULL)) ;
+            OK (GrB_Matrix_nvals (&nvals, A)) ;
+            CHECK (nvals == (big ? 3240 : 465)) ;
+        }
+
+        double stats [GxB_NSTATS] ;
+        OK (GxB_Matrix_Option_get (A, GxB_CONFORM_COUNT, &nconform)) ;
+        OK (GxB_Matrix_Option_get (A, GxB_CONFORM_TIME, &conform_time)) ;
+        OK (GxB_Matrix_Option_get (A, GxB_STATS, stats)) ;
+        printf ("conversions: %g of %d\n", (double) nconform, nbig) ;
+        CHECK (nconform >= 1 && nconform < nbig / 2) ;
+        CHECK (nconform == stats [GxB_STATS_TO_BITMAP]
+            + stats [GxB_STATS_TO_SPARSE]) ;
+        CHECK (conform_time >= 0
+            && conform_time == stats [GxB_STATS_CONFORM_TIME]) ;
+
+        GrB_Matrix_free_(&A) ;
+        GrB_Matrix_free_(&Big) ;
+        GxB_Scalar_free_(&thunk) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // instrumentation counters
+    //--------------------------------------------------------------------------
+
+    {
+        double stats [GxB_NSTATS] ;
+        GrB_Matrix B = NULL, AtB = NULL ;
+        GrB_Descriptor desc = NULL ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, 100, 100)) ;
+        OK (GrB_Matrix_new (&AtB, GrB_FP64, 100, 100)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        for (int64_t k = 0 ; k < 100 ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, 1, k, (k * 7) % 100)) ;
+            OK (GrB_Matrix_setElement_FP64 (B, 2, (k * 3) % 100, k)) ;
+        }
+        OK (GrB_Matrix_wait (&A)) ;
+        OK (GrB_Matrix_wait (&B)) ;
+
+        // all zero if off, and cleared when turned on
+        OK (GxB_Matrix_Option_get (A, GxB_STATS, stats)) ;
+        for (int k = 0 ; k < GxB_NSTATS ; k++) CHECK (stats [k] == 0) ;
+        OK (GxB_Matrix_Option_set (A, GxB_STATS, true)) ;
+        OK (GxB_Matrix_Option_set (AtB, GxB_STATS, true)) ;
+        OK (GxB_Matrix_Option_get (A, GxB_STATS, stats)) ;
+        for (int k = 0 ; k < GxB_NSTATS ; k++) CHECK (stats [k] == 0) ;
+
+        // wait: 5 pending tuples (one a duplicate) and 2 zombies
+        OK (GrB_Matrix_removeElement (A, 0, 0)) ;
+        OK (GrB_Matrix_removeElement (A, 1, 7)) ;
+        for (int64_t k = 0 ; k < 5 ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, 3, 50, k % 4)) ;
+        }
+        OK (GrB_Matrix_wait (&A)) ;
+        OK (GxB_Matrix_Option_get (A, GxB_STATS, stats)) ;
+        CHECK (stats [GxB_STATS_WAIT] == 1) ;
+        CHECK (stats [GxB_STATS_WAIT_TIME] >= 0) ;
+        CHECK (stats [GxB_STATS_PENDING] == 5) ;
+        CHECK (stats [GxB_STATS_ZOMBIES] == 2) ;
+        CHECK (stats [GxB_STATS_TRANSPOSE] == 0) ;
+        OK (GrB_Matrix_nvals (&nvals, A)) ;
+        CHECK (nvals == 102) ;
+
+        // AtB=A'*B with saxpy: A is transposed explicitly, which is counted
+        // in AtB, not in the input A
+        OK (GrB_Descriptor_new (&desc)) ;
+        OK (GxB_Desc_set (desc, GrB_INP0, GrB_TRAN)) ;
+        OK (GxB_Desc_set (desc, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+        OK (GrB_mxm (AtB, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc)) ;
+        OK (GxB_Matrix_Option_get (A, GxB_STATS, stats)) ;
+        CHECK (stats [GxB_STATS_TRANSPOSE] == 0) ;
+        CHECK (stats [GxB_STATS_WAIT] == 1) ;
+        OK (GxB_Matrix_Option_get (AtB, GxB_STATS, stats)) ;
+        printf ("workspace of AtB=A'*B: %g bytes\n",
+            stats [GxB_STATS_WORKSPACE]) ;
+        CHECK (stats [GxB_STATS_WORKSPACE] > 0) ;
+        CHECK (stats [GxB_STATS_TRANSPOSE] == 1) ;
+
+        // conform: sparse to bitmap, hypersparse, and sparse again
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        OK (GxB_Matrix_Option_get (A, GxB_STATS, stats)) ;
+        CHECK (stats [GxB_STATS_TO_BITMAP] == 1) ;
+        CHECK (stats [GxB_STATS_TO_HYPERSPARSE] == 1) ;
+        CHECK (stats [GxB_STATS_TO_SPARSE] == 1) ;
+        CHECK (stats [GxB_STATS_TO_FULL] == 0) ;
+        CHECK (stats [GxB_STATS_CONFORM_TIME] >= 0) ;
+
+        // to full: B is dense
+        OK (GrB_Matrix_assign_FP64 (B, NULL, NULL, 1, GrB_ALL, 100,
+            GrB_ALL, 100, NULL)) ;
+        OK (GrB_Matrix_wait (&B)) ;
+        OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        OK (GxB_Matrix_Option_set (B, GxB_STATS, true)) ;
+        OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL, GxB_FULL)) ;
+        OK (GxB_Matrix_Option_get (B, GxB_STATS, stats)) ;
+        CHECK (stats [GxB_STATS_TO_FULL] == 1) ;
+
+        // turned off: all zero again
+        OK (GxB_Matrix_Option_set (A, GxB_STATS, false)) ;
+        OK (GxB_Matrix_Option_get (A, GxB_STATS, stats)) ;
+        for (int k = 0 ; k < GxB_NSTATS ; k++) CHECK (stats [k] == 0) ;
+
+        GrB_Matrix_free_(&A) ;
+        GrB_Matrix_free_(&B) ;
+        GrB_Matrix_free_(&AtB) ;
+        GrB_Descriptor_free_(&desc) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // the vector degrees of A select dot2 or saxpy for C=A'*B
+    //--------------------------------------------------------------------------
+
+    // A is 1e6-by-64 with about 100,000 entries: so few per row that A' would
+    // be hypersparse, and about 1563 per column on average.  If the columns
+    // are all about the same length, C=A'*B uses dot2.  If one column holds
+    // nearly all the entries, the median degree of the others is 1, and saxpy
+    // is used instead.  The summary is cached in A by GrB_Matrix_wait, but
+    // not by GB_AxB_dot2_control, for an A that has not been waited on.
+
+    {
+        GrB_Matrix B = NULL, T = NULL ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, 1000000, 4)) ;
+        for (int64_t j = 0 ; j < 4 ; j++)
+        {
+            for (int64_t k = 0 ; k < 10 ; k++)
+            {
+                OK (GrB_Matrix_setElement_FP64 (B, 1, k * 1000 + j, j)) ;
+            }
+        }
+        OK (GrB_Matrix_wait (&B)) ;
+
+        for (int skewed = 0 ; skewed <= 1 ; skewed++)
+        {
+            OK (GrB_Matrix_new (&A, GrB_FP64, 1000000, 64)) ;
+            OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+            if (skewed)
+            {
+                for (int64_t i = 0 ; i < 100000 ; i++)
+                {
+                    OK (GrB_Matrix_setElement_FP64 (A, 1, i * 10, 0)) ;
+                }
+                for (int64_t j = 1 ; j < 64 ; j++)
+                {
+                    OK (GrB_Matrix_setElement_FP64 (A, 1, j, j)) ;
+                }
+            }
+            else
+            {
+                for (int64_t j = 0 ; j < 64 ; j++)
+                {
+                    for (int64_t k = 0 ; k < 1563 ; k++)
+                    {
+                        OK (GrB_Matrix_setElement_FP64 (A, 1, k * 600 + j,
+                            j)) ;
+                    }
+                }
+            }
+            CHECK (!A->profile.valid) ;
+            OK (GrB_Matrix_wait (&A)) ;
+            CHECK (A->profile.valid) ;
+            bool use_dot2 = GB_AxB_dot2_control (A, B, NULL) ;
+            CHECK (use_dot2 == !skewed) ;
+
+            // T = A, with no cached summary: the result is the same
+            OK (GrB_Matrix_new (&T, GrB_FP64, 1000000, 64)) ;
+            OK (GrB_Matrix_extract (T, NULL, NULL, A, GrB_ALL, 1000000,
+                GrB_ALL, 64, NULL)) ;
+            CHECK (!T->profile.valid) ;
+            use_dot2 = GB_AxB_dot2_control (T, B, NULL) ;
+            CHECK (use_dot2 == !skewed) ;
+            CHECK (!T->profile.valid) ;
+
+            GrB_Matrix_free_(&A) ;
+            GrB_Matrix_free_(&T) ;
+        }
+        GrB_Matrix_free_(&B) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // jumbled inputs used as-is
+    //--------------------------------------------------------------------------
+
+    // A is a copy of S with the entries in each column in reverse order.
+    // Each method below that does not need A sorted must leave it jumbled,
+    // and return the same result as it does for S.
+
+    {
+        GrB_Matrix S = NULL, F = NULL, C1 = NULL, C2 = NULL ;
+        GrB_Index n = 20 ;
+        OK (GrB_Matrix_new (&S, GrB_FP64, n, n)) ;
+        OK (GxB_Matrix_Option_set (S, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        for (int64_t k = 0 ; k < 120 ; k++)
+        {
+            double x = (double) (k % 7) - 3 ;
+            OK (GrB_Matrix_setElement_FP64 (S, x, (k * 7) % n, (k * 3) % n)) ;
+        }
+        OK (GrB_Matrix_wait (&S)) ;
+        OK (GrB_Matrix_dup (&A, S)) ;
+        OK (GrB_Matrix_wait (&A)) ;
+        CHECK (GB_IS_SPARSE (A) && A->i != NULL) ;
+        for (int64_t k = 0 ; k < A->nvec ; k++)
+        {
+            for (int64_t p = A->p [k], q = A->p [k+1] - 1 ; p < q ; p++, q--)
+            {
+                int64_t i = A->i [p] ; A->i [p] = A->i [q] ; A->i [q] = i ;
+                double *Ax = (double *) A->x ;
+                double x = Ax [p] ; Ax [p] = Ax [q] ; Ax [q] = x ;
+            }
+        }
+        A->jumbled = true ;
+        OK (GxB_Matrix_fprint (A, "A jumbled", GxB_SILENT, NULL)) ;
+
+        OK (GrB_Matrix_new (&F, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_assign_FP64 (F, NULL, NULL, 2, GrB_ALL, n, GrB_ALL, n,
+            NULL)) ;
+        OK (GrB_Matrix_wait (&F)) ;
+        CHECK (GB_IS_FULL (F)) ;
+
+        // compare the result of method(A) and method(S)
+        #define JUMBLED_CHECK(method)                                       \
+        {                                                                   \
+            OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;                     \
+            OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;                     \
+            OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_BITMAP));\
+            OK (GxB_Matrix_Option_set (C2, GxB_SPARSITY_CONTROL, GxB_BITMAP));\
+            { GrB_Matrix C = C1, X = A ; OK (method) ; }                    \
+            { GrB_Matrix C = C2, X = S ; OK (method) ; }                    \
+            CHECK (A->jumbled) ;                                            \
+            OK (GrB_Matrix_wait (&C1)) ;                                    \
+            OK (GrB_Matrix_wait (&C2)) ;                                    \
+            CHECK (GB_mx_isequal (C1, C2, 0)) ;                             \
+            GrB_Matrix_free_(&C1) ;                                         \
+            GrB_Matrix_free_(&C2) ;                                         \
+        }
+
+        // select with a value selector
+        JUMBLED_CHECK (GxB_Matrix_select (C, NULL, NULL, GxB_GT_ZERO, X,
+            NULL, NULL)) ;
+        // eWiseAdd with a bitmap result
+        JUMBLED_CHECK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL,
+            GrB_PLUS_FP64, X, F, NULL)) ;
+        // a jumbled mask, with a bitmap result
+        JUMBLED_CHECK (GrB_Matrix_assign (C, X, NULL, F, GrB_ALL, n, GrB_ALL,
+            n, NULL)) ;
+        // dot2 with a full operand: C=X'*F and C=F'*X
+        JUMBLED_CHECK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+            X, F, GrB_DESC_T0)) ;
+        JUMBLED_CHECK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+            F, X, GrB_DESC_T0)) ;
+        #undef JUMBLED_CHECK
+
+        // dup keeps the jumbled state
+        OK (GrB_Matrix_dup (&C1, A)) ;
+        CHECK (A->jumbled && C1->jumbled) ;
+        OK (GrB_Matrix_wait (&C1)) ;
+        CHECK (!C1->jumbled) ;
+        CHECK (GB_mx_isequal (C1, S, 0)) ;
+        GrB_Matrix_free_(&C1) ;
+
+        // A is sorted when waited on
+        OK (GrB_Matrix_wait (&A)) ;
+        CHECK (!A->jumbled) ;
+        CHECK (GB_mx_isequal (A, S, 0)) ;
+
+        GrB_Matrix_free_(&A) ;
+        GrB_Matrix_free_(&S) ;
+        GrB_Matrix_free_(&F) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // deferred D=op(A)
+    //--------------------------------------------------------------------------
+
+    // D=ainv(A) is deferred, and then read in several ways.  R=ainv(A) is
+    // computed right away, since it has an accumulator.
+
+    {
+        GrB_Matrix B = NULL, D = NULL, E = NULL, R = NULL, F = NULL, S = NULL ;
+        GrB_Index n = 10 ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        OK (GrB_Matrix_new (&R, GrB_FP64, n, n)) ;
+        OK (GxB_Matrix_Option_set (R, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        for (int64_t k = 0 ; k < 30 ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, k + 0.5, k % n, 3 * (k / n))) ;
+        }
+        OK (GrB_Matrix_wait (&A)) ;
+        OK (GrB_Matrix_apply (R, NULL, GrB_PLUS_FP64, GrB_AINV_FP64, A,
+            NULL)) ;
+        CHECK (!GB_DEFERRED (R)) ;
+        OK (GrB_Matrix_new (&F, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_assign_FP64 (F, NULL, NULL, 2, GrB_ALL, n, GrB_ALL, n,
+            NULL)) ;
+
+        // deferred, then reduced to a scalar: the op is fused, and D stays
+        // deferred
+        double sum = 0 ;
+        OK (GrB_Matrix_new (&D, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_apply (D, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+        CHECK (GB_DEFERRED (D) && D->shared != NULL) ;
+        OK (GrB_Matrix_reduce_FP64 (&sum, NULL, GrB_PLUS_MONOID_FP64, D,
+            NULL)) ;
+        CHECK (sum == -(30 * 29 / 2 + 15)) ;
+        CHECK (GB_DEFERRED (D)) ;
+
+        // deferred, then extractElement: A(3,3) is 13.5
+        double x = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&x, D, 3, 3)) ;
+        CHECK (x == -13.5) ;
+        OK (GrB_Matrix_nvals (&nvals, D)) ;
+        CHECK (nvals == 30) ;
+
+        // deferred, then an input to mxm; A itself is unchanged
+        GrB_Matrix_free_(&D) ;
+        OK (GrB_Matrix_new (&D, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_apply (D, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+        CHECK (GB_DEFERRED (D)) ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&E, GrB_FP64, n, n)) ;
+        OK (GrB_mxm (B, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, D, F,
+            NULL)) ;
+        OK (GrB_mxm (E, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, R, F,
+            NULL)) ;
+        CHECK (GB_mx_isequal (B, E, 0)) ;
+        OK (GrB_Matrix_wait (&D)) ;
+        CHECK (GB_mx_isequal (D, R, 0)) ;
+        OK (GrB_Matrix_extractElement_FP64 (&x, A, 3, 3)) ;
+        CHECK (x == 13.5) ;
+        GrB_Matrix_free_(&B) ;
+        GrB_Matrix_free_(&E) ;
+
+        // snapshot of a deferred matrix: the op is applied first, and S
+        // shares the result
+        GrB_Matrix_free_(&D) ;
+        OK (GrB_Matrix_new (&D, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_apply (D, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+        CHECK (GB_DEFERRED (D)) ;
+        OK (GxB_Matrix_snapshot (&S, D)) ;
+        CHECK (!GB_DEFERRED (D) && !GB_DEFERRED (S)) ;
+        CHECK (D->shared != NULL && S->shared == D->shared) ;
+        CHECK (GB_mx_isequal (S, R, 0)) ;
+        GrB_Matrix_free_(&D) ;
+        CHECK (GB_mx_isequal (S, R, 0)) ;
+        GrB_Matrix_free_(&S) ;
+
+        // two user threads defer D2 [t] = ainv (G) at the same time, from a
+        // matrix G whose content is not yet shared: only one shared object
+        // is created, and G is unchanged
+        GrB_Matrix G = NULL, D2 [2] = { NULL, NULL } ;
+        OK (GrB_Matrix_dup (&G, A)) ;
+        OK (GrB_Matrix_wait (&G)) ;
+        CHECK (G->shared == NULL) ;
+        OK (GrB_Matrix_new (&(D2 [0]), GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&(D2 [1]), GrB_FP64, n, n)) ;
+        GrB_Info info2 [2] = { GrB_SUCCESS, GrB_SUCCESS } ;
+        #pragma omp parallel for num_threads(2) schedule(static,1)
+        for (int t = 0 ; t < 2 ; t++)
+        {
+            info2 [t] = GrB_Matrix_apply (D2 [t], NULL, NULL, GrB_AINV_FP64,
+                G, NULL) ;
+        }
+        OK (info2 [0]) ;
+        OK (info2 [1]) ;
+        CHECK (GB_DEFERRED (D2 [0]) && GB_DEFERRED (D2 [1])) ;
+        CHECK (G->shared != NULL && G->shared->nshared == 3) ;
+        CHECK (D2 [0]->shared == G->shared && D2 [1]->shared == G->shared) ;
+        OK (GrB_Matrix_wait (&(D2 [0]))) ;
+        OK (GrB_Matrix_wait (&(D2 [1]))) ;
+        CHECK (GB_mx_isequal (D2 [0], R, 0)) ;
+        CHECK (GB_mx_isequal (D2 [1], R, 0)) ;
+        CHECK (GB_mx_isequal (G, A, 0)) ;
+        GrB_Matrix_free_(&(D2 [0])) ;
+        GrB_Matrix_free_(&(D2 [1])) ;
+        GrB_Matrix_free_(&G) ;
+
+        // out of memory while finishing a deferred op to a new type: D is
+        // left invalid, as it is by any method that runs out of memory, and
+        // can only be freed.  The content it shared with A is not freed.
+        OK (GrB_Matrix_new (&D, GrB_FP32, n, n)) ;
+        OK (GrB_Matrix_apply (D, NULL, NULL, GrB_IDENTITY_FP32, A, NULL)) ;
+        CHECK (GB_DEFERRED (D)) ;
+        GB_Global_malloc_debug_set (true) ;
+        GB_Global_malloc_debug_count_set (0) ;
+        info = GrB_Matrix_wait (&D) ;
+        GB_Global_malloc_debug_set (false) ;
+        CHECK (info == GrB_OUT_OF_MEMORY) ;
+        CHECK (!GB_DEFERRED (D) && D->shared == NULL) ;
+        expected = GrB_INVALID_OBJECT ;
+        ERR (GxB_Matrix_fprint (D, "D invalid", GxB_SILENT, NULL)) ;
+        GrB_Matrix_free_(&D) ;
+        OK (GrB_Matrix_new (&D, GrB_FP32, n, n)) ;
+        OK (GrB_Matrix_apply (D, NULL, NULL, GrB_IDENTITY_FP32, A, NULL)) ;
+        OK (GrB_Matrix_wait (&D)) ;
+        float y = 0 ;
+        OK (GrB_Matrix_extractElement_FP32 (&y, D, 3, 3)) ;
+        CHECK (y == 13.5) ;
+        GrB_Matrix_free_(&D) ;
+        OK (GrB_Matrix_extractElement_FP64 (&x, A, 3, 3)) ;
+        CHECK (x == 13.5) ;
+        OK (GrB_Matrix_nvals (&nvals, A)) ;
+        CHECK (nvals == 30) ;
+
+        GrB_Matrix_free_(&A) ;
+        GrB_Matrix_free_(&R) ;
+        GrB_Matrix_free_(&F) ;
+    }
+
     //--------------------------------------------------------------------------
     // wrapup
     //--------------------------------------------------------------------------
@@ -0,0 +1,215 @@
+//------------------------------------------------------------------------------
+// GB_mex_context: C = A*B with a GxB_Context engaged
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A*B is computed with a context engaged that sets the # of threads, the
+// chunk size, a workspace memory budget, and a workspace arena.  The info
+// returned by GrB_mxm is also returned, since a small budget can cause it to
+// return GrB_OUT_OF_MEMORY.  If arena is negative, the arena is sized
+// automatically, and C = A*B is computed three times, so that the later ones
+// take their workspace from the arena sized by the first.  A second context
+// with an arena is engaged by a thread inside a parallel region of this
+// mexFunction, which must get its workspace from the arena, except inside a
+// nested parallel region.  Finally, the context is freed while another thread
+// has it engaged, which must fail, and then while this thread has it engaged,
+// which must succeed.
+
+#include "GB_mex.h"
+
+#define USAGE "[C,info] = GB_mex_context (A, B, nthreads, budget, arena)"
+
+#define FREE_ALL                        \
+{                                       \
+    GxB_Context_disengage (NULL) ;      \
+    GxB_Context_free (&context) ;       \
+    GxB_Context_free (&context2) ;      \
+    GrB_Matrix_free_(&A) ;              \
+    GrB_Matrix_free_(&B) ;              \
+    GrB_Matrix_free_(&C) ;              \
+    GB_mx_put_global (true) ;           \
+}
+
+#define OK(method)                      \
+{                                       \
+    info = method ;                     \
+    if (info != GrB_SUCCESS)            \
+    {                                   \
+        FREE_ALL ;                      \
+        mexErrMsgTxt ("context failed") ; \
+    }                                   \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL ;
+    GxB_Context context = NULL, context2 = NULL ;
+    GrB_Info info ;
+
+    // check inputs
+    if (nargout > 2 || nargin != 5)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get A and B (shallow copies)
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A input", false, true) ;
+    B = GB_mx_mxArray_to_Matrix (pargin [1], "B input", false, true) ;
+    if (A == NULL || B == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A or B failed") ;
+    }
+    if (A->type != GrB_FP64 || B->type != GrB_FP64)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A and B must be double") ;
+    }
+
+    int nthreads = (int) mxGetScalar (pargin [2]) ;
+    int64_t budget = (int64_t) mxGetScalar (pargin [3]) ;
+    int64_t arena = (int64_t) mxGetScalar (pargin [4]) ;
+
+    // create the context
+    OK (GxB_Context_new (&context)) ;
+    OK (GxB_Context_set (context, GxB_CONTEXT_NTHREADS, nthreads)) ;
+    OK (GxB_Context_set (context, GxB_CONTEXT_CHUNK, (double) 1)) ;
+    OK (GxB_Context_set (context, GxB_CONTEXT_MEMORY_BUDGET, budget)) ;
+    bool arena_auto = (arena < 0) ;
+    arena = GB_IMAX (arena, 0) ;
+    OK (GxB_Context_set (context, GxB_CONTEXT_ARENA, arena)) ;
+    OK (GxB_Context_set (context, GxB_CONTEXT_ARENA_AUTO, arena_auto)) ;
+
+    // check the settings
+    int nthreads2 ;
+    int64_t budget2, arena2 ;
+    bool arena_auto2 ;
+    OK (GxB_Context_get (context, GxB_CONTEXT_NTHREADS, &nthreads2)) ;
+    OK (GxB_Context_get (context, GxB_CONTEXT_MEMORY_BUDGET, &budget2)) ;
+    OK (GxB_Context_get (context, GxB_CONTEXT_ARENA, &arena2)) ;
+    OK (GxB_Context_get (context, GxB_CONTEXT_ARENA_AUTO, &arena_auto2)) ;
+    if ((nthreads > 0 && nthreads2 != nthreads) || budget2 != budget
+        || arena2 < arena || arena_auto2 != arena_auto)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("context settings wrong") ;
+    }
+
+    // C = A*B with the context engaged
+    GrB_Index m, n ;
+    OK (GrB_Matrix_nrows (&m, A)) ;
+    OK (GrB_Matrix_ncols (&n, B)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, m, n)) ;
+    OK (GxB_Context_engage (context)) ;
+    GrB_Info mxm_info ;
+    for (int trial = 0 ; trial < (arena_auto ? 3 : 1) ; trial++)
+    {
+        mxm_info = GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+            A, B, NULL) ;
+        OK (GrB_Matrix_wait (&C)) ;
+    }
+    OK (GxB_Context_disengage (context)) ;
+
+    // the arena cannot be resized while in use
+    if (arena > 0)
+    {
+        OK (GxB_Context_engage (context)) ;
+        if (GxB_Context_set (context, GxB_CONTEXT_ARENA, arena)
+            != GrB_INVALID_VALUE)
+        {
+            FREE_ALL ;
+            mexErrMsgTxt ("arena resized while engaged") ;
+        }
+        OK (GxB_Context_disengage (NULL)) ;
+    }
+
+    // the arena is used by a thread inside a parallel region of the caller,
+    // but not inside a nested parallel region
+    OK (GxB_Context_new (&context2)) ;
+    OK (GxB_Context_set (context2, GxB_CONTEXT_ARENA, (int64_t) 4096)) ;
+    bool arena_ok = true ;
+    #pragma omp parallel num_threads(2)
+    {
+        if (GB_OPENMP_GET_THREAD_ID == GB_OPENMP_GET_NUM_THREADS - 1
+            && GxB_Context_engage (context2) == GrB_SUCCESS)
+        {
+            size_t size = 0, size2 = 0 ;
+            void *p = GB_Context_arena_malloc (context2, 100, &size) ;
+            void *p2 = NULL ;
+            #pragma omp parallel num_threads(1)
+            {
+                p2 = GB_Context_arena_malloc (context2, 100, &size2) ;
+            }
+            #if defined ( _OPENMP )
+            arena_ok = (p != NULL && p2 == NULL) ;
+            #else
+            arena_ok = (p != NULL) ;
+            #endif
+            if (p2 != NULL) GB_Context_arena_free (context2, p2, size2) ;
+            if (p != NULL) GB_Context_arena_free (context2, p, size) ;
+            GxB_Context_disengage (context2) ;
+        }
+    }
+    if (!arena_ok || context2->engaged != 0 || context2->arena_nblocks != 0)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("arena not used inside a parallel region") ;
+    }
+    OK (GxB_Context_free (&context2)) ;
+
+    // a context engaged by another thread is in use, and cannot be freed
+    GrB_Info engage_info = GrB_SUCCESS, free_info = GrB_SUCCESS ;
+    int nteam = 1 ;
+    #pragma omp parallel num_threads(2)
+    {
+        int tid = GB_OPENMP_GET_THREAD_ID ;
+        if (tid == 1)
+        {
+            engage_info = GxB_Context_engage (context) ;
+        }
+        #pragma omp barrier
+        if (tid == 0)
+        {
+            nteam = GB_OPENMP_GET_NUM_THREADS ;
+            if (nteam == 2) free_info = GxB_Context_free (&context) ;
+        }
+        #pragma omp barrier
+        if (tid == 1)
+        {
+            GxB_Context_disengage (context) ;
+        }
+    }
+    if (nteam == 2 && (engage_info != GrB_SUCCESS
+        || free_info != GrB_INVALID_OBJECT || context == NULL
+        || context->engaged != 0))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("context in use by another thread was freed") ;
+    }
+
+    // a context engaged by this thread is disengaged and freed
+    OK (GxB_Context_engage (context)) ;
+    OK (GxB_Context_free (&context)) ;
+    if (context != NULL || GB_Context_engaged ( ) != NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("engaged context not freed") ;
+    }
+
+    // return C and the info to MATLAB
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C output", true) ;
+    pargout [1] = mxCreateDoubleScalar ((double) mxm_info) ;
+    FREE_ALL ;
+}
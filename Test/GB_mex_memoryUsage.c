@@ -0,0 +1,232 @@
+//------------------------------------------------------------------------------
+// GB_mex_memoryUsage: memory held by a matrix, and the global memory counts
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C is a copy of the double matrix A, converted to the given sparsity control
+// (GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, or GxB_FULL), and
+// usage = GxB_Matrix_memoryUsage (C) is returned as a row vector of length
+// GxB_NMEMORY_USAGE.  The global counts of GxB_MEMORY_STORAGE and
+// GxB_MEMORY_WORKSPACE are checked along the way:  the storage of C is
+// counted in GxB_MEMORY_STORAGE, the workspace of T = C*C' is freed when the
+// mxm is done, the work arrays of GrB_Matrix_build are counted as workspace
+// and not as storage, and freeing everything returns GxB_MEMORY_STORAGE to
+// where it started.  The memory of pending tuples is checked as well.
+
+#include "GB_mex.h"
+
+#define USAGE "usage = GB_mex_memoryUsage (A, sparsity)"
+
+#define FREE_ALL                                    \
+{                                                   \
+    GrB_Matrix_free_(&A) ;                          \
+    GrB_Matrix_free_(&C) ;                          \
+    GrB_Matrix_free_(&T) ;                          \
+    GrB_Vector_free_(&u) ;                          \
+    mxFree (I) ;                                    \
+    mxFree (J) ;                                    \
+    mxFree (X) ;                                    \
+    GB_mx_put_global (true) ;                       \
+}
+
+#define OK(method)                                  \
+{                                                   \
+    info = method ;                                 \
+    if (info != GrB_SUCCESS)                        \
+    {                                               \
+        FREE_ALL ;                                  \
+        mexErrMsgTxt ("memoryUsage failed") ;       \
+    }                                               \
+}
+
+#undef CHECK
+#define CHECK(ok)                                   \
+{                                                   \
+    if (!(ok))                                      \
+    {                                               \
+        FREE_ALL ;                                  \
+        mexErrMsgTxt ("check failed: " #ok) ;       \
+    }                                               \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, T = NULL ;
+    GrB_Vector u = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    GrB_Info info ;
+
+    // check inputs
+    if (nargout > 1 || nargin != 2)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get A (shallow copy)
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A input", false, true) ;
+    if (A == NULL || A->type != GrB_FP64)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A failed, or not double") ;
+    }
+    GrB_Index nrows, ncols, nvals ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+
+    // get the sparsity control
+    int sparsity = (int) mxGetScalar (pargin [1]) ;
+
+    //--------------------------------------------------------------------------
+    // get the global counts, and reset their peaks
+    //--------------------------------------------------------------------------
+
+    size_t usage [GxB_NMEMORY_USAGE] ;
+    int64_t storage = -1, storage_peak = -1, werk = -1, werk_peak = -1 ;
+    CHECK (GxB_Global_Option_get (GxB_MEMORY_STORAGE, NULL)
+        == GrB_NULL_POINTER) ;
+    OK (GxB_memoryPeak_reset ( )) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_STORAGE, &storage)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_STORAGE_PEAK, &storage_peak)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_WORKSPACE, &werk)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_WORKSPACE_PEAK, &werk_peak)) ;
+    CHECK (storage >= 0 && storage_peak == storage) ;
+    CHECK (werk >= 0 && werk_peak == werk) ;
+    int64_t storage0 = storage ;
+    int64_t werk0 = werk ;
+
+    //--------------------------------------------------------------------------
+    // C = A, with the given sparsity
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_dup (&C, A)) ;
+    OK (GxB_Matrix_Option_set (C, GxB_SPARSITY_CONTROL, sparsity)) ;
+    OK (GrB_Matrix_wait (&C)) ;
+    CHECK (GxB_Matrix_memoryUsage (NULL, C) == GrB_NULL_POINTER) ;
+    OK (GxB_Matrix_memoryUsage (usage, C)) ;
+    size_t total = 0 ;
+    for (int k = 0 ; k <= GxB_MEMORY_OTHER ; k++)
+    {
+        total += usage [k] ;
+    }
+    CHECK (usage [GxB_MEMORY_TOTAL] == total) ;
+    CHECK (usage [GxB_MEMORY_SLACK] < total) ;
+    CHECK (usage [GxB_MEMORY_PENDING] == 0) ;
+    CHECK (usage [GxB_MEMORY_OTHER] > 0) ;
+
+    // the storage of C is counted in the global usage
+    OK (GxB_Global_Option_get (GxB_MEMORY_STORAGE, &storage)) ;
+    CHECK (storage == storage0 + (int64_t) total) ;
+
+    // return usage to MATLAB
+    pargout [0] = mxCreateDoubleMatrix (1, GxB_NMEMORY_USAGE, mxREAL) ;
+    double *x = mxGetDoubles (pargout [0]) ;
+    for (int k = 0 ; k < GxB_NMEMORY_USAGE ; k++)
+    {
+        x [k] = (double) usage [k] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T = C*C' uses workspace, which is freed when done
+    //--------------------------------------------------------------------------
+
+    GrB_Descriptor desc = GrB_DESC_T1 ;
+    OK (GrB_Matrix_new (&T, GrB_FP64, nrows, nrows)) ;
+    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, C, C, desc)) ;
+    OK (GrB_Matrix_wait (&T)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_WORKSPACE, &werk)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_STORAGE_PEAK, &storage_peak)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_WORKSPACE_PEAK, &werk_peak)) ;
+    CHECK (werk == werk0) ;
+    CHECK (werk_peak >= werk) ;
+    CHECK (storage_peak >= storage0 + (int64_t) total) ;
+
+    // freeing C and T returns the storage count to where it started
+    GrB_Matrix_free_(&C) ;
+    GrB_Matrix_free_(&T) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_STORAGE, &storage)) ;
+    CHECK (storage == storage0) ;
+    OK (GxB_memoryPeak_reset ( )) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_STORAGE_PEAK, &storage_peak)) ;
+    CHECK (storage_peak == storage0) ;
+
+    //--------------------------------------------------------------------------
+    // C = sparse (I,J,X) with each entry of A given twice
+    //--------------------------------------------------------------------------
+
+    // The work arrays of GrB_Matrix_build are counted as workspace, and only
+    // the arrays transplanted into C are counted as its storage.  The tuples
+    // are in reverse order, so the builder must sort them.
+
+    I = mxMalloc ((2*nvals + 1) * sizeof (GrB_Index)) ;
+    J = mxMalloc ((2*nvals + 1) * sizeof (GrB_Index)) ;
+    X = mxMalloc ((2*nvals + 1) * sizeof (double)) ;
+    GrB_Index ntuples = nvals ;
+    OK (GrB_Matrix_extractTuples_FP64 (I, J, X, &ntuples, A)) ;
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        I [2*nvals-1-k] = I [k] ;
+        J [2*nvals-1-k] = J [k] ;
+        X [2*nvals-1-k] = X [k] ;
+    }
+    ntuples = 2 * nvals ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, nrows, ncols)) ;
+    OK (GxB_memoryPeak_reset ( )) ;
+    OK (GrB_Matrix_build_FP64 (C, I, J, X, ntuples, GrB_PLUS_FP64)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_WORKSPACE, &werk)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_WORKSPACE_PEAK, &werk_peak)) ;
+    CHECK (werk == werk0) ;
+    CHECK (werk_peak >= werk0 + (int64_t) (ntuples * sizeof (int64_t))) ;
+    OK (GxB_Matrix_memoryUsage (usage, C)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_STORAGE, &storage)) ;
+    CHECK (storage == storage0 + (int64_t) usage [GxB_MEMORY_TOTAL]) ;
+    GrB_Matrix_free_(&C) ;
+
+    //--------------------------------------------------------------------------
+    // pending tuples
+    //--------------------------------------------------------------------------
+
+    // C is sparse and empty, and then C(k,k) = 1 is added for the diagonal.
+    // These become pending tuples (unless C is 1-by-1, where the entry goes
+    // into C directly), each holding at least its row index.
+
+    GrB_Index ndiag = GB_IMIN (nrows, ncols) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, nrows, ncols)) ;
+    OK (GxB_Matrix_Option_set (C, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    for (int64_t k = 0 ; k < ndiag ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (C, 1, k, k)) ;
+    }
+    int64_t npending = (C->Pending == NULL) ? 0 : C->Pending->n ;
+    OK (GxB_Matrix_memoryUsage (usage, C)) ;
+    CHECK (usage [GxB_MEMORY_PENDING] >= npending * sizeof (int64_t)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_STORAGE, &storage)) ;
+    CHECK (storage == storage0 + (int64_t) usage [GxB_MEMORY_TOTAL]) ;
+    OK (GrB_Matrix_wait (&C)) ;
+    OK (GxB_Matrix_memoryUsage (usage, C)) ;
+    CHECK (usage [GxB_MEMORY_PENDING] == 0) ;
+    GrB_Matrix_free_(&C) ;
+
+    // the usage of a GrB_Vector
+    OK (GrB_Vector_new (&u, GrB_FP64, nrows)) ;
+    OK (GxB_Vector_memoryUsage (usage, u)) ;
+    CHECK (usage [GxB_MEMORY_TOTAL] > 0) ;
+    GrB_Vector_free_(&u) ;
+
+    OK (GxB_Global_Option_get (GxB_MEMORY_STORAGE, &storage)) ;
+    CHECK (storage == storage0) ;
+    FREE_ALL ;
+}
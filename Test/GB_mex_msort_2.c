@@ -56,7 +56,7 @@ void mexFunction
     memcpy (Jout, J, n * sizeof (int64_t)) ;
 
     GB_MEX_TIC ;
-    GB_msort_2b (Iout, Jout, n, nthreads) ;
+    GB_msort_2b (Iout, Jout, n, nthreads, NULL) ;
     GB_MEX_TOC ;
 
     GB_mx_put_global (true) ;   
@@ -69,7 +69,7 @@ void mexFunction
     memcpy (Kout, K, n * sizeof (int64_t)) ;
 
     GB_MEX_TIC ;
-    GB_msort_3b (Iout, Jout, Kout, n, nthreads) ;
+    GB_msort_3b (Iout, Jout, Kout, n, nthreads, NULL) ;
     GB_MEX_TOC ;
 
     GB_mx_put_global (true) ;   
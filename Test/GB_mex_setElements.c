@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// GB_mex_setElements: set, remove, and extract a list of entries
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A, then C(I(k),J(k)) = X(k) for all k with GxB_Matrix_setElements, then
+// C(Ir(k),Jr(k)) is removed for all k with GxB_Matrix_removeElements, and
+// finally Y(k) = C(I(k),J(k)) with GxB_Matrix_extractElements.  Y(k) is zero
+// if C(I(k),J(k)) is not present.  I, J, Ir, and Jr are zero-based.  If A is
+// a column vector, the GxB_Vector_* methods are used instead, and J and Jr are
+// ignored.
+
+#include "GB_mex.h"
+
+#define USAGE "[C,Y] = GB_mex_setElements (A, I, J, X, Ir, Jr)"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free_(&C) ;              \
+    GB_mx_put_global (true) ;           \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C = NULL ;
+    GrB_Index *I = NULL, ni = 0, I_range [3] ;
+    GrB_Index *J = NULL, nj = 0, J_range [3] ;
+    GrB_Index *Ir = NULL, nir = 0, Ir_range [3] ;
+    GrB_Index *Jr = NULL, njr = 0, Jr_range [3] ;
+    bool is_list ;
+
+    // check inputs
+    if (nargout > 2 || nargin != 6)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get I, J, Ir, and Jr
+    if (!GB_mx_mxArray_to_indices (&I, pargin [1], &ni, I_range, &is_list)
+        || !is_list ||
+        !GB_mx_mxArray_to_indices (&J, pargin [2], &nj, J_range, &is_list)
+        || !is_list ||
+        !GB_mx_mxArray_to_indices (&Ir, pargin [4], &nir, Ir_range, &is_list)
+        || !is_list ||
+        !GB_mx_mxArray_to_indices (&Jr, pargin [5], &njr, Jr_range, &is_list)
+        || !is_list)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("I, J, Ir, and Jr must be lists") ;
+    }
+    if (ni != nj || nir != njr)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("I and J (and Ir and Jr) must be the same size") ;
+    }
+
+    // get X
+    if (!mxIsDouble (pargin [3]) || mxIsComplex (pargin [3]) ||
+        mxIsSparse (pargin [3]) || ni != mxGetNumberOfElements (pargin [3]))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("X must be a dense real double array the same size as I");
+    }
+    double *X = mxGetDoubles (pargin [3]) ;
+
+    // get Y
+    pargout [1] = GB_mx_create_full (ni, 1, GrB_FP64) ;
+    double *Y = mxGetDoubles (pargout [1]) ;
+
+    // get C (deep copy)
+    #define GET_DEEP_COPY \
+    C = GB_mx_mxArray_to_Matrix (pargin [0], "C input", true, true) ;
+    #define FREE_DEEP_COPY GrB_Matrix_free_(&C) ;
+    GET_DEEP_COPY ;
+    if (C == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("C failed") ;
+    }
+
+    if (GB_VECTOR_OK (C))
+    {
+        // C(I) = X, remove C(Ir), Y = C(I)
+        METHOD (GxB_Vector_setElements_FP64 ((GrB_Vector) C, I, X, ni)) ;
+        METHOD (GxB_Vector_removeElements ((GrB_Vector) C, Ir, nir)) ;
+        GxB_Vector_extractElements_FP64 (Y, NULL, (GrB_Vector) C, I, ni) ;
+    }
+    else
+    {
+        // C(I,J) = X, remove C(Ir,Jr), Y = C(I,J)
+        METHOD (GxB_Matrix_setElements_FP64 (C, I, J, X, ni)) ;
+        METHOD (GxB_Matrix_removeElements (C, Ir, Jr, nir)) ;
+        GxB_Matrix_extractElements_FP64 (Y, NULL, C, I, J, ni) ;
+    }
+
+    // return C to MATLAB as a struct
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C output", true) ;
+    FREE_ALL ;
+}
+
@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// GB_mex_snapshot: take a snapshot of a matrix, then modify the matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A, S = snapshot of C, then C = -C.  S must be unchanged.
+
+#include "GB_mex.h"
+
+#define USAGE "[C,S] = GB_mex_snapshot (A)"
+
+#define FREE_ALL                        \
+{                                       \
+    GrB_Matrix_free_(&A) ;              \
+    GrB_Matrix_free_(&C) ;              \
+    GrB_Matrix_free_(&S) ;              \
+    GB_mx_put_global (true) ;           \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, S = NULL ;
+
+    // check inputs
+    if (nargout > 2 || nargin != 1)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get A (shallow copy)
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A input", false, true) ;
+    if (A == NULL)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A failed") ;
+    }
+
+    #define GET_DEEP_COPY                   \
+    {                                       \
+        GrB_Matrix_dup (&C, A) ;            \
+        GxB_Matrix_snapshot (&S, C) ;       \
+    }
+    #define FREE_DEEP_COPY                  \
+    {                                       \
+        GrB_Matrix_free_(&C) ;              \
+        GrB_Matrix_free_(&S) ;              \
+    }
+
+    GET_DEEP_COPY ;
+
+    // C = -C, which gives C its own copy of the content shared with S
+    METHOD (GrB_Matrix_apply (C, NULL, NULL, GrB_AINV_FP64, C, NULL)) ;
+
+    // return C and S to MATLAB as structs
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C output", true) ;
+    pargout [1] = GB_mx_Matrix_to_mxArray (&S, "S output", true) ;
+    FREE_ALL ;
+}
+
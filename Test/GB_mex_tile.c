@@ -0,0 +1,188 @@
+//------------------------------------------------------------------------------
+// GB_mex_tile: C = A*B or C = A', one tile at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A*B is computed with GxB_TILE_SIZE set to tile_size, with the
+// descriptor desc (which may transpose A and/or B).  If B is empty, C = A' is
+// computed instead, and desc is not used.  C is computed again with no tiles,
+// and the two results must have the same pattern, and the same values to
+// within roundoff, since the tiles sum the terms of each C(i,j) in a
+// different order.  The same is done for C += A*B (or C += A'), where C
+// starts with the single entry C(0,0) = 1.  C = A*B (or A') with tiles is
+// returned to MATLAB.  GxB_TILE_SIZE is set back to zero when done.
+
+#include "GB_mex.h"
+
+#define USAGE "C = GB_mex_tile (A, B, tile_size, desc)"
+
+#define FREE_ALL                                         \
+{                                                        \
+    GxB_Global_Option_set (GxB_TILE_SIZE, (int64_t) 0) ; \
+    GrB_Matrix_free_(&A) ;                               \
+    GrB_Matrix_free_(&B) ;                               \
+    GrB_Matrix_free_(&C) ;                               \
+    GrB_Matrix_free_(&D) ;                               \
+    GrB_Matrix_free_(&T) ;                               \
+    GrB_Descriptor_free_(&desc) ;                        \
+    GB_mx_put_global (true) ;                            \
+}
+
+#define OK(method)                                  \
+{                                                   \
+    info = method ;                                 \
+    if (info != GrB_SUCCESS)                        \
+    {                                               \
+        FREE_ALL ;                                  \
+        mexErrMsgTxt ("tile failed") ;              \
+    }                                               \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, D = NULL, T = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Info info ;
+
+    // check inputs
+    if (nargout > 1 || nargin != 4)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get A and B (shallow copies)
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A input", false, true) ;
+    if (A == NULL || A->type != GrB_FP64)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A failed, or not double") ;
+    }
+    bool transpose = mxIsEmpty (pargin [1]) ;
+    if (!transpose)
+    {
+        B = GB_mx_mxArray_to_Matrix (pargin [1], "B input", false, true) ;
+        if (B == NULL || B->type != GrB_FP64)
+        {
+            FREE_ALL ;
+            mexErrMsgTxt ("B failed, or not double") ;
+        }
+    }
+
+    // get tile_size
+    int64_t tile_size = (int64_t) mxGetScalar (pargin [2]) ;
+
+    // get desc
+    if (!GB_mx_mxArray_to_Descriptor (&desc, pargin [3], "desc"))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("desc failed") ;
+    }
+
+    // GxB_TILE_SIZE is zero by default, and a negative size is the same
+    int64_t tile_size2 = -1 ;
+    OK (GxB_Global_Option_get (GxB_TILE_SIZE, &tile_size2)) ;
+    if (tile_size2 != 0 ||
+        GxB_Global_Option_get (GxB_TILE_SIZE, NULL) != GrB_NULL_POINTER)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("tile size get failed") ;
+    }
+    OK (GxB_Global_Option_set (GxB_TILE_SIZE, (int64_t) -1)) ;
+    OK (GxB_Global_Option_get (GxB_TILE_SIZE, &tile_size2)) ;
+    if (tile_size2 != 0)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("negative tile size not zero") ;
+    }
+
+    // get the size of C
+    GrB_Index cnrows, cncols ;
+    if (transpose)
+    {
+        OK (GrB_Matrix_ncols (&cnrows, A)) ;
+        OK (GrB_Matrix_nrows (&cncols, A)) ;
+    }
+    else
+    {
+        GrB_Desc_Value in0, in1 ;
+        OK (GxB_Desc_get (desc, GrB_INP0, &in0)) ;
+        OK (GxB_Desc_get (desc, GrB_INP1, &in1)) ;
+        if (in0 == GrB_TRAN)
+        {
+            OK (GrB_Matrix_ncols (&cnrows, A)) ;
+        }
+        else
+        {
+            OK (GrB_Matrix_nrows (&cnrows, A)) ;
+        }
+        if (in1 == GrB_TRAN)
+        {
+            OK (GrB_Matrix_nrows (&cncols, B)) ;
+        }
+        else
+        {
+            OK (GrB_Matrix_ncols (&cncols, B)) ;
+        }
+    }
+
+    // D = A*B (or A') with tiles, and T = A*B (or A') without, first with
+    // no accum, and then C += A*B (or A') with C(0,0) = 1 to start
+    for (int trial = 0 ; trial < 2 ; trial++)
+    {
+        GrB_BinaryOp accum = (trial == 0) ? NULL : GrB_PLUS_FP64 ;
+        OK (GrB_Matrix_new (&D, GrB_FP64, cnrows, cncols)) ;
+        OK (GrB_Matrix_new (&T, GrB_FP64, cnrows, cncols)) ;
+        OK (GxB_Matrix_Option_set (D, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        OK (GxB_Matrix_Option_set (T, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        if (accum != NULL && cnrows > 0 && cncols > 0)
+        {
+            OK (GrB_Matrix_setElement_FP64 (D, 1, 0, 0)) ;
+            OK (GrB_Matrix_setElement_FP64 (T, 1, 0, 0)) ;
+        }
+        for (int tiled = 1 ; tiled >= 0 ; tiled--)
+        {
+            GrB_Matrix X = tiled ? D : T ;
+            OK (GxB_Global_Option_set (GxB_TILE_SIZE, tiled ? tile_size : 0));
+            if (transpose)
+            {
+                OK (GrB_transpose (X, NULL, accum, A, NULL)) ;
+            }
+            else
+            {
+                OK (GrB_mxm (X, NULL, accum, GrB_PLUS_TIMES_SEMIRING_FP64,
+                    A, B, desc)) ;
+            }
+        }
+        OK (GrB_Matrix_wait (&D)) ;
+        OK (GrB_Matrix_wait (&T)) ;
+        if (!GB_mx_isequal (D, T, 1e-12))
+        {
+            FREE_ALL ;
+            mexErrMsgTxt ("tiled result differs") ;
+        }
+        if (trial == 0)
+        {
+            // keep the first result D, to return to MATLAB
+            C = D ;
+            D = NULL ;
+        }
+        GrB_Matrix_free_(&D) ;
+        GrB_Matrix_free_(&T) ;
+    }
+
+    // return C to MATLAB as a struct
+    pargout [0] = GB_mx_Matrix_to_mxArray (&C, "C output", true) ;
+    FREE_ALL ;
+}
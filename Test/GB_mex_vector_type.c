@@ -0,0 +1,316 @@
+//------------------------------------------------------------------------------
+// GB_mex_vector_type: operations on a type with vector-valued entries
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A and B are square double matrices of the same size.  A type of k values
+// of etype ('single' or 'double') is created with GxB_Type_new_vector, and
+// the matrices AV and BV are built from A and B, where the t-th value of
+// AV(i,j) is A(i,j)*t and the t-th value of BV(i,j) is B(i,j)+t-1, for
+// t = 1:k.  Then, with operators from GxB_BinaryOp_new_vector:
+
+//      C = AV*BV       PLUS_TIMES semiring, native saxpy kernel
+//      D = max (AV,BV) eWiseAdd
+//      E = AV'*BV      PLUS_TIMES semiring, dot product
+//      F = AV .* y     apply, with y(t) = t bound to the 2nd input
+//      s = sum (AV)    reduce to scalar
+
+// C, D, E, and F are returned as 1-by-k cell arrays, where C{t} holds the
+// t-th value of each entry of C, and s is returned as a 1-by-k vector.  The
+// error cases of GxB_Type_new_vector and GxB_BinaryOp_new_vector are also
+// checked.
+
+#include "GB_mex.h"
+
+#define USAGE "[C,D,E,F,s] = GB_mex_vector_type (A, B, k, etype)"
+
+#define FREE_ALL                                    \
+{                                                   \
+    GrB_Matrix_free_(&A) ;                          \
+    GrB_Matrix_free_(&B) ;                          \
+    GrB_Matrix_free_(&AV) ;                         \
+    GrB_Matrix_free_(&BV) ;                         \
+    GrB_Matrix_free_(&CV) ;                         \
+    GrB_Matrix_free_(&T) ;                          \
+    GrB_Semiring_free_(&Vplus_times) ;              \
+    GrB_Monoid_free_(&Vplus_monoid) ;               \
+    GrB_BinaryOp_free_(&Vplus) ;                    \
+    GrB_BinaryOp_free_(&Vtimes) ;                   \
+    GrB_BinaryOp_free_(&Vmax) ;                     \
+    GrB_Type_free_(&Vec) ;                          \
+    GrB_Descriptor_free_(&desc) ;                   \
+    mxFree (I) ;                                    \
+    mxFree (J) ;                                    \
+    mxFree (X) ;                                    \
+    mxFree (Xt) ;                                   \
+    mxFree (XV) ;                                   \
+    GB_mx_put_global (true) ;                       \
+}
+
+#define OK(method)                                  \
+{                                                   \
+    info = method ;                                 \
+    if (info != GrB_SUCCESS)                        \
+    {                                               \
+        FREE_ALL ;                                  \
+        mexErrMsgTxt ("vector type failed") ;       \
+    }                                               \
+}
+
+#define FAIL(method,expected)                       \
+{                                                   \
+    if (method != expected)                         \
+    {                                               \
+        FREE_ALL ;                                  \
+        mexErrMsgTxt ("error not caught") ;         \
+    }                                               \
+}
+
+// get the t-th value of the entry in X [p], of k values each
+#define GET_VALUE(X,p,t)                            \
+    (fp32 ? ((float  *) X) [(p)*k + (t)] :          \
+            ((double *) X) [(p)*k + (t)])
+
+// set the t-th value of the entry in X [p]
+#define SET_VALUE(X,p,t,x)                          \
+{                                                   \
+    if (fp32)                                       \
+    {                                               \
+        ((float *) X) [(p)*k + (t)] = (float) (x) ; \
+    }                                               \
+    else                                            \
+    {                                               \
+        ((double *) X) [(p)*k + (t)] = (x) ;        \
+    }                                               \
+}
+
+// pargout [kout] = CV, as a cell array of k double matrices
+#define RETURN_CELL(kout)                                                   \
+{                                                                           \
+    GrB_Index cnrows, cncols, cnvals ;                                      \
+    OK (GrB_Matrix_nrows (&cnrows, CV)) ;                                   \
+    OK (GrB_Matrix_ncols (&cncols, CV)) ;                                   \
+    OK (GrB_Matrix_nvals (&cnvals, CV)) ;                                   \
+    OK (GrB_Matrix_extractTuples_UDT (I, J, XV, &cnvals, CV)) ;             \
+    pargout [kout] = mxCreateCellMatrix (1, k) ;                            \
+    for (int t = 0 ; t < k ; t++)                                           \
+    {                                                                       \
+        for (int64_t p = 0 ; p < cnvals ; p++)                              \
+        {                                                                   \
+            Xt [p] = GET_VALUE (XV, p, t) ;                                 \
+        }                                                                   \
+        OK (GrB_Matrix_new (&T, GrB_FP64, cnrows, cncols)) ;                \
+        OK (GrB_Matrix_build_FP64 (T, I, J, Xt, cnvals, GrB_PLUS_FP64)) ;   \
+        mxSetCell (pargout [kout], t,                                       \
+            GB_mx_Matrix_to_mxArray (&T, "T output", true)) ;               \
+    }                                                                       \
+    GrB_Matrix_free_(&CV) ;                                                 \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, AV = NULL, BV = NULL, CV = NULL, T = NULL ;
+    GrB_Type Vec = NULL ;
+    GrB_BinaryOp Vplus = NULL, Vtimes = NULL, Vmax = NULL ;
+    GrB_Monoid Vplus_monoid = NULL ;
+    GrB_Semiring Vplus_times = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL, *Xt = NULL ;
+    void *XV = NULL ;
+    GrB_Info info ;
+
+    // check inputs
+    if (nargout > 5 || nargin != 4)
+    {
+        mexErrMsgTxt ("Usage: " USAGE) ;
+    }
+
+    // get A and B (shallow copies)
+    A = GB_mx_mxArray_to_Matrix (pargin [0], "A input", false, true) ;
+    B = GB_mx_mxArray_to_Matrix (pargin [1], "B input", false, true) ;
+    if (A == NULL || B == NULL || A->type != GrB_FP64 || B->type != GrB_FP64)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A or B failed, or not double") ;
+    }
+    GrB_Index n, nrows, ncols ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    if (ncols != n)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("A must be square") ;
+    }
+    OK (GrB_Matrix_nrows (&nrows, B)) ;
+    OK (GrB_Matrix_ncols (&ncols, B)) ;
+    if (nrows != n || ncols != n)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("B must be the same size as A") ;
+    }
+
+    // get k and etype
+    int k = (int) mxGetScalar (pargin [2]) ;
+    GrB_Type etype = GB_mx_string_to_Type (pargin [3], GrB_FP64) ;
+    bool fp32 = (etype == GrB_FP32) ;
+    if (k < 1 || k > GxB_VECTOR_MAXLEN || !(fp32 || etype == GrB_FP64))
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("k or etype invalid") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error cases
+    //--------------------------------------------------------------------------
+
+    FAIL (GxB_Type_new_vector (&Vec, etype, 0), GrB_INVALID_VALUE) ;
+    FAIL (GxB_Type_new_vector (&Vec, etype, GxB_VECTOR_MAXLEN + 1),
+        GrB_INVALID_VALUE) ;
+    FAIL (GxB_Type_new_vector (&Vec, GrB_INT32, k), GrB_DOMAIN_MISMATCH) ;
+    OK (GxB_Type_new_vector (&Vec, etype, k)) ;
+    size_t vsize = 0 ;
+    OK (GxB_Type_size (&vsize, Vec)) ;
+    if (vsize != ((size_t) k) * etype->size)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("vector type size wrong") ;
+    }
+    OK (GxB_Type_fprint (Vec, "Vec", GxB_COMPLETE, NULL)) ;
+
+    FAIL (GxB_BinaryOp_new_vector (&Vplus,
+        fp32 ? GrB_PLUS_FP64 : GrB_PLUS_FP32, Vec), GrB_DOMAIN_MISMATCH) ;
+    FAIL (GxB_BinaryOp_new_vector (&Vplus,
+        fp32 ? GrB_MINUS_FP32 : GrB_MINUS_FP64, Vec), GrB_DOMAIN_MISMATCH) ;
+    FAIL (GxB_BinaryOp_new_vector (&Vplus,
+        fp32 ? GrB_PLUS_FP32 : GrB_PLUS_FP64, etype), GrB_DOMAIN_MISMATCH) ;
+    OK (GxB_BinaryOp_new_vector (&Vplus,
+        fp32 ? GrB_PLUS_FP32 : GrB_PLUS_FP64, Vec)) ;
+    OK (GxB_BinaryOp_new_vector (&Vtimes,
+        fp32 ? GrB_TIMES_FP32 : GrB_TIMES_FP64, Vec)) ;
+    OK (GxB_BinaryOp_new_vector (&Vmax,
+        fp32 ? GrB_MAX_FP32 : GrB_MAX_FP64, Vec)) ;
+    OK (GxB_BinaryOp_fprint (Vplus, "Vplus", GxB_COMPLETE, NULL)) ;
+
+    // an operator on vector-valued entries has no function pointer
+    if (Vtimes->function != NULL || Vtimes->vector_opcode != GB_TIMES_opcode)
+    {
+        FREE_ALL ;
+        mexErrMsgTxt ("vector op invalid") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // build AV and BV from A and B
+    //--------------------------------------------------------------------------
+
+    GrB_Index nmax = n * n ;
+    I  = mxMalloc ((nmax + 1) * sizeof (GrB_Index)) ;
+    J  = mxMalloc ((nmax + 1) * sizeof (GrB_Index)) ;
+    X  = mxMalloc ((nmax + 1) * sizeof (double)) ;
+    Xt = mxMalloc ((nmax + 1) * sizeof (double)) ;
+    XV = mxMalloc ((nmax + 1) * vsize) ;
+
+    for (int kin = 0 ; kin < 2 ; kin++)
+    {
+        GrB_Matrix M = (kin == 0) ? A : B ;
+        GrB_Index mnvals ;
+        OK (GrB_Matrix_nvals (&mnvals, M)) ;
+        OK (GrB_Matrix_extractTuples_FP64 (I, J, X, &mnvals, M)) ;
+        for (int64_t p = 0 ; p < mnvals ; p++)
+        {
+            for (int t = 0 ; t < k ; t++)
+            {
+                // AV(i,j)(t) = A(i,j)*t and BV(i,j)(t) = B(i,j)+t-1
+                if (kin == 0)
+                {
+                    SET_VALUE (XV, p, t, X [p] * (t+1)) ;
+                }
+                else
+                {
+                    SET_VALUE (XV, p, t, X [p] + t) ;
+                }
+            }
+        }
+        GrB_Matrix *handle = (kin == 0) ? &AV : &BV ;
+        OK (GrB_Matrix_new (handle, Vec, n, n)) ;
+        OK (GrB_Matrix_build_UDT (*handle, I, J, XV, mnvals, Vplus)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = AV*BV with the native saxpy kernel
+    //--------------------------------------------------------------------------
+
+    void *vzero = mxCalloc (1, vsize) ;
+    info = GrB_Monoid_new_UDT (&Vplus_monoid, Vplus, vzero) ;
+    mxFree (vzero) ;
+    OK (info) ;
+    OK (GrB_Semiring_new (&Vplus_times, Vplus_monoid, Vtimes)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_Desc_set (desc, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+    OK (GrB_Matrix_new (&CV, Vec, n, n)) ;
+    OK (GrB_mxm (CV, NULL, NULL, Vplus_times, AV, BV, desc)) ;
+    RETURN_CELL (0) ;
+
+    //--------------------------------------------------------------------------
+    // D = max (AV,BV)
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&CV, Vec, n, n)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (CV, NULL, NULL, Vmax, AV, BV, NULL)) ;
+    RETURN_CELL (1) ;
+
+    //--------------------------------------------------------------------------
+    // E = AV'*BV with the dot product
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Desc_set (desc, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GxB_Desc_set (desc, GrB_INP0, GrB_TRAN)) ;
+    OK (GrB_Matrix_new (&CV, Vec, n, n)) ;
+    OK (GrB_mxm (CV, NULL, NULL, Vplus_times, AV, BV, desc)) ;
+    RETURN_CELL (2) ;
+
+    //--------------------------------------------------------------------------
+    // F = AV .* y
+    //--------------------------------------------------------------------------
+
+    void *y = mxMalloc (vsize) ;
+    for (int t = 0 ; t < k ; t++)
+    {
+        SET_VALUE (y, 0, t, t+1) ;
+    }
+    OK (GrB_Matrix_new (&CV, Vec, n, n)) ;
+    info = GrB_Matrix_apply_BinaryOp2nd_UDT (CV, NULL, NULL, Vtimes, AV, y,
+        NULL) ;
+    mxFree (y) ;
+    OK (info) ;
+    RETURN_CELL (3) ;
+
+    //--------------------------------------------------------------------------
+    // s = sum (AV)
+    //--------------------------------------------------------------------------
+
+    void *s = mxMalloc (vsize) ;
+    info = GrB_Matrix_reduce_UDT (s, NULL, Vplus_monoid, AV, NULL) ;
+    pargout [4] = mxCreateDoubleMatrix (1, k, mxREAL) ;
+    double *sx = mxGetDoubles (pargout [4]) ;
+    for (int t = 0 ; t < k ; t++)
+    {
+        sx [t] = GET_VALUE (s, 0, t) ;
+    }
+    mxFree (s) ;
+    OK (info) ;
+
+    FREE_ALL ;
+}
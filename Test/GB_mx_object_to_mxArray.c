@@ -47,6 +47,13 @@ mxArray *GB_mx_object_to_mxArray   // returns the MATLAB mxArray
     // may have pending tuples
     ASSERT_MATRIX_OK (C, name, GB0) ;
 
+    // C may share its content with a snapshot, or with the input of a
+    // deferred GrB_apply; give C its own copy
+    if (GB_unshare (C, Context) != GrB_SUCCESS)
+    {
+        mexErrMsgTxt ("out of memory") ;
+    }
+
     // C must not be shallow
     ASSERT (!C->p_shallow) ;
     ASSERT (!C->h_shallow) ;
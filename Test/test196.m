@@ -0,0 +1,28 @@
+function test196
+%TEST196 test GxB_Matrix_snapshot
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test196 ----------- S = snapshot (C), then C = -C\n') ;
+
+rng ('default') ;
+
+for d = [0 1e-3 0.1 0.5 inf]
+    for m = [1 10 50]
+        for n = [1 10 50]
+            A = GB_spec_random (m, n, d, 128, 'double') ;
+            for sparsity_control = [1 2 4 8]
+                A.sparsity = sparsity_control ;
+                for csc = [1 0]
+                    A.is_csc = csc ;
+                    [C, S] = GB_mex_snapshot (A) ;
+                    assert (isequal (S.matrix, A.matrix)) ;
+                    assert (isequal (C.matrix, -A.matrix)) ;
+                end
+            end
+        end
+    end
+end
+
+fprintf ('test196: all tests passed\n') ;
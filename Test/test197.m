@@ -0,0 +1,54 @@
+function test197
+%TEST197 test GxB_*_setElements, removeElements, and extractElements
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test197: ----------------- test batched setElements/removeElements\n') ;
+
+rng ('default') ;
+
+for m = [1 10 100]
+    for n = [1 10 100]
+        for d = [0 0.1 0.5 1]
+            for nvals = [0 1 10 1000]
+
+                A = sprand (m, n, d) ;
+                % with duplicates, in random order
+                I = floor (m * rand (nvals, 1)) ;
+                J = floor (n * rand (nvals, 1)) ;
+                X = rand (nvals, 1) + 1 ;
+                Ir = floor (m * rand (floor (nvals/2), 1)) ;
+                Jr = floor (n * rand (floor (nvals/2), 1)) ;
+
+                % MATLAB result: the last duplicate is used
+                C2 = A ;
+                for k = 1:nvals
+                    C2 (I(k)+1, J(k)+1) = X (k) ;
+                end
+                for k = 1:length (Ir)
+                    C2 (Ir(k)+1, Jr(k)+1) = 0 ;
+                end
+                Y2 = zeros (nvals, 1) ;
+                for k = 1:nvals
+                    Y2 (k) = C2 (I(k)+1, J(k)+1) ;
+                end
+
+                for sparsity = [1 2 4 8]
+                    for is_csc = [0 1]
+                        clear S
+                        S.matrix = A ;
+                        S.sparsity = sparsity ;
+                        S.is_csc = is_csc ;
+                        [C1,Y1] = GB_mex_setElements (S, I, J, X, Ir, Jr) ;
+                        assert (isequal (C1.matrix, C2)) ;
+                        assert (isequal (Y1, Y2)) ;
+                    end
+                end
+            end
+        end
+    end
+end
+
+fprintf ('\ntest197: all tests passed\n') ;
+
@@ -0,0 +1,31 @@
+function test198
+%TEST198 test GxB_Context
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test198 ----------- C = A*B with a GxB_Context engaged\n') ;
+
+rng ('default') ;
+
+for n = [1 10 100 500]
+    A = sprand (n, n, 0.1) ;
+    B = sprand (n, n, 0.1) ;
+    C2 = A*B ;
+    for nthreads = [0 1 4]
+        for arena = [0 1024 1e6 -1]
+            % no budget: the result must be correct
+            [C1, info] = GB_mex_context (A, B, nthreads, 0, arena) ;
+            assert (info == 0) ;
+            assert (norm (C1.matrix - C2, 1) <= 1e-12 * norm (C2, 1)) ;
+            % a tiny budget: the result is correct, or out of memory
+            [C1, info] = GB_mex_context (A, B, nthreads, 64, arena) ;
+            assert (info == 0 || info == 10) ;
+            if (info == 0)
+                assert (norm (C1.matrix - C2, 1) <= 1e-12 * norm (C2, 1)) ;
+            end
+        end
+    end
+end
+
+fprintf ('test198: all tests passed\n') ;
@@ -0,0 +1,52 @@
+function test199
+%TEST199 test GxB_TILE_SIZE
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test199 ----------- C = A*B and C = A'', one tile at a time\n') ;
+
+rng ('default') ;
+
+dnn = [ ] ;
+dtn = struct ('inp0', 'tran') ;
+dnt = struct ('inp1', 'tran') ;
+dtt = struct ('inp0', 'tran', 'inp1', 'tran') ;
+
+for tile_size = [1 7 32 1000]
+    for d = [0 0.01 0.1 0.5]
+        fprintf ('.') ;
+        m = 200 ;
+        n = 150 ;
+        k = 90 ;
+        A = sprand (m, k, d) ;
+        B = sprand (k, n, d) ;
+        % a block of A with no entries, so some tiles of A are empty
+        A (100:200, 1:64) = 0 ;
+
+        % C = A*B, A'*B, A*B', and A'*B'
+        C = GB_mex_tile (A, B, tile_size, dnn) ;
+        C2 = A*B ;
+        assert (norm (C.matrix - C2, 1) <= 1e-12 * max (norm (C2, 1), 1)) ;
+        C = GB_mex_tile (A', B, tile_size, dtn) ;
+        assert (norm (C.matrix - C2, 1) <= 1e-12 * max (norm (C2, 1), 1)) ;
+        C = GB_mex_tile (A, B', tile_size, dnt) ;
+        assert (norm (C.matrix - C2, 1) <= 1e-12 * max (norm (C2, 1), 1)) ;
+        C = GB_mex_tile (A', B', tile_size, dtt) ;
+        assert (norm (C.matrix - C2, 1) <= 1e-12 * max (norm (C2, 1), 1)) ;
+
+        % C = A*A' and C = A'*A
+        C = GB_mex_tile (A, A, tile_size, dnt) ;
+        C2 = A*A' ;
+        assert (norm (C.matrix - C2, 1) <= 1e-12 * max (norm (C2, 1), 1)) ;
+        C = GB_mex_tile (A, A, tile_size, dtn) ;
+        C2 = A'*A ;
+        assert (norm (C.matrix - C2, 1) <= 1e-12 * max (norm (C2, 1), 1)) ;
+
+        % C = A'
+        C = GB_mex_tile (A, [ ], tile_size, dnn) ;
+        assert (isequal (C.matrix, A')) ;
+    end
+end
+
+fprintf ('\ntest199: all tests passed\n') ;
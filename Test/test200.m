@@ -0,0 +1,48 @@
+function test200
+%TEST200 test GxB_Type_new_vector and GxB_BinaryOp_new_vector
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test200 ----------- matrices with vector-valued entries\n') ;
+
+rng ('default') ;
+
+for etype = {'double', 'single'}
+    if (isequal (etype {1}, 'single'))
+        tol = 1e-5 ;
+    else
+        tol = 1e-12 ;
+    end
+    for k = [1 3 8]
+        for n = [1 10 50]
+            for d = [0 0.1 0.5]
+                fprintf ('.') ;
+                % all entries are positive, so that max (At,Bt) in MATLAB
+                % has the same pattern as the GraphBLAS eWiseAdd
+                A = sprand (n, n, d) ;
+                B = sprand (n, n, d) ;
+                [C, D, E, F, s] = GB_mex_vector_type (A, B, k, etype {1}) ;
+                for t = 1:k
+                    % the t-th value of each entry of A and B
+                    At = A * t ;
+                    Bt = B + (t-1) * spones (B) ;
+                    check (C {t}, At*Bt, tol) ;
+                    check (D {t}, max (At, Bt), tol) ;
+                    check (E {t}, At'*Bt, tol) ;
+                    check (F {t}, At * t, tol) ;
+                    s2 = full (sum (sum (At))) ;
+                    assert (abs (s (t) - s2) <= tol * max (abs (s2), 1)) ;
+                end
+            end
+        end
+    end
+end
+
+fprintf ('\ntest200: all tests passed\n') ;
+
+%-------------------------------------------------------------------------------
+
+function check (C, C2, tol)
+assert (isequal (spones (C.matrix), spones (C2))) ;
+assert (norm (C.matrix - C2, 1) <= tol * max (norm (C2, 1), 1)) ;
@@ -0,0 +1,61 @@
+function test201
+%TEST201 test GxB_Matrix_memoryUsage and the global memory counts
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test201 ----------- memory held by matrices, storage, workspace\n') ;
+
+rng ('default') ;
+
+% the usage vector, indexed by GxB_MEMORY_* + 1
+P = 1 ; H = 2 ; I = 3 ; X = 4 ; B = 5 ;
+
+for m = [1 10 200]
+    for n = [1 10 150]
+        for d = [0 0.01 0.2]
+            fprintf ('.') ;
+            A = sprand (m, n, d) ;
+            e = nnz (A) ;
+            ncols = nnz (any (A, 1)) ;
+
+            % hypersparse
+            usage = GB_mex_memoryUsage (A, 1) ;
+            check (usage) ;
+            if (n > 1)
+                assert (usage (H) >= ncols * 8) ;
+            end
+            assert (usage (I) >= e * 8 && usage (X) >= e * 8) ;
+            assert (usage (B) == 0) ;
+
+            % sparse
+            usage = GB_mex_memoryUsage (A, 2) ;
+            check (usage) ;
+            assert (usage (P) >= (n+1) * 8 && usage (H) == 0) ;
+            assert (usage (I) >= e * 8 && usage (X) >= e * 8) ;
+            assert (usage (B) == 0) ;
+
+            % bitmap: no pattern
+            usage = GB_mex_memoryUsage (A, 4) ;
+            check (usage) ;
+            assert (usage (P) == 0 && usage (H) == 0 && usage (I) == 0) ;
+            assert (usage (B) >= m*n && usage (X) >= m*n*8) ;
+
+            % full: only the values
+            usage = GB_mex_memoryUsage (rand (m, n), 8) ;
+            check (usage) ;
+            assert (usage (P) == 0 && usage (H) == 0 && usage (I) == 0) ;
+            assert (usage (B) == 0 && usage (X) >= m*n*8) ;
+        end
+    end
+end
+
+fprintf ('\ntest201: all tests passed\n') ;
+
+%-------------------------------------------------------------------------------
+
+function check (usage)
+% the total is the sum of the parts, and no pending tuples remain
+assert (usage (9) == sum (usage (1:7))) ;
+assert (usage (8) < usage (9)) ;
+assert (usage (6) == 0) ;
@@ -93,6 +93,12 @@ logstat ('test151b',t); % test bshift operator
 hack (2) = 0 ;
 GB_mex_hack (hack) ;
 
+logstat ('test201',t) ; % test GxB_Matrix_memoryUsage
+logstat ('test200',t) ; % test GxB_Type_new_vector and GxB_BinaryOp_new_vector
+logstat ('test199',t) ; % test GxB_TILE_SIZE
+logstat ('test198',t) ; % test GxB_Context
+logstat ('test197',t) ; % test GxB_*_setElements, removeElements, extractElements
+logstat ('test196',t) ; % test GxB_Matrix_snapshot
 logstat ('test195',t) ; % test all variants of saxpy3
 logstat ('test194',t) ; % test GxB_Vector_diag
 logstat ('test193',t) ; % test GxB_Matrix_diag